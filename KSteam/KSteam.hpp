@@ -47,6 +47,8 @@ SOFTWARE.
 #include "impl/FlashTSpec.hpp"
 #include "impl/Properties.hpp"
 #include "impl/PropertyProxy.hpp"
+#include "impl/Uncertainty.hpp"
+#include "impl/Adjoint.hpp"
 #include "impl/Flash.hpp"
 
 #endif    // KSTEAM_KSTEAM_HPP
@@ -0,0 +1,270 @@
+/*
+KKKKKKKKK    KKKKKKK   SSSSSSSSSSSSSSS      tttt
+K:::::::K    K:::::K SS:::::::::::::::S  ttt:::t
+K:::::::K    K:::::KS:::::SSSSSS::::::S  t:::::t
+K:::::::K   K::::::KS:::::S     SSSSSSS  t:::::t
+KK::::::K  K:::::KKKS:::::S        ttttttt:::::ttttttt        eeeeeeeeeeee    aaaaaaaaaaaaa      mmmmmmm    mmmmmmm
+  K:::::K K:::::K   S:::::S        t:::::::::::::::::t      ee::::::::::::ee  a::::::::::::a   mm:::::::m  m:::::::mm
+  K::::::K:::::K     S::::SSSS     t:::::::::::::::::t     e::::::eeeee:::::eeaaaaaaaaa:::::a m::::::::::mm::::::::::m
+  K:::::::::::K       SS::::::SSSSStttttt:::::::tttttt    e::::::e     e:::::e         a::::a m::::::::::::::::::::::m
+  K:::::::::::K         SSS::::::::SS    t:::::t          e:::::::eeeee::::::e  aaaaaaa:::::a m:::::mmm::::::mmm:::::m
+  K::::::K:::::K           SSSSSS::::S   t:::::t          e:::::::::::::::::e aa::::::::::::a m::::m   m::::m   m::::m
+  K:::::K K:::::K               S:::::S  t:::::t          e::::::eeeeeeeeeee a::::aaaa::::::a m::::m   m::::m   m::::m
+KK::::::K  K:::::KKK            S:::::S  t:::::t    tttttte:::::::e         a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K   K::::::KSSSSSSS     S:::::S  t::::::tttt:::::te::::::::e        a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS::::::SSSSSS:::::S  tt::::::::::::::t e::::::::eeeeeeeea:::::aaaa::::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS:::::::::::::::SS     tt:::::::::::tt  ee:::::::::::::e a::::::::::aa:::am::::m   m::::m   m::::m
+KKKKKKKKK    KKKKKKK SSSSSSSSSSSSSSS         ttttttttttt      eeeeeeeeeeeeee  aaaaaaaaaa  aaaammmmmm   mmmmmm   mmmmmm
+
+MIT License
+
+Copyright (c) 2023 Kenneth Troldal Balslev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef KSTEAM_ADJOINT_HPP
+#define KSTEAM_ADJOINT_HPP
+
+#include "Common.hpp"
+#include "Config.hpp"
+#include "Error.hpp"
+#include "Sensitivity.hpp"
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+namespace KSteam
+{
+
+    /**
+     * @brief A tape for reverse mode (adjoint) sensitivities of batches of flash calculations.
+     *
+     * Each call to record() solves a batch of flash calculations, returns the requested properties, and keeps the
+     * converged states on the tape. After seeding the adjoints of the outputs (the derivatives of a scalar objective
+     * with respect to the recorded property values), a single call to backward() propagates them to the adjoints of
+     * the specifications of every batch.
+     *
+     * The local Jacobian of each flash, i.e. the derivatives of the properties with respect to the specifications, is
+     * found from the converged state using the implicit function theorem (see impl::specificationGradients), so no
+     * additional flash calculations are performed. The Jacobians are only computed on the first call to backward(),
+     * and are kept for subsequent sweeps with other seeds.
+     *
+     * Batches can be chained with connect(), when a specification of one batch is a property computed by an earlier
+     * batch. The adjoints are then propagated through the chain in the same sweep, so the gradient of the objective
+     * with respect to all independent specifications is obtained at a cost independent of their number.
+     */
+    class FlashTape
+    {
+    public:
+        /**
+         * @brief Identifies a batch recorded on the tape.
+         */
+        using Handle = size_t;
+
+        /**
+         * @brief Solves a batch of flash calculations and records the converged states on the tape.
+         *
+         * The results are stored point by point: results[i * n + k] holds property k of point i, where n is the number
+         * of properties.
+         *
+         * @param spec1 The first specified property (e.g. Pressure).
+         * @param spec2 The second specified property (e.g. Enthalpy).
+         * @param values1 The values of the first specification.
+         * @param values2 The values of the second specification.
+         * @param properties The properties to calculate.
+         * @param results Output; the calculated property values.
+         * @return The handle of the recorded batch.
+         * @throws KSteamError If the sizes of the inputs do not match, or a flash calculation fails.
+         */
+        Handle record(Property                  spec1,
+                      Property                  spec2,
+                      std::span<const FLOAT>    values1,
+                      std::span<const FLOAT>    values2,
+                      std::span<const Property> properties,
+                      std::span<FLOAT>          results)
+        {
+            auto count = values1.size();
+            auto n     = properties.size();
+
+            if (values2.size() != count || results.size() != count * n)
+                throw KSteamError("Size mismatch", "FlashTape::record", { { "Points", static_cast<double>(count) } });
+
+            Batch batch { spec1, spec2, { properties.begin(), properties.end() } };
+            batch.states.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                batch.states.push_back(impl::flash(spec1, values1[i], spec2, values2[i]));
+                for (size_t k = 0; k < n; ++k) results[i * n + k] = batch.states.back().property(properties[k]);
+            }
+
+            batch.outputAdjoints.assign(count * n, 0.0);
+            batch.inputAdjoints.assign(count * 2, 0.0);
+            m_batches.push_back(std::move(batch));
+
+            return m_batches.size() - 1;
+        }
+
+        /**
+         * @brief Declares that a specification of one batch is a property computed by an earlier batch.
+         *
+         * During the backward sweep, the adjoints of the specification of the target batch are added to the adjoints
+         * of the property of the source batch. The batches must have the same number of points.
+         *
+         * @param source The batch computing the property.
+         * @param property The index of the property in the property list of the source batch.
+         * @param target The batch using the property as a specification. Must be recorded after the source batch.
+         * @param spec The index of the specification in the target batch (0 for the first, 1 for the second).
+         * @throws KSteamError If the handles or indices are invalid, or the batches have different sizes.
+         */
+        void connect(Handle source, size_t property, Handle target, size_t spec)
+        {
+            if (source >= target || target >= m_batches.size() || spec > 1 || property >= m_batches[source].properties.size() ||
+                m_batches[source].states.size() != m_batches[target].states.size())
+                throw KSteamError("Invalid connection", "FlashTape::connect", { { "Source", static_cast<double>(source) }, { "Target", static_cast<double>(target) } });
+
+            m_batches[target].connections.push_back({ source, property, spec });
+        }
+
+        /**
+         * @brief Returns the adjoints of the properties of a batch, to be seeded before calling backward().
+         *
+         * The adjoints are stored in the same layout as the results of record(), and are initially zero.
+         *
+         * @param batch The handle of the batch.
+         * @return The adjoints of the recorded properties.
+         * @throws KSteamError If the handle is invalid.
+         */
+        std::span<FLOAT> outputAdjoints(Handle batch) { return at(batch).outputAdjoints; }
+
+        /**
+         * @brief Returns the adjoints of the specifications of a batch, as computed by backward().
+         *
+         * The adjoints are stored point by point: adjoints[i * 2] and adjoints[i * 2 + 1] hold the derivatives of the
+         * objective with respect to the first and second specification of point i.
+         *
+         * @param batch The handle of the batch.
+         * @return The adjoints of the specifications.
+         * @throws KSteamError If the handle is invalid.
+         */
+        std::span<const FLOAT> inputAdjoints(Handle batch) { return at(batch).inputAdjoints; }
+
+        /**
+         * @brief Propagates the seeded output adjoints back to the specifications of all batches, in a single sweep
+         *        in reverse order of recording.
+         *
+         * The input adjoints of each batch are overwritten. The output adjoints of batches that are the source of a
+         * connection are accumulated into, so zeroAdjoints() should be called before reseeding.
+         *
+         * @throws KSteamError If the Jacobian of a flash calculation could not be computed.
+         */
+        void backward()
+        {
+            for (auto batch = m_batches.rbegin(); batch != m_batches.rend(); ++batch) {
+                auto n = batch->properties.size();
+                if (batch->jacobians.size() != batch->states.size() * n * 2) computeJacobians(*batch);
+
+                // The vector-Jacobian product, x_bar = J^T * y_bar, for each point
+                for (size_t i = 0; i < batch->states.size(); ++i) {
+                    const auto* jac     = &batch->jacobians[i * n * 2];
+                    const auto* adjoint = &batch->outputAdjoints[i * n];
+
+                    FLOAT adj1 = 0.0;
+                    FLOAT adj2 = 0.0;
+                    for (size_t k = 0; k < n; ++k) {
+                        adj1 += jac[k * 2] * adjoint[k];
+                        adj2 += jac[k * 2 + 1] * adjoint[k];
+                    }
+                    batch->inputAdjoints[i * 2]     = adj1;
+                    batch->inputAdjoints[i * 2 + 1] = adj2;
+                }
+
+                // Pass the adjoints of connected specifications on to the properties they were computed from
+                for (const auto& connection : batch->connections) {
+                    auto& source = m_batches[connection.source];
+                    auto  ns     = source.properties.size();
+                    for (size_t i = 0; i < batch->states.size(); ++i)
+                        source.outputAdjoints[i * ns + connection.property] += batch->inputAdjoints[i * 2 + connection.spec];
+                }
+            }
+        }
+
+        /**
+         * @brief Resets all adjoints on the tape to zero. The recorded states and Jacobians are kept.
+         */
+        void zeroAdjoints()
+        {
+            for (auto& batch : m_batches) {
+                std::fill(batch.outputAdjoints.begin(), batch.outputAdjoints.end(), 0.0);
+                std::fill(batch.inputAdjoints.begin(), batch.inputAdjoints.end(), 0.0);
+            }
+        }
+
+        /**
+         * @brief Removes all batches from the tape.
+         */
+        void clear() { m_batches.clear(); }
+
+        /**
+         * @brief Returns the number of batches recorded on the tape.
+         */
+        [[nodiscard]] size_t size() const { return m_batches.size(); }
+
+    private:
+        struct Connection
+        {
+            Handle source;   /*< The batch computing the property. */
+            size_t property; /*< The index of the property in the source batch. */
+            size_t spec;     /*< The index of the specification in the target batch. */
+        };
+
+        struct Batch
+        {
+            Property                      spec1;          /*< The first specified property. */
+            Property                      spec2;          /*< The second specified property. */
+            std::vector<Property>         properties;     /*< The recorded properties. */
+            std::vector<impl::FlashState> states;         /*< The converged states. */
+            std::vector<FLOAT>            jacobians;      /*< The local Jacobians, [dy0/ds1, dy0/ds2, dy1/ds1, ...] per point. */
+            std::vector<FLOAT>            outputAdjoints; /*< The adjoints of the properties. */
+            std::vector<FLOAT>            inputAdjoints;  /*< The adjoints of the specifications. */
+            std::vector<Connection>       connections;    /*< The specifications computed by earlier batches. */
+        };
+
+        Batch& at(Handle batch)
+        {
+            if (batch >= m_batches.size()) throw KSteamError("Invalid handle", "FlashTape", { { "Handle", static_cast<double>(batch) } });
+            return m_batches[batch];
+        }
+
+        static void computeJacobians(Batch& batch)
+        {
+            auto n = batch.properties.size();
+            batch.jacobians.resize(batch.states.size() * n * 2);
+            for (size_t i = 0; i < batch.states.size(); ++i) {
+                auto gradients = impl::specificationGradients(batch.states[i], batch.spec1, batch.spec2, batch.properties);
+                std::copy(gradients.begin(), gradients.end(), batch.jacobians.begin() + static_cast<std::ptrdiff_t>(i * n * 2));
+            }
+        }
+
+        std::vector<Batch> m_batches; /*< The recorded batches, in order of recording. */
+    };
+
+}    // namespace KSteam
+
+#endif    // KSTEAM_ADJOINT_HPP
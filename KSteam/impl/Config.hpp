@@ -59,6 +59,15 @@ namespace KSteam
      */
     constexpr int MAXITER = 100;
 
+    /**
+     * @brief The Accuracy enum selects how properties are evaluated.
+     *
+     * Exact evaluates the IAPWS-IF97 correlations directly. Fast uses surrogate models where they are available
+     * (currently the viscosity and thermal conductivity), trading a small, bounded error for speed. Properties
+     * without a surrogate model are always evaluated exactly.
+     */
+    enum class Accuracy { Exact, Fast };
+
 }    // namespace KSteam
 
 #endif    // KSTEAM_CONFIG_HPP
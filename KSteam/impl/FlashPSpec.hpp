@@ -45,9 +45,12 @@
 #include "Common.hpp"
 #include "Config.hpp"
 #include "Error.hpp"
+#include "Transport.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <optional>
+#include <span>
 
 namespace KSteam
 {
@@ -57,10 +60,11 @@ namespace KSteam
      * @param pressure The pressure in Pa.
      * @param temperature The temperature in K.
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      * @throws XLSteamError If input values are out of range.
      */
-    inline FLOAT calcPropertyPT(FLOAT pressure, FLOAT temperature, Property property)
+    inline FLOAT calcPropertyPT(FLOAT pressure, FLOAT temperature, Property property, Accuracy accuracy = Accuracy::Exact)
     {
         // Check for valid input
         if (temperature < 273.16 || temperature > 2273.15)
@@ -70,6 +74,9 @@ namespace KSteam
         if (temperature > 1073.15 && pressure > 50000000.0)
             throw KSteamError("Pressure out of range", "calcPropertyPT", { { "P", pressure }, { "T", temperature } });
 
+        // Use the surrogate models for transport properties, if requested
+        if (accuracy == Accuracy::Fast && impl::hasSurrogate(property)) return impl::transportPropertyPT(pressure, temperature, property);
+
         // Call the property function
         return PropertyFunctionsPT[property].second(temperature, pressure);
     }
@@ -79,10 +86,11 @@ namespace KSteam
      * @param pressure The pressure in Pa.
      * @param quality The steam quality (mass fraction of vapor phase).
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      * @throws XLSteamError If input values are out of range.
      */
-    inline FLOAT calcPropertyPX(FLOAT pressure, FLOAT quality, Property property)
+    inline FLOAT calcPropertyPX(FLOAT pressure, FLOAT quality, Property property, Accuracy accuracy = Accuracy::Exact)
     {
         // Check for valid input
         if (pressure <= 0.0 || pressure > IF97::get_pcrit())
@@ -90,6 +98,10 @@ namespace KSteam
         if (quality < 0.0 || quality > 1.0)
             throw KSteamError("Quality out of range", "calcPropertyPX", { { "P", pressure }, { "x", quality } });
 
+        // Use the surrogate models for transport properties of saturated liquid or vapor, if requested
+        if (accuracy == Accuracy::Fast && impl::hasSurrogate(property) && (quality == 0.0 || quality == 1.0))
+            return impl::transportPropertyPX(pressure, quality, property);
+
         // Return the property
         return PropertyFunctionsPX[property].second(pressure, quality);
     }
@@ -97,6 +109,93 @@ namespace KSteam
     namespace impl
     {
 
+        /**
+         * @class FlashState
+         * @brief Represents the converged state of a flash calculation.
+         *
+         * Regardless of the specification, a flash calculation ends up in one of two canonical states: a single phase
+         * state given by pressure and temperature, or a saturated state given by pressure and vapor quality. Once the
+         * state is known, any property can be evaluated from it without repeating the solve.
+         */
+        class FlashState
+        {
+        public:
+            /**
+             * @enum Type
+             * @brief The independent variables of the state.
+             */
+            enum Type { PT, PX };
+
+            /**
+             * @brief Create a single phase state from pressure and temperature.
+             * @param pressure The pressure in Pa.
+             * @param temperature The temperature in K.
+             * @return The FlashState object.
+             */
+            static FlashState fromPT(FLOAT pressure, FLOAT temperature) { return FlashState(PT, pressure, temperature); }
+
+            /**
+             * @brief Create a saturated state from pressure and vapor quality.
+             * @param pressure The pressure in Pa.
+             * @param quality The vapor quality.
+             * @return The FlashState object.
+             */
+            static FlashState fromPX(FLOAT pressure, FLOAT quality) { return FlashState(PX, pressure, quality); }
+
+            /**
+             * @brief Get the type of the state.
+             * @return PT for a single phase state, PX for a saturated state.
+             */
+            [[nodiscard]] Type type() const { return m_type; }
+
+            /**
+             * @brief Get the pressure of the state.
+             * @return The pressure in Pa.
+             */
+            [[nodiscard]] FLOAT pressure() const { return m_pressure; }
+
+            /**
+             * @brief Get the second independent variable of the state.
+             * @return The temperature in K for a PT state, or the vapor quality for a PX state.
+             */
+            [[nodiscard]] FLOAT other() const { return m_other; }
+
+            /**
+             * @brief Calculates the specified property at the state.
+             * @param property The thermodynamic property to be calculated.
+             * @param accuracy The accuracy policy (default: Accuracy::Exact).
+             * @return The calculated property value.
+             * @throws KSteamError If the state is out of range.
+             */
+            [[nodiscard]] FLOAT property(Property property, Accuracy accuracy = Accuracy::Exact) const
+            {
+                if (m_type == PT) return calcPropertyPT(m_pressure, m_other, property, accuracy);
+                return calcPropertyPX(m_pressure, m_other, property, accuracy);
+            }
+
+            /**
+             * @brief Calculates a set of properties at the state.
+             * @param properties The thermodynamic properties to be calculated.
+             * @param results The calculated property values, in the same order as the properties.
+             * @param accuracy The accuracy policy (default: Accuracy::Exact).
+             * @throws KSteamError If the sizes do not match, or the state is out of range.
+             */
+            void properties(std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact) const
+            {
+                if (properties.size() != results.size())
+                    throw KSteamError("Size mismatch", "FlashState::properties", { { "Properties", static_cast<double>(properties.size()) }, { "Results", static_cast<double>(results.size()) } });
+
+                for (size_t i = 0; i < properties.size(); ++i) results[i] = property(properties[i], accuracy);
+            }
+
+        private:
+            FlashState(Type type, FLOAT pressure, FLOAT other) : m_type(type), m_pressure(pressure), m_other(other) {}
+
+            Type  m_type;     /*< The independent variables of the state. */
+            FLOAT m_pressure; /*< The pressure in Pa. */
+            FLOAT m_other;    /*< The temperature in K, or the vapor quality. */
+        };
+
         /**
          * @brief Checks if the given pressure is within the valid range for the IAPWS-IF97 model.
          * @param pressure The pressure in Pa.
@@ -140,18 +239,17 @@ namespace KSteam
         }
 
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and another known property
+         * @brief Solves for the state of water/steam at given pressure and another known property
          *        in the supercritical region using the IAPWS-IF97 model.
          * @tparam OtherType The type of the other known property (as PropertyType enumeration).
          * @param pressure The pressure in Pa.
          * @param otherSpec The value of the other known property.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
          * @param guess Optional initial temperature guess for the solver (in K).
-         * @return The calculated property value.
+         * @return The converged state.
          * @throws XLSteamError If input values are out of range.
          */
         template<Property::Type OtherType>
-        inline FLOAT calcPSpecSupercritical(FLOAT pressure, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcPSpecSupercritical(FLOAT pressure, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             using namespace nxx::roots;
 
@@ -166,45 +264,56 @@ namespace KSteam
 
             // Solve the function
             auto temperature = fsolve<Bisection>(func, bounds, EPS);
-            return calcPropertyPT(pressure, checkResult(temperature), property);
+            return FlashState::fromPT(pressure, checkResult(temperature));
         }
 
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and another known property
+         * @brief Solves for the state of water/steam at given pressure and another known property
          *        in the saturation region using the IAPWS-IF97 model.
+         * @details The enthalpy, entropy, internal energy and specific volume of a saturated mixture are linear in
+         *          the quality, and the density is the inverse of the specific volume, so the quality is found
+         *          directly from the properties of the saturated liquid and vapor. An iterative solution would only
+         *          resolve the quality to the solver tolerance, which at low pressure is amplified by the ratio of the
+         *          vapor and liquid volumes.
          * @tparam OtherType The type of the other known property (as PropertyType enumeration).
          * @param pressure The pressure in Pa.
          * @param otherSpec The value of the other known property.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
-         * @return The calculated property value.
-         * @throws XLSteamError If input values are out of range.
+         * @return The converged state.
+         * @throws KSteamError If the specification is outside the saturation region.
          */
         template<Property::Type OtherType>
-        inline FLOAT calcPSpecSaturation(FLOAT pressure, FLOAT otherSpec, Property property)
+        inline FlashState calcPSpecSaturation(FLOAT pressure, FLOAT otherSpec)
         {
-            using namespace nxx::roots;
+            static_assert(OtherType == Property::Enthalpy || OtherType == Property::Entropy || OtherType == Property::InternalEnergy ||
+                          OtherType == Property::Volume || OtherType == Property::Density);
 
-            // Define the function to solve.
-            auto func = [&](FLOAT x) { return calcPropertyPX(pressure, x, OtherType) - otherSpec; };
+            auto propLiq = calcPropertyPX(pressure, 0.0, OtherType);
+            auto propVap = calcPropertyPX(pressure, 1.0, OtherType);
 
-            // Solve the function
-            auto quality = fsolve<Bisection>(func, { 0.0, 1.0 }, EPS);
-            return calcPropertyPX(pressure, checkResult(quality), property);
+            FLOAT quality;
+            if constexpr (OtherType == Property::Density)
+                quality = (1.0 / otherSpec - 1.0 / propLiq) / (1.0 / propVap - 1.0 / propLiq);
+            else
+                quality = (otherSpec - propLiq) / (propVap - propLiq);
+
+            // Allow for rounding at the saturated liquid and vapor
+            if (quality < -EPS || quality > 1.0 + EPS)
+                throw KSteamError("Specification outside the saturation region", "calcPSpecSaturation", { { "P", pressure }, { Property(OtherType).asString(), otherSpec } });
+            return FlashState::fromPX(pressure, std::clamp(quality, 0.0, 1.0));
         }
 
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and another known property
+         * @brief Solves for the state of water/steam at given pressure and another known property
          *        in the liquid region using the IAPWS-IF97 model.
          * @tparam OtherType The type of the other known property (as PropertyType enumeration).
          * @param pressure The pressure in Pa.
          * @param otherSpec The value of the other known property.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
          * @param guess Optional initial temperature guess for the solver (in K).
-         * @return The calculated property value.
+         * @return The converged state.
          * @throws XLSteamError If input values are out of range.
          */
         template<Property::Type OtherType>
-        inline FLOAT calcPSpecLiquid(FLOAT pressure, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcPSpecLiquid(FLOAT pressure, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             using namespace nxx::roots;
 
@@ -221,22 +330,21 @@ namespace KSteam
 
             // Solve the function
             auto temperature = fsolve<Bisection>(func, bounds, EPS);
-            return calcPropertyPT(pressure, checkResult(temperature), property);
+            return FlashState::fromPT(pressure, checkResult(temperature));
         }
 
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and another known property
+         * @brief Solves for the state of water/steam at given pressure and another known property
          *        in the vapor region using the IAPWS-IF97 model.
          * @tparam OtherType The type of the other known property (as PropertyType enumeration).
          * @param pressure The pressure in Pa.
          * @param otherSpec The value of the other known property.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
          * @param guess Optional initial temperature guess for the solver (in K).
-         * @return The calculated property value.
+         * @return The converged state.
          * @throws XLSteamError If input values are out of range.
          */
         template<Property::Type OtherType>
-        inline FLOAT calcPSpecVapor(FLOAT pressure, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcPSpecVapor(FLOAT pressure, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             using namespace nxx::roots;
 
@@ -253,22 +361,21 @@ namespace KSteam
 
             // Solve the function
             auto temperature = fsolve<Bisection>(func, bounds, EPS);
-            return calcPropertyPT(pressure, checkResult(temperature), property);
+            return FlashState::fromPT(pressure, checkResult(temperature));
         }
 
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and another known property
+         * @brief Solves for the state of water/steam at given pressure and another known property
          *        using the IAPWS-IF97 model.
          * @tparam OtherType The type of the other known property (as PropertyType enumeration).
          * @param pressure The pressure in Pa.
          * @param otherSpec The value of the other known property.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
          * @param guess Optional initial temperature guess for the solver (in K).
-         * @return The calculated property value.
+         * @return The converged state.
          * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
          */
         template<Property::Type OtherType>
-        inline FLOAT calcPSpec(FLOAT pressure, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcPSpec(FLOAT pressure, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             // Look up the string representation of the other property
             auto specString = Property(OtherType).asString();
@@ -279,7 +386,7 @@ namespace KSteam
                 throw KSteamError("Pressure out of range", "calcPropertyPH", { { "P", pressure }, { specString, otherSpec } });
 
             // Check if pressure is supercritical (dense phase) and use the appropriate solver
-            if (pressure > IF97::get_pcrit()) return calcPSpecSupercritical<OtherType>(pressure, otherSpec, property, guess);
+            if (pressure > IF97::get_pcrit()) return calcPSpecSupercritical<OtherType>(pressure, otherSpec, guess);
 
             // Determine the enthalpy of the saturated liquid and saturated vapor
             auto propLiq = calcPropertyPX(pressure, 0.0, OtherType);
@@ -287,36 +394,108 @@ namespace KSteam
 
             // Check if enthalpy is within the saturation curve and use the appropriate solver
             if (otherSpec >= propLiq && otherSpec <= propVap) {
-                return calcPSpecSaturation<OtherType>(pressure, otherSpec, property);
+                return calcPSpecSaturation<OtherType>(pressure, otherSpec);
             }
 
             // Check if enthalpy is in the liquid region and use the appropriate solver
-            if (otherSpec < propLiq) return calcPSpecLiquid<OtherType>(pressure, otherSpec, property, guess);
+            if (otherSpec < propLiq) return calcPSpecLiquid<OtherType>(pressure, otherSpec, guess);
 
             // Check if enthalpy is in the vapor region and use the appropriate solver
-            if (otherSpec > propVap) return calcPSpecVapor<OtherType>(pressure, otherSpec, property, guess);
+            if (otherSpec > propVap) return calcPSpecVapor<OtherType>(pressure, otherSpec, guess);
 
             // If we get here, something went wrong
             throw KSteamError("PH flash calculation error", "calcPropertyPH", { { "P", pressure }, { specString, otherSpec } });
         }
+
+        /**
+         * @brief Solves for the state of water/steam at given pressure and enthalpy using the IAPWS-IF97 model.
+         * @param pressure The pressure in Pa.
+         * @param enthalpy The enthalpy in J/kg.
+         * @return The converged state.
+         * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+         */
+        inline FlashState flashPH(FLOAT pressure, FLOAT enthalpy)
+        {
+            // Use the backward equation for the temperature guess
+            auto TGuess = IF97::T_phmass(pressure, enthalpy);
+
+            // Call the implementation
+            return calcPSpec<Property::Enthalpy>(pressure, enthalpy, TGuess);
+        }
+
+        /**
+         * @brief Solves for the state of water/steam at given pressure and entropy using the IAPWS-IF97 model.
+         * @param pressure The pressure in Pa.
+         * @param entropy The entropy in J/(kg·K).
+         * @return The converged state.
+         * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+         */
+        inline FlashState flashPS(FLOAT pressure, FLOAT entropy)
+        {
+            // Use the backward equation for the temperature guess
+            auto TGuess = IF97::T_psmass(pressure, entropy);
+
+            // Call the implementation
+            return calcPSpec<Property::Entropy>(pressure, entropy, TGuess);
+        }
+
+        /**
+         * @brief Solves for the state of water/steam at given pressure and internal energy using the IAPWS-IF97 model.
+         * @param pressure The pressure in Pa.
+         * @param internalEnergy The internal energy in J/kg.
+         * @return The converged state.
+         * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+         */
+        inline FlashState flashPU(FLOAT pressure, FLOAT internalEnergy)
+        {
+            // As there is no backward equation for the temperature guess, we let the solver determine the initial guess
+            return calcPSpec<Property::InternalEnergy>(pressure, internalEnergy);
+        }
     }    // namespace impl
 
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and temperature
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param temperature The temperature in K.
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPT(FLOAT pressure, FLOAT temperature, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::FlashState::fromPT(pressure, temperature).properties(properties, results, accuracy);
+    }
+
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and quality
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param quality The steam quality (mass fraction of vapor phase).
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPX(FLOAT pressure, FLOAT quality, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::FlashState::fromPX(pressure, quality).properties(properties, results, accuracy);
+    }
+
     /**
      * @brief Calculates the specified thermodynamic property of water/steam at given pressure and enthalpy
      *        using the IAPWS-IF97 model.
      * @param pressure The pressure in Pa.
      * @param enthalpy The enthalpy in J/kg.
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
      */
-    inline FLOAT calcPropertyPH(FLOAT pressure, FLOAT enthalpy, Property property)
+    inline FLOAT calcPropertyPH(FLOAT pressure, FLOAT enthalpy, Property property, Accuracy accuracy = Accuracy::Exact)
     {
-        // Use the backward equation for the temperature guess
-        auto TGuess = IF97::T_phmass(pressure, enthalpy);
-
-        // Call the implementation
-        return impl::calcPSpec<Property::Enthalpy>(pressure, enthalpy, property, TGuess);
+        return impl::flashPH(pressure, enthalpy).property(property, accuracy);
     }
 
     /**
@@ -325,16 +504,13 @@ namespace KSteam
      * @param pressure The pressure in Pa.
      * @param entropy The entropy in J/(kg·K).
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
      */
-    inline FLOAT calcPropertyPS(FLOAT pressure, FLOAT entropy, Property property)
+    inline FLOAT calcPropertyPS(FLOAT pressure, FLOAT entropy, Property property, Accuracy accuracy = Accuracy::Exact)
     {
-        // Use the backward equation for the temperature guess
-        auto TGuess = IF97::T_psmass(pressure, entropy);
-
-        // Call the implementation
-        return impl::calcPSpec<Property::Entropy>(pressure, entropy, property, TGuess);
+        return impl::flashPS(pressure, entropy).property(property, accuracy);
     }
 
     /**
@@ -343,13 +519,58 @@ namespace KSteam
      * @param pressure The pressure in Pa.
      * @param internalEnergy The internal energy in J/kg.
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
      */
-    inline FLOAT calcPropertyPU(FLOAT pressure, FLOAT internalEnergy, Property property)
+    inline FLOAT calcPropertyPU(FLOAT pressure, FLOAT internalEnergy, Property property, Accuracy accuracy = Accuracy::Exact)
+    {
+        return impl::flashPU(pressure, internalEnergy).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and enthalpy
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param enthalpy The enthalpy in J/kg.
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPH(FLOAT pressure, FLOAT enthalpy, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::flashPH(pressure, enthalpy).properties(properties, results, accuracy);
+    }
+
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and entropy
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param entropy The entropy in J/(kg·K).
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPS(FLOAT pressure, FLOAT entropy, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
     {
-        // As there is no backward equation for the temperature guess, we let the solver determine the initial guess
-        return impl::calcPSpec<Property::InternalEnergy>(pressure, internalEnergy, property);
+        impl::flashPS(pressure, entropy).properties(properties, results, accuracy);
+    }
+
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and internal energy
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param internalEnergy The internal energy in J/kg.
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPU(FLOAT pressure, FLOAT internalEnergy, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::flashPU(pressure, internalEnergy).properties(properties, results, accuracy);
     }
 
     // =================================================================================================================
@@ -359,7 +580,7 @@ namespace KSteam
     namespace impl
     {
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and density using the
+         * @brief Solves for the state of water/steam at given pressure and density using the
          *        IAPWS-IF97 model.
          *
          *        The pressure/density specification cannot use the generic solver, as the density is not a monotonic
@@ -369,12 +590,11 @@ namespace KSteam
          *
          * @param pressure The pressure in Pa.
          * @param density The density in kg/m³.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
          * @param guess An initial guess for the temperature (optional).
-         * @return The calculated property value.
+         * @return The converged state.
          * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
          */
-        inline FLOAT computeFlashPRHO(FLOAT pressure, FLOAT density, Property property, std::optional<FLOAT> guess = 273.16)
+        inline FlashState computeFlashPRHO(FLOAT pressure, FLOAT density, std::optional<FLOAT> guess = 273.16)
         {
             using namespace nxx::roots;
 
@@ -400,7 +620,7 @@ namespace KSteam
                 throw KSteamError("Pressure out of range", "XLSteamPD", { { "P", pressure }, { "RHO", density } });
 
             // Check if density is in the vicinity of the inflection point
-            if (inflectionTemp > limits.first && density >= (rhoZero - std::sqrt(EPS)) && density <= (rhoMax) && *guess <= inflectionTemp) {
+            if (inflectionTemp > limits.first && density >= (rhoZero - std::sqrt(EPS)) && density <= (rhoMax) && guess.value_or(limits.first) <= inflectionTemp) {
                 // Due to potential rounding errors, we will allow a small deviation from the density at the minimum temperature
                 if (std::abs(rhoZero - density) <= EPS) density = rhoZero;
 
@@ -409,11 +629,11 @@ namespace KSteam
 
                 // Solve the function
                 auto temperature = fsolve<Bisection>(func, { limits.first, inflectionTemp }, EPS);
-                return calcPropertyPT(pressure, checkResult(temperature), property);
+                return FlashState::fromPT(pressure, checkResult(temperature));
             }
 
             // Check if pressure is supercritical, and if so, use the supercritical solver
-            if (pressure > IF97::get_pcrit()) return impl::calcPSpecSupercritical<Property::Density>(pressure, density, property);
+            if (pressure > IF97::get_pcrit()) return impl::calcPSpecSupercritical<Property::Density>(pressure, density);
 
             // Determine the volume of the saturated liquid and saturated vapor
             auto rhoSatLiq = calcPropertyPX(pressure, 0.0, Property::Density);
@@ -428,23 +648,23 @@ namespace KSteam
                 // The upper limit is set to the saturation temperature minus EPS, to ensure that the solver does not
                 // return a temperature that is in the vapor region.
                 auto temperature = fsolve<Bisection>(func, { inflectionTemp, IF97::Tsat97(pressure) - EPS }, EPS);
-                return calcPropertyPT(pressure, checkResult(temperature), property);
+                return FlashState::fromPT(pressure, checkResult(temperature));
             }
 
             // Check if volume is within the saturation curve, and if so, use the saturation solver
             if (density <= rhoSatLiq && density >= rhoSatVap) {
-                return impl::calcPSpecSaturation<Property::Density>(pressure, density, property);
+                return impl::calcPSpecSaturation<Property::Density>(pressure, density);
             }
 
             // Check if we are in the vapor region and if so, use the vapor solver
-            if (density < rhoSatVap) return impl::calcPSpecVapor<Property::Density>(pressure, density, property);
+            if (density < rhoSatVap) return impl::calcPSpecVapor<Property::Density>(pressure, density);
 
             // If we get here, something went wrong
             throw KSteamError("PV flash calculation error", "XLSteamPD", { { "P", pressure }, { "RHO", density } });
         }
 
         /**
-         * @brief Calculates the specified thermodynamic property of water/steam at given pressure and volume using the
+         * @brief Solves for the state of water/steam at given pressure and volume using the
          *        IAPWS-IF97 model.
          *
          *        The pressure/volume specification cannot use the generic solver, as the volume is not a monotonic
@@ -454,12 +674,11 @@ namespace KSteam
          *
          * @param pressure The pressure in Pa.
          * @param volume The volume in m³/kg.
-         * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
          * @param guess An initial guess for the temperature (optional).
-         * @return The calculated property value.
+         * @return The converged state.
          * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
          */
-        inline FLOAT computeFlashPV(FLOAT pressure, FLOAT volume, Property property, std::optional<FLOAT> guess = 273.16)
+        inline FlashState computeFlashPV(FLOAT pressure, FLOAT volume, std::optional<FLOAT> guess = 273.16)
         {
             using namespace nxx::roots;
 
@@ -485,7 +704,7 @@ namespace KSteam
                 throw KSteamError("Pressure out of range", "calcPropertyPV", { { "P", pressure }, { "V", volume } });
 
             // Check if density is in the vicinity of the inflection point
-            if (inflectionTemp > limits.first && volume <= (volZero + std::sqrt(EPS)) && volume >= volMax && *guess <= inflectionTemp) {
+            if (inflectionTemp > limits.first && volume <= (volZero + std::sqrt(EPS)) && volume >= volMax && guess.value_or(limits.first) <= inflectionTemp) {
                 // Due to potential rounding errors, we will allow a small deviation from the volume at the minimum temperature
                 if (std::abs(volume - volZero) <= EPS) volume = volZero;
 
@@ -494,11 +713,11 @@ namespace KSteam
 
                 // Solve the function.
                 auto temperature = fsolve<Bisection>(func, { limits.first, inflectionTemp }, EPS);
-                return calcPropertyPT(pressure, checkResult(temperature), property);
+                return FlashState::fromPT(pressure, checkResult(temperature));
             }
 
             // Check if pressure is supercritical and if so, use the supercritical solver
-            if (pressure > IF97::get_pcrit()) return impl::calcPSpecSupercritical<Property::Volume>(pressure, volume, property);
+            if (pressure > IF97::get_pcrit()) return impl::calcPSpecSupercritical<Property::Volume>(pressure, volume);
 
             // Determine the volume of the saturated liquid and saturated vapor
             auto volSatLiq = calcPropertyPX(pressure, 0.0, Property::Volume);
@@ -512,20 +731,50 @@ namespace KSteam
                 // Solve the function. The upper limit is set to the saturation temperature minus EPS, to ensure that the
                 // solver does not return a temperature that is in the vapor region.
                 auto temperature = fsolve<Bisection>(func, { inflectionTemp, IF97::Tsat97(pressure) - EPS }, EPS);
-                return calcPropertyPT(pressure, checkResult(temperature), property);
+                return FlashState::fromPT(pressure, checkResult(temperature));
             }
 
             // Check if volume is within the saturation curve and if so, use the saturation solver
             if (volume >= volSatLiq && volume <= volSatVap) {
-                return impl::calcPSpecSaturation<Property::Volume>(pressure, volume, property);
+                return impl::calcPSpecSaturation<Property::Volume>(pressure, volume);
             }
 
             // Check if we are in the vapor region and if so, use the vapor solver
-            if (volume > volSatVap) return impl::calcPSpecVapor<Property::Volume>(pressure, volume, property);
+            if (volume > volSatVap) return impl::calcPSpecVapor<Property::Volume>(pressure, volume);
 
             // If we get here, something went wrong
             throw KSteamError("PV flash calculation error", "calcPropertyPV", { { "P", pressure }, { "V", volume } });
         }
+
+        /**
+         * @brief Solves for the state of water/steam at given pressure and density using the IAPWS-IF97 model.
+         * @param pressure The pressure in Pa.
+         * @param density The density in kg/m³.
+         * @param guess An initial guess for the temperature (optional).
+         * @return The converged state.
+         */
+        inline FlashState flashPRHO(FLOAT pressure, FLOAT density, std::optional<FLOAT> guess = std::nullopt)
+        {
+            if (density > 1.0)
+                return computeFlashPRHO(pressure, density, guess);
+            else
+                return computeFlashPV(pressure, 1.0 / density, guess);
+        }
+
+        /**
+         * @brief Solves for the state of water/steam at given pressure and volume using the IAPWS-IF97 model.
+         * @param pressure The pressure in Pa.
+         * @param volume The volume in m³/kg.
+         * @param guess An initial guess for the temperature (optional).
+         * @return The converged state.
+         */
+        inline FlashState flashPV(FLOAT pressure, FLOAT volume, std::optional<FLOAT> guess = std::nullopt)
+        {
+            if (volume > 1.0)
+                return computeFlashPV(pressure, volume, guess);
+            else
+                return computeFlashPRHO(pressure, 1.0 / volume, guess);
+        }
     }    // namespace impl
 
     /**
@@ -535,14 +784,12 @@ namespace KSteam
      * @param density The density in kg/m³.
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
      * @param guess An initial guess for the temperature (default: 273.16 K).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      */
-    inline FLOAT calcPropertyPRHO(FLOAT pressure, FLOAT density, Property property, std::optional<FLOAT> guess = std::nullopt)
+    inline FLOAT calcPropertyPRHO(FLOAT pressure, FLOAT density, Property property, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
     {
-        if (density > 1.0)
-            return impl::computeFlashPRHO(pressure, density, property, guess);
-        else
-            return impl::computeFlashPV(pressure, 1.0 / density, property, guess);
+        return impl::flashPRHO(pressure, density, guess).property(property, accuracy);
     }
 
     /**
@@ -552,14 +799,44 @@ namespace KSteam
      * @param volume The volume in m³/kg.
      * @param property The thermodynamic property to be calculated (as PropertyType enumeration).
      * @param guess An initial guess for the temperature (default: 273.16 K).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      * @return The calculated property value.
      */
-    inline FLOAT calcPropertyPV(FLOAT pressure, FLOAT volume, Property property, std::optional<FLOAT> guess = std::nullopt)
+    inline FLOAT calcPropertyPV(FLOAT pressure, FLOAT volume, Property property, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
+    {
+        return impl::flashPV(pressure, volume, guess).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and density
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param density The density in kg/m³.
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param guess An initial guess for the temperature (default: 273.16 K).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPRHO(FLOAT pressure, FLOAT density, std::span<const Property> properties, std::span<FLOAT> results, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::flashPRHO(pressure, density, guess).properties(properties, results, accuracy);
+    }
+
+    /**
+     * @brief Calculates a set of thermodynamic properties of water/steam at given pressure and volume
+     *        using the IAPWS-IF97 model. The state is solved only once, regardless of the number of properties.
+     * @param pressure The pressure in Pa.
+     * @param volume The volume in m³/kg.
+     * @param properties The thermodynamic properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param guess An initial guess for the temperature (default: 273.16 K).
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     * @throws XLSteamError If input values are out of range or an error occurs during the calculation.
+     */
+    inline void calcPropertiesPV(FLOAT pressure, FLOAT volume, std::span<const Property> properties, std::span<FLOAT> results, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
     {
-        if (volume > 1.0)
-            return impl::computeFlashPV(pressure, volume, property, guess);
-        else
-            return impl::computeFlashPRHO(pressure, 1.0 / volume, property, guess);
+        impl::flashPV(pressure, volume, guess).properties(properties, results, accuracy);
     }
 }    // namespace XLSteam
 
@@ -50,9 +50,31 @@ SOFTWARE.
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <span>
 
 namespace KSteam
 {
+    namespace impl
+    {
+        /**
+         * @brief Checks a temperature and vapor quality specification, and returns the corresponding saturation pressure.
+         * @param temperature The temperature in K.
+         * @param quality The vapor quality.
+         * @param functionName The name of the calling function, used in the error message.
+         * @return The saturation pressure at the temperature, in Pa.
+         * @throws KSteamError If the temperature or the quality is out of range.
+         */
+        inline FLOAT saturationPressureTX(FLOAT temperature, FLOAT quality, const char* functionName)
+        {
+            if (temperature < 273.16 || temperature > IF97::get_Tcrit())
+                throw KSteamError("Temperature out of range", functionName, { { "T", temperature }, { "x", quality } });
+            if (quality < 0.0 || quality > 1.0)
+                throw KSteamError("Quality out of range", functionName, { { "T", temperature }, { "x", quality } });
+
+            return IF97::psat97(temperature);
+        }
+    }    // namespace impl
 
     /**
      * @brief Calculates the property value for a given temperature and quality.
@@ -63,23 +85,37 @@ namespace KSteam
      * @param temperature The temperature value used for the property calculation.
      * @param quality The quality value used for the property calculation.
      * @param property The property for which the value needs to be calculated.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      *
      * @return The calculated property value as a FLOAT type.
      *
-     * @note This function assumes that the temperature and quality values are valid and within the
-     * acceptable range for the specified property. It does not perform any input validation.
-     * Therefore, it is the caller's responsibility to ensure that the input values are valid.
+     * @throws KSteamError If the temperature is outside the saturation range (273.16 K to the critical temperature),
+     * or the quality is outside [0, 1].
      *
      * @see Property
      */
-    inline FLOAT calcPropertyTX(FLOAT temperature, FLOAT quality, Property property)
+    inline FLOAT calcPropertyTX(FLOAT temperature, FLOAT quality, Property property, Accuracy accuracy = Accuracy::Exact)
     {
-        if (temperature < 273.16 || temperature > IF97::get_Tcrit())
-            throw KSteamError("Temperature out of range", "calcPropertyTX", { { "T", temperature }, { "x", quality } });
-        if (quality < 0.0 || quality > 1.0)
-            throw KSteamError("Quality out of range", "calcPropertyTX", { { "T", temperature }, { "x", quality } });
+        return calcPropertyPX(impl::saturationPressureTX(temperature, quality, "calcPropertyTX"), quality, property, accuracy);
+    }
 
-        return calcPropertyPX(IF97::psat97(temperature), quality, property);
+    /**
+     * @brief Calculate a set of property values for a given temperature and quality.
+     *
+     * The state is solved only once, after which all the requested properties are evaluated from it.
+     *
+     * @param temperature The temperature in a Kelvin.
+     * @param quality The quality (mass fraction of vapor phase).
+     * @param properties The properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     *
+     * @throws KSteamError If the temperature is outside the saturation range (273.16 K to the critical temperature),
+     * the quality is outside [0, 1], or the sizes of properties and results do not match.
+     */
+    inline void calcPropertiesTX(FLOAT temperature, FLOAT quality, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::FlashState::fromPX(impl::saturationPressureTX(temperature, quality, "calcPropertiesTX"), quality).properties(properties, results, accuracy);
     }
 
     namespace impl
@@ -183,8 +219,7 @@ namespace KSteam
         }
 
         template<Property::Type OtherType>
-        inline FLOAT
-            calcTSpecSupercritical(FLOAT temperature, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcTSpecSupercritical(FLOAT temperature, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             using namespace nxx::roots;
 
@@ -199,24 +234,18 @@ namespace KSteam
 
             // Solve the function
             auto pressure = fsolve<Bisection>(func, bounds, EPS * EPS);    // TODO: Can the tolerance be improved?
-            return calcPropertyPT((pressure.has_value() ? *pressure : pressure.error().value()), temperature, property);
+            return FlashState::fromPT((pressure.has_value() ? *pressure : pressure.error().value()), temperature);
         }
 
         template<Property::Type OtherType>
-        inline FLOAT calcTSpecSaturation(FLOAT temperature, FLOAT otherSpec, Property property)
+        inline FlashState calcTSpecSaturation(FLOAT temperature, FLOAT otherSpec)
         {
-            using namespace nxx::roots;
-
-            // Define the function to solve.
-            auto func = [&](FLOAT x) { return calcPropertyTX(temperature, x, OtherType) - otherSpec; };
-
-            // Solve the function
-            auto quality = fsolve<Bisection>(func, { 0.0, 1.0 }, EPS);
-            return calcPropertyTX(temperature, *quality, property);
+            // The quality is found directly at the saturation pressure (see calcPSpecSaturation)
+            return calcPSpecSaturation<OtherType>(IF97::psat97(temperature), otherSpec);
         }
 
         template<Property::Type OtherType>
-        inline FLOAT calcTSpecLiquid(FLOAT temperature, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcTSpecLiquid(FLOAT temperature, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             using namespace nxx::roots;
 
@@ -240,11 +269,11 @@ namespace KSteam
 
             // Solve the function
             auto pressure = fsolve<Bisection>(func, bounds, EPS);
-            return calcPropertyPT((pressure.has_value() ? *pressure : pressure.error().value()), temperature, property);
+            return FlashState::fromPT((pressure.has_value() ? *pressure : pressure.error().value()), temperature);
         }
 
         template<Property::Type OtherType>
-        inline FLOAT calcTSpecVapor(FLOAT temperature, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcTSpecVapor(FLOAT temperature, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             using namespace nxx::roots;
 
@@ -259,24 +288,23 @@ namespace KSteam
 
             // Solve the function
             auto pressure = fsolve<Bisection>(func, bounds, EPS);
-            return calcPropertyPT((pressure.has_value() ? *pressure : pressure.error().value()), temperature, property);
+            return FlashState::fromPT((pressure.has_value() ? *pressure : pressure.error().value()), temperature);
         }
 
         /**
          * @brief Calculate the specific temperature.
          *
-         * This function computes the requested property at the given temperature and other specification value.
+         * This function solves for the state at the given temperature and other specification value.
          * The actual computation is delegated to the appropriate function defined above.
          *
          * @param temperature The temperature value used in the calculation.
          * @param otherSpec The other specification value used in the calculation.
-         * @param property The property value to compute
          * @param guess The optional guess value used for optimization. Defaults to std::nullopt.
          *
-         * @return The calculated property.
+         * @return The converged state.
          */
         template<Property::Type OtherType>
-        inline FLOAT calcTSpec(FLOAT temperature, FLOAT otherSpec, Property property, std::optional<FLOAT> guess = std::nullopt)
+        inline FlashState calcTSpec(FLOAT temperature, FLOAT otherSpec, std::optional<FLOAT> guess = std::nullopt)
         {
             // ===== Look up the string representation of the other property
             auto specString = Property(OtherType).asString();
@@ -286,17 +314,24 @@ namespace KSteam
                 throw KSteamError("Temperature out of range", "calcPropertyTV", { { "T", temperature }, { specString, otherSpec } });
 
             // ===== Check if we are in the supercritical region. If so, use the supercritical solver and return.
-            if (temperature > IF97::get_Tcrit()) return calcTSpecSupercritical<OtherType>(temperature, otherSpec, property);
+            if (temperature > IF97::get_Tcrit()) return calcTSpecSupercritical<OtherType>(temperature, otherSpec);
 
             // ===== If not supercritical, continue...
-            auto limits       = PressureLimits(temperature);                   // Determine the lower and upper bounds for the pressure.
-            auto inflPressure = inflictionPressure<OtherType>(temperature);    // Determine the inflection pressure.
+            auto limits = PressureLimits(temperature);    // Determine the lower and upper bounds for the pressure.
 
             // Determine the volume of the saturated liquid and saturated vapor
-            auto propMin    = calcPropertyPT(limits.first, temperature, OtherType);
             auto propVapSat = calcPropertyTX(temperature, 1.0, OtherType);
             auto propLiqSat = calcPropertyTX(temperature, 0.0, OtherType);
 
+            // Values at the saturated liquid or vapor (to within EPS) are on the boundary of all the ranges, and cannot be
+            // bracketed by the single phase solvers, which stop short of the saturation pressure. Return the saturated state
+            // before searching the ranges.
+            if (std::abs(otherSpec - propLiqSat) <= EPS * std::abs(propLiqSat)) return FlashState::fromPX(IF97::psat97(temperature), 0.0);
+            if (std::abs(otherSpec - propVapSat) <= EPS * std::abs(propVapSat)) return FlashState::fromPX(IF97::psat97(temperature), 1.0);
+
+            auto inflPressure = inflictionPressure<OtherType>(temperature);    // Determine the inflection pressure.
+            auto propMin      = calcPropertyPT(limits.first, temperature, OtherType);
+
             std::array<FLOAT, 3> liqVal { propLiqSat,
                                           calcPropertyPT(limits.second, temperature, OtherType),
                                           (inflPressure ? calcPropertyPT(inflPressure.value(), temperature, OtherType) : propLiqSat) };
@@ -341,11 +376,11 @@ namespace KSteam
                 auto obj = [temperature](FLOAT p) { return p > IF97::psat97(temperature) ? calcPropertyPT(p, temperature, OtherType) : calcPropertyTX(temperature, 0.0, OtherType); };
                 auto sat = obj(IF97::psat97(temperature));
                 auto lim = obj(limits.second);
-                auto min = nxx::optim::fminimize<nxx::optim::Brent>(obj, { IF97::psat97(temperature), limits.second });
-                auto max = nxx::optim::fmaximize<nxx::optim::Brent>(obj, { IF97::psat97(temperature), limits.second });
+                auto min = obj(nxx::optim::fminimize<nxx::optim::Brent>(obj, { IF97::psat97(temperature), limits.second }));
+                auto max = obj(nxx::optim::fmaximize<nxx::optim::Brent>(obj, { IF97::psat97(temperature), limits.second }));
                 std::array<FLOAT, 4> results {sat, lim, min, max};
                 std::sort(results.begin(), results.end());
-                return std::array<FLOAT, 2> { results[0], results[1] };
+                return std::array<FLOAT, 2> { results.front(), results.back() };
             };
 
             auto getSatRange = [temperature] {
@@ -374,18 +409,50 @@ namespace KSteam
                 auto isVapor  = [&] { return isInRange(rangeVap, otherSpec) && guess.value() < IF97::psat97(temperature); };
                 auto isLiquid = [&] { return isInRange(rangeLiq, otherSpec, 0.005) && guess.value() > IF97::psat97(temperature); };
 
-                if (isVapor()) return calcTSpecVapor<OtherType>(temperature, otherSpec, property);
-                if (isLiquid()) return calcTSpecLiquid<OtherType>(temperature, otherSpec, property, guess);
-                return calcTSpecSaturation<OtherType>(temperature, otherSpec, property);
+                if (isVapor()) return calcTSpecVapor<OtherType>(temperature, otherSpec);
+                if (isLiquid()) return calcTSpecLiquid<OtherType>(temperature, otherSpec, guess);
+                return calcTSpecSaturation<OtherType>(temperature, otherSpec);
             }
             else {    // Check if we are in the saturation region
-                if (isInRange(rangeVap, otherSpec)) return calcTSpecVapor<OtherType>(temperature, otherSpec, property);
-                if (isInRange(rangeLiq, otherSpec, 0.005)) return calcTSpecLiquid<OtherType>(temperature, otherSpec, property);
-                return calcTSpecSaturation<OtherType>(temperature, otherSpec, property);
+                if (isInRange(rangeVap, otherSpec)) return calcTSpecVapor<OtherType>(temperature, otherSpec);
+                if (isInRange(rangeLiq, otherSpec, 0.005)) return calcTSpecLiquid<OtherType>(temperature, otherSpec);
+                return calcTSpecSaturation<OtherType>(temperature, otherSpec);
             }
             // If we get here, something went wrong
             throw KSteamError("TV flash calculation error", "calcPropertyTV", { { "T", temperature }, { specString, otherSpec } });
         }
+
+        /**
+         * @brief Solve for the state at a given temperature and density.
+         *
+         * @param temperature The temperature in a Kelvin.
+         * @param density The density of the substance in kg/m^3.
+         *
+         * @return The converged state.
+         */
+        inline FlashState flashTRHO(FLOAT temperature, FLOAT density)
+        {
+            if (density > 1.0)
+                return calcTSpec<Property::Density>(temperature, density);
+            else
+                return calcTSpec<Property::Volume>(temperature, 1.0 / density);
+        }
+
+        /**
+         * @brief Solve for the state at a given temperature and volume.
+         *
+         * @param temperature The temperature in a Kelvin.
+         * @param volume The volume of the substance in m^3/kg.
+         *
+         * @return The converged state.
+         */
+        inline FlashState flashTV(FLOAT temperature, FLOAT volume)
+        {
+            if (volume > 1.0)
+                return calcTSpec<Property::Volume>(temperature, volume);
+            else
+                return calcTSpec<Property::Density>(temperature, 1.0 / volume);
+        }
     }    // namespace impl
 
     /**
@@ -398,6 +465,7 @@ namespace KSteam
      * @param temperature The temperature in a Kelvin.
      * @param density The density of the substance in kg/m^3.
      * @param property The property to be calculated.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      *
      * @return The calculated value of the specified property.
      *
@@ -406,12 +474,25 @@ namespace KSteam
      * @warning This function does not check for valid input range of the inputs.
      *          It is the responsibility of the caller to ensure inputs are within valid range.
      */
-    inline FLOAT calcPropertyTRHO(FLOAT temperature, FLOAT density, Property property)
+    inline FLOAT calcPropertyTRHO(FLOAT temperature, FLOAT density, Property property, Accuracy accuracy = Accuracy::Exact)
     {
-        if (density > 1.0)
-            return impl::calcTSpec<Property::Density>(temperature, density, property);
-        else
-            return impl::calcTSpec<Property::Volume>(temperature, 1.0 / density, property);
+        return impl::flashTRHO(temperature, density).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculate a set of property values for a given temperature and density.
+     *
+     * The state is solved only once, after which all the requested properties are evaluated from it.
+     *
+     * @param temperature The temperature in a Kelvin.
+     * @param density The density of the substance in kg/m^3.
+     * @param properties The properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     */
+    inline void calcPropertiesTRHO(FLOAT temperature, FLOAT density, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::flashTRHO(temperature, density).properties(properties, results, accuracy);
     }
 
     /**
@@ -424,6 +505,7 @@ namespace KSteam
      * @param temperature The temperature in a Kelvin.
      * @param volume The volume of the substance in m^3/kg.
      * @param property The property to be calculated.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      *
      * @return The calculated value of the specified property.
      *
@@ -432,12 +514,25 @@ namespace KSteam
      * @warning This function does not check for valid input range of the inputs.
      *          It is the responsibility of the caller to ensure inputs are within valid range.
      */
-    inline FLOAT calcPropertyTV(FLOAT temperature, FLOAT volume, Property property)
+    inline FLOAT calcPropertyTV(FLOAT temperature, FLOAT volume, Property property, Accuracy accuracy = Accuracy::Exact)
+    {
+        return impl::flashTV(temperature, volume).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculate a set of property values for a given temperature and volume.
+     *
+     * The state is solved only once, after which all the requested properties are evaluated from it.
+     *
+     * @param temperature The temperature in a Kelvin.
+     * @param volume The volume of the substance in m^3/kg.
+     * @param properties The properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     */
+    inline void calcPropertiesTV(FLOAT temperature, FLOAT volume, std::span<const Property> properties, std::span<FLOAT> results, Accuracy accuracy = Accuracy::Exact)
     {
-        if (volume > 1.0)
-            return impl::calcTSpec<Property::Volume>(temperature, volume, property);
-        else
-            return impl::calcTSpec<Property::Density>(temperature, 1.0 / volume, property);
+        impl::flashTV(temperature, volume).properties(properties, results, accuracy);
     }
 
     /**
@@ -451,6 +546,7 @@ namespace KSteam
      * @param enthalpy The enthalpy of the substance in J/kg.
      * @param property The property to be calculated.
      * @param guess An optional guess value for the pressure. If not provided, the solver will use a default guess.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      *
      * @return The calculated value of the specified property.
      *
@@ -459,9 +555,26 @@ namespace KSteam
      * @warning This function does not check for valid input range of the inputs.
      *          It is the responsibility of the caller to ensure inputs are within valid range.
      */
-    inline FLOAT calcPropertyTH(FLOAT temperature, FLOAT enthalpy, Property property, std::optional<FLOAT> guess = std::nullopt)
+    inline FLOAT calcPropertyTH(FLOAT temperature, FLOAT enthalpy, Property property, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
     {
-        return impl::calcTSpec<Property::Enthalpy>(temperature, enthalpy, property, guess);
+        return impl::calcTSpec<Property::Enthalpy>(temperature, enthalpy, guess).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculate a set of property values for a given temperature and enthalpy.
+     *
+     * The state is solved only once, after which all the requested properties are evaluated from it.
+     *
+     * @param temperature The temperature in a Kelvin.
+     * @param enthalpy The enthalpy of the substance in J/kg.
+     * @param properties The properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param guess An optional guess value for the pressure. If not provided, the solver will use a default guess.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     */
+    inline void calcPropertiesTH(FLOAT temperature, FLOAT enthalpy, std::span<const Property> properties, std::span<FLOAT> results, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
+    {
+        impl::calcTSpec<Property::Enthalpy>(temperature, enthalpy, guess).properties(properties, results, accuracy);
     }
 
     /**
@@ -475,6 +588,7 @@ namespace KSteam
      * @param entropy The entropy of the substance in J/kg-K.
      * @param property The property to be calculated.
      * @param guess An optional guess value for the pressure. If not provided, the solver will use a default guess.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      *
      * @return The calculated value of the specified property.
      *
@@ -483,9 +597,26 @@ namespace KSteam
      * @warning This function does not check for valid input range of the inputs.
      *          It is the responsibility of the caller to ensure inputs are within valid range.
      */
-    inline FLOAT calcPropertyTS(FLOAT temperature, FLOAT entropy, Property property, std::optional<FLOAT> guess = std::nullopt)
+    inline FLOAT calcPropertyTS(FLOAT temperature, FLOAT entropy, Property property, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
+    {
+        return impl::calcTSpec<Property::Entropy>(temperature, entropy, guess).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculate a set of property values for a given temperature and entropy.
+     *
+     * The state is solved only once, after which all the requested properties are evaluated from it.
+     *
+     * @param temperature The temperature in a Kelvin.
+     * @param entropy The entropy of the substance in J/kg-K.
+     * @param properties The properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param guess An optional guess value for the pressure. If not provided, the solver will use a default guess.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     */
+    inline void calcPropertiesTS(FLOAT temperature, FLOAT entropy, std::span<const Property> properties, std::span<FLOAT> results, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
     {
-        return impl::calcTSpec<Property::Entropy>(temperature, entropy, property, guess);
+        impl::calcTSpec<Property::Entropy>(temperature, entropy, guess).properties(properties, results, accuracy);
     }
 
     /**
@@ -499,6 +630,7 @@ namespace KSteam
      * @param internalEnergy The internal energy of the substance in J/kg.
      * @param property The property to be calculated.
      * @param guess An optional guess value for the pressure. If not provided, the solver will use a default guess.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
      *
      * @return The calculated value of the specified property.
      *
@@ -507,9 +639,26 @@ namespace KSteam
      * @warning This function does not check for valid input range of the inputs.
      *          It is the responsibility of the caller to ensure inputs are within valid range.
      */
-    inline FLOAT calcPropertyTU(FLOAT temperature, FLOAT internalEnergy, Property property, std::optional<FLOAT> guess = std::nullopt)
+    inline FLOAT calcPropertyTU(FLOAT temperature, FLOAT internalEnergy, Property property, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
+    {
+        return impl::calcTSpec<Property::InternalEnergy>(temperature, internalEnergy, guess).property(property, accuracy);
+    }
+
+    /**
+     * @brief Calculate a set of property values for a given temperature and internal energy.
+     *
+     * The state is solved only once, after which all the requested properties are evaluated from it.
+     *
+     * @param temperature The temperature in a Kelvin.
+     * @param internalEnergy The internal energy of the substance in J/kg.
+     * @param properties The properties to be calculated.
+     * @param results The calculated property values, in the same order as the properties.
+     * @param guess An optional guess value for the pressure. If not provided, the solver will use a default guess.
+     * @param accuracy The accuracy policy (default: Accuracy::Exact).
+     */
+    inline void calcPropertiesTU(FLOAT temperature, FLOAT internalEnergy, std::span<const Property> properties, std::span<FLOAT> results, std::optional<FLOAT> guess = std::nullopt, Accuracy accuracy = Accuracy::Exact)
     {
-        return impl::calcTSpec<Property::InternalEnergy>(temperature, internalEnergy, property, guess);
+        impl::calcTSpec<Property::InternalEnergy>(temperature, internalEnergy, guess).properties(properties, results, accuracy);
     }
 }    // namespace KSteam
 
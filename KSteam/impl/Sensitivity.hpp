@@ -0,0 +1,555 @@
+/*
+KKKKKKKKK    KKKKKKK   SSSSSSSSSSSSSSS      tttt
+K:::::::K    K:::::K SS:::::::::::::::S  ttt:::t
+K:::::::K    K:::::KS:::::SSSSSS::::::S  t:::::t
+K:::::::K   K::::::KS:::::S     SSSSSSS  t:::::t
+KK::::::K  K:::::KKKS:::::S        ttttttt:::::ttttttt        eeeeeeeeeeee    aaaaaaaaaaaaa      mmmmmmm    mmmmmmm
+  K:::::K K:::::K   S:::::S        t:::::::::::::::::t      ee::::::::::::ee  a::::::::::::a   mm:::::::m  m:::::::mm
+  K::::::K:::::K     S::::SSSS     t:::::::::::::::::t     e::::::eeeee:::::eeaaaaaaaaa:::::a m::::::::::mm::::::::::m
+  K:::::::::::K       SS::::::SSSSStttttt:::::::tttttt    e::::::e     e:::::e         a::::a m::::::::::::::::::::::m
+  K:::::::::::K         SSS::::::::SS    t:::::t          e:::::::eeeee::::::e  aaaaaaa:::::a m:::::mmm::::::mmm:::::m
+  K::::::K:::::K           SSSSSS::::S   t:::::t          e:::::::::::::::::e aa::::::::::::a m::::m   m::::m   m::::m
+  K:::::K K:::::K               S:::::S  t:::::t          e::::::eeeeeeeeeee a::::aaaa::::::a m::::m   m::::m   m::::m
+KK::::::K  K:::::KKK            S:::::S  t:::::t    tttttte:::::::e         a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K   K::::::KSSSSSSS     S:::::S  t::::::tttt:::::te::::::::e        a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS::::::SSSSSS:::::S  tt::::::::::::::t e::::::::eeeeeeeea:::::aaaa::::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS:::::::::::::::SS     tt:::::::::::tt  ee:::::::::::::e a::::::::::aa:::am::::m   m::::m   m::::m
+KKKKKKKKK    KKKKKKK SSSSSSSSSSSSSSS         ttttttttttt      eeeeeeeeeeeeee  aaaaaaaaaa  aaaammmmmm   mmmmmm   mmmmmm
+
+MIT License
+
+Copyright (c) 2023 Kenneth Troldal Balslev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef KSTEAM_SENSITIVITY_HPP
+#define KSTEAM_SENSITIVITY_HPP
+
+#include "Common.hpp"
+#include "Config.hpp"
+#include "Error.hpp"
+#include "FlashPSpec.hpp"
+#include "FlashTSpec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace KSteam
+{
+    namespace impl
+    {
+
+        /**
+         * @brief The relative step used for first order finite differences in the state variables.
+         */
+        constexpr FLOAT SENSITIVITY_STEP = 6.0E-6;
+
+        /**
+         * @brief The relative step used for second order finite differences in the state variables.
+         */
+        constexpr FLOAT HESSIAN_STEP = 1.0E-4;
+
+        /**
+         * @brief Solves for the state of water/steam given any supported pair of specifications.
+         *
+         * The specifications may be given in any order. Supported pairs are pressure or temperature combined with
+         * temperature, enthalpy, entropy, internal energy, density, volume or vapor quality.
+         *
+         * @param spec1 The first specified property.
+         * @param value1 The value of the first specified property.
+         * @param spec2 The second specified property.
+         * @param value2 The value of the second specified property.
+         * @return The converged state.
+         * @throws KSteamError If the specification is not supported or the flash calculation fails.
+         */
+        inline FlashState flash(Property spec1, FLOAT value1, Property spec2, FLOAT value2)
+        {
+            // Make sure that pressure, or otherwise temperature, is the first specification
+            if (spec2.type() == Property::Pressure || (spec2.type() == Property::Temperature && spec1.type() != Property::Pressure)) {
+                std::swap(spec1, spec2);
+                std::swap(value1, value2);
+            }
+
+            if (spec1.type() == Property::Pressure) {
+                switch (spec2.type()) {
+                    case Property::Temperature:
+                        return FlashState::fromPT(value1, value2);
+                    case Property::Enthalpy:
+                        return flashPH(value1, value2);
+                    case Property::Entropy:
+                        return flashPS(value1, value2);
+                    case Property::InternalEnergy:
+                        return flashPU(value1, value2);
+                    case Property::Density:
+                        return flashPRHO(value1, value2);
+                    case Property::Volume:
+                        return flashPV(value1, value2);
+                    case Property::VaporQuality:
+                        return FlashState::fromPX(value1, value2);
+                    default:
+                        break;
+                }
+            }
+
+            if (spec1.type() == Property::Temperature) {
+                switch (spec2.type()) {
+                    case Property::Enthalpy:
+                        return calcTSpec<Property::Enthalpy>(value1, value2);
+                    case Property::Entropy:
+                        return calcTSpec<Property::Entropy>(value1, value2);
+                    case Property::InternalEnergy:
+                        return calcTSpec<Property::InternalEnergy>(value1, value2);
+                    case Property::Density:
+                        return flashTRHO(value1, value2);
+                    case Property::Volume:
+                        return flashTV(value1, value2);
+                    case Property::VaporQuality:
+                        return FlashState::fromPX(saturationPressureTX(value1, value2, "flash"), value2);
+                    default:
+                        break;
+                }
+            }
+
+            throw KSteamError("Unsupported specification", "flash", { { spec1.asString(), value1 }, { spec2.asString(), value2 } });
+        }
+
+        /**
+         * @brief Identifies the smooth patch of the equation of state that a state belongs to.
+         *
+         * The IAPWS-IF97 model is only piecewise smooth; properties jump slightly across region boundaries and
+         * discontinuously across the saturation curve. Finite differences are only meaningful when all points of the
+         * stencil belong to the same patch.
+         *
+         * @param state The state to classify.
+         * @return An identifier of the patch, or -1 if the state is outside the valid range.
+         */
+        inline int stateRegion(const FlashState& state)
+        {
+            auto pressure = state.pressure();
+
+            if (state.type() == FlashState::PX) {
+                if (pressure <= 0.0 || pressure > IF97::get_pcrit() || state.other() < 0.0 || state.other() > 1.0) return -1;
+                return 0;
+            }
+
+            auto temperature = state.other();
+            if (temperature < 273.16 || temperature > 2273.15 || pressure < 0.0 || pressure > 100000000.0) return -1;
+            if (temperature > 1073.15 && pressure > 50000000.0) return -1;
+
+            try {
+                auto region = static_cast<int>(IF97::RegionDetermination_TP(temperature, pressure));
+                auto side   = (temperature > IF97::get_Tcrit() ? 0 : (pressure > IF97::psat97(temperature) ? 1 : 2));
+                return 1 + region * 3 + side;
+            }
+            catch (const std::out_of_range&) {
+                return -1;
+            }
+        }
+
+        /**
+         * @brief Creates a copy of a state with one of the state variables shifted.
+         * @param state The original state.
+         * @param axis The state variable to shift (0 for pressure, 1 for temperature or vapor quality).
+         * @param delta The shift to apply.
+         * @return The shifted state.
+         */
+        inline FlashState shiftState(const FlashState& state, size_t axis, FLOAT delta)
+        {
+            auto pressure = state.pressure() + (axis == 0 ? delta : 0.0);
+            auto other    = state.other() + (axis == 1 ? delta : 0.0);
+            return state.type() == FlashState::PT ? FlashState::fromPT(pressure, other) : FlashState::fromPX(pressure, other);
+        }
+
+        /**
+         * @brief Computes the partial derivative of a vector-valued function of the state along one state variable.
+         *
+         * A central difference is used when both neighbours belong to the same region as the state; otherwise a
+         * second order one-sided difference is taken on the side that stays within the region.
+         *
+         * @param state The state at which to differentiate.
+         * @param axis The state variable to differentiate with respect to (0 for pressure, 1 for the other variable).
+         * @param relStep The step size, relative to the state variable (absolute for the vapor quality).
+         * @param func The function to differentiate, taking a FlashState and returning a std::vector<FLOAT>.
+         * @return The partial derivatives of each element of the function.
+         * @throws KSteamError If no valid stencil can be found.
+         */
+        template<typename FN>
+        inline std::vector<FLOAT> partialDerivative(const FlashState& state, size_t axis, FLOAT relStep, FN func)
+        {
+            auto value  = (axis == 0 ? state.pressure() : state.other());
+            auto step   = (axis == 1 && state.type() == FlashState::PX) ? relStep : relStep * std::max(std::abs(value), 1.0);
+            auto region = stateRegion(state);
+
+            auto sameRegion = [&](FLOAT delta) { return stateRegion(shiftState(state, axis, delta)) == region; };
+            auto combine    = [&](std::vector<FLOAT> a, const std::vector<FLOAT>& b, FLOAT ca, FLOAT cb) {
+                for (size_t i = 0; i < a.size(); ++i) a[i] = (ca * a[i] + cb * b[i]) / (2.0 * step);
+                return a;
+            };
+
+            // Central difference
+            if (sameRegion(step) && sameRegion(-step)) return combine(func(shiftState(state, axis, step)), func(shiftState(state, axis, -step)), 1.0, -1.0);
+
+            // One-sided differences (second order)
+            for (auto dir : { 1.0, -1.0 }) {
+                if (!sameRegion(dir * step) || !sameRegion(2.0 * dir * step)) continue;
+                auto result = func(state);
+                auto first  = func(shiftState(state, axis, dir * step));
+                auto second = func(shiftState(state, axis, 2.0 * dir * step));
+                for (size_t i = 0; i < result.size(); ++i) result[i] = dir * (-3.0 * result[i] + 4.0 * first[i] - second[i]) / (2.0 * step);
+                return result;
+            }
+
+            throw KSteamError("Unable to compute sensitivities", "partialDerivative", { { "P", state.pressure() }, { "Other", state.other() } });
+        }
+
+        /**
+         * @brief The derivatives of the basic properties with respect to the state variables, (P, T) for single phase
+         *        states or (P, x) for saturated states. Each derivative is stored as [d/dP, d/dT] or [d/dP, d/dx].
+         */
+        struct StatePartials
+        {
+            FLOAT                pressure;     /*< The pressure of the state. */
+            FLOAT                volume;       /*< The specific volume of the state. */
+            std::array<FLOAT, 2> dTemperature; /*< The derivatives of the temperature. */
+            std::array<FLOAT, 2> dVolume;      /*< The derivatives of the specific volume. */
+            std::array<FLOAT, 2> dEnthalpy;    /*< The derivatives of the specific enthalpy. */
+            std::array<FLOAT, 2> dEntropy;     /*< The derivatives of the specific entropy. */
+        };
+
+        /**
+         * @brief Gives access to the derivatives of the dimensionless Gibbs free energy of IAPWS-IF97 region 1, 2 or 5.
+         *
+         * With pi = P / P* and tau = T* / T, the specific volume is v = R * T * gamma_pi / P*, and
+         *     dv/dP = R * T * gamma_pipi / P*^2,
+         *     dv/dT = R * (gamma_pi - tau * gamma_pitau) / P*,
+         *     dh/dP = v - T * dv/dT,  dh/dT = cp,
+         *     ds/dP = -dv/dT,         ds/dT = cp / T.
+         *
+         * @tparam REGION The IF97 region class.
+         */
+        template<typename REGION>
+        class GibbsRegion : public REGION
+        {
+        public:
+            /**
+             * @brief Computes the derivatives of the basic properties at the given temperature and pressure.
+             * @param temperature The temperature in K.
+             * @param pressure The pressure in Pa.
+             * @return The derivatives with respect to pressure and temperature.
+             */
+            [[nodiscard]] StatePartials partials(FLOAT temperature, FLOAT pressure) const
+            {
+                const auto tau    = this->T_star / temperature;
+                const auto gPi    = this->dgamma0_dPI(temperature, pressure) + this->dgammar_dPI(temperature, pressure);
+                const auto gPiPi  = this->d2gamma0_dPI2(temperature, pressure) + this->d2gammar_dPI2(temperature, pressure);
+                const auto gPiTau = this->d2gammar_dPIdTAU(temperature, pressure);
+                const auto cp     = this->cpmass(temperature, pressure);
+                const auto volume = this->R * temperature * gPi / this->p_star;
+                const auto dVdP   = this->R * temperature * gPiPi / (this->p_star * this->p_star);
+                const auto dVdT   = this->R * (gPi - tau * gPiTau) / this->p_star;
+
+                return { pressure, volume, { 0.0, 1.0 }, { dVdP, dVdT }, { volume - temperature * dVdT, cp }, { -dVdT, cp / temperature } };
+            }
+        };
+
+        /**
+         * @brief Computes the derivative of the saturation temperature with respect to pressure.
+         *
+         * The derivative is found by implicit differentiation of the IF97 region 4 saturation equation,
+         * beta^2 * theta^2 + n1 * beta^2 * theta + n2 * beta^2 + n3 * beta * theta^2 + n4 * beta * theta + n5 * beta
+         * + n6 * theta^2 + n7 * theta + n8 = 0, with beta = (P/P*)^(1/4) and theta = T + n9 / (T - n10), so it is
+         * consistent with IF97::Tsat97 and IF97::psat97.
+         *
+         * @param pressure The saturation pressure in Pa.
+         * @return The derivative dTsat/dP in K/Pa.
+         */
+        inline FLOAT saturationSlope(FLOAT pressure)
+        {
+            static const IF97::Region4 region;
+            const auto& n = region.n;
+
+            const auto temperature = IF97::Tsat97(pressure);
+            const auto beta        = std::pow(pressure / region.p_star, 0.25);
+            const auto theta       = temperature + n[9] / (temperature - n[10]);
+
+            const auto dBeta  = 2.0 * beta * (theta * theta + n[1] * theta + n[2]) + (n[3] * theta * theta + n[4] * theta + n[5]);
+            const auto dTheta = beta * beta * (2.0 * theta + n[1]) + beta * (2.0 * n[3] * theta + n[4]) + 2.0 * n[6] * theta + n[7];
+
+            return -(dBeta * beta / (4.0 * pressure)) / (dTheta * (1.0 - n[9] / ((temperature - n[10]) * (temperature - n[10]))));
+        }
+
+        /**
+         * @brief Computes the derivatives of the basic properties at a state from the closed form expressions of
+         *        IAPWS-IF97.
+         *
+         * Single phase states in regions 1, 2 and 5 are differentiated through the Gibbs free energy of the region.
+         * Saturated states are mixtures of saturated liquid (region 1) and vapor (region 2), so the properties are
+         * linear in the quality, and the derivatives of each phase along the saturation curve are
+         * dy/dP = (dy/dP)_T + (dy/dT)_P * dTsat/dP.
+         *
+         * @param state The converged state.
+         * @return The derivatives, or std::nullopt if the state is in region 3, where the properties are evaluated
+         *         through the backward equations for the specific volume and have no closed form derivatives.
+         */
+        inline std::optional<StatePartials> gibbsPartials(const FlashState& state)
+        {
+            static const GibbsRegion<IF97::Region1> region1;
+            static const GibbsRegion<IF97::Region2> region2;
+            static const GibbsRegion<IF97::Region5> region5;
+
+            auto pressure = state.pressure();
+
+            // States outside the valid range are left to the finite differences, which report the error
+            if (stateRegion(state) < 0) return std::nullopt;
+
+            if (state.type() == FlashState::PT) {
+                auto temperature = state.other();
+                switch (IF97::RegionDetermination_TP(temperature, pressure)) {
+                    case IF97::REGION_1:
+                        return region1.partials(temperature, pressure);
+                    case IF97::REGION_2:
+                        return region2.partials(temperature, pressure);
+                    case IF97::REGION_5:
+                        return region5.partials(temperature, pressure);
+                    default:
+                        return std::nullopt;
+                }
+            }
+
+            // Above 623.15 K, the saturated liquid and vapor are evaluated in region 3
+            auto temperature = IF97::Tsat97(pressure);
+            if (IF97::RegionDetermination_TP(temperature, pressure) == IF97::REGION_3) return std::nullopt;
+
+            auto quality = state.other();
+            auto slope   = saturationSlope(pressure);
+            auto liquid  = region1.partials(temperature, pressure);
+            auto vapor   = region2.partials(temperature, pressure);
+
+            auto saturated = [&](const std::array<FLOAT, 2>& liq, const std::array<FLOAT, 2>& vap, FLOAT yLiq, FLOAT yVap) {
+                auto dLiq = liq[0] + liq[1] * slope;
+                auto dVap = vap[0] + vap[1] * slope;
+                return std::array<FLOAT, 2> { dLiq + quality * (dVap - dLiq), yVap - yLiq };
+            };
+
+            return StatePartials { pressure,
+                                   liquid.volume + quality * (vapor.volume - liquid.volume),
+                                   { slope, 0.0 },
+                                   saturated(liquid.dVolume, vapor.dVolume, liquid.volume, vapor.volume),
+                                   saturated(liquid.dEnthalpy, vapor.dEnthalpy, region1.hmass(temperature, pressure), region2.hmass(temperature, pressure)),
+                                   saturated(liquid.dEntropy, vapor.dEntropy, region1.smass(temperature, pressure), region2.smass(temperature, pressure)) };
+        }
+
+        /**
+         * @brief Selects the derivatives of a property from the derivatives of the basic properties.
+         * @param partials The derivatives of the basic properties at the state.
+         * @param property The property to differentiate.
+         * @param saturated Whether the state is given by pressure and quality.
+         * @return The derivatives, or std::nullopt if the property is not one of the basic properties.
+         */
+        inline std::optional<std::array<FLOAT, 2>> basicDerivative(const StatePartials& partials, Property property, bool saturated)
+        {
+            const auto& dV = partials.dVolume;
+            auto        rho2 = 1.0 / (partials.volume * partials.volume);
+
+            switch (property.type()) {
+                case Property::Pressure:
+                    return std::array<FLOAT, 2> { 1.0, 0.0 };
+                case Property::Temperature:
+                    return partials.dTemperature;
+                case Property::Volume:
+                    return dV;
+                case Property::Density:
+                    return std::array<FLOAT, 2> { -rho2 * dV[0], -rho2 * dV[1] };
+                case Property::Enthalpy:
+                    return partials.dEnthalpy;
+                case Property::Entropy:
+                    return partials.dEntropy;
+                case Property::InternalEnergy:
+                    // u = h - P * v
+                    return std::array<FLOAT, 2> { partials.dEnthalpy[0] - partials.volume - partials.pressure * dV[0],
+                                                  partials.dEnthalpy[1] - partials.pressure * dV[1] };
+                case Property::VaporQuality:
+                    if (saturated) return std::array<FLOAT, 2> { 0.0, 1.0 };
+                    return std::nullopt;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        /**
+         * @brief Computes the derivatives of a set of properties with respect to the state variables.
+         *
+         * The basic properties (pressure, temperature, density, volume, enthalpy, entropy, internal energy and, for
+         * saturated states, the quality) are differentiated analytically where IF97 gives a closed form (see
+         * gibbsPartials). All other properties, and all properties in region 3, use finite differences (see
+         * partialDerivative).
+         *
+         * @param state The converged state.
+         * @param properties The properties to differentiate.
+         * @param relStep The relative finite difference step.
+         * @return The derivatives with respect to pressure, and with respect to the other state variable.
+         */
+        inline std::pair<std::vector<FLOAT>, std::vector<FLOAT>>
+            stateDerivatives(const FlashState& state, std::span<const Property> properties, FLOAT relStep)
+        {
+            std::vector<FLOAT>  dz0(properties.size());
+            std::vector<FLOAT>  dz1(properties.size());
+            std::vector<size_t> numeric;
+
+            auto partials = gibbsPartials(state);
+            for (size_t i = 0; i < properties.size(); ++i) {
+                auto derivative = partials ? basicDerivative(*partials, properties[i], state.type() == FlashState::PX) : std::nullopt;
+                if (!derivative) {
+                    numeric.push_back(i);
+                    continue;
+                }
+                dz0[i] = (*derivative)[0];
+                dz1[i] = (*derivative)[1];
+            }
+
+            if (numeric.empty()) return { dz0, dz1 };
+
+            auto evaluate = [&](const FlashState& s) {
+                std::vector<FLOAT> values;
+                values.reserve(numeric.size());
+                for (auto i : numeric) values.push_back(s.property(properties[i]));
+                return values;
+            };
+
+            auto num0 = partialDerivative(state, 0, relStep, evaluate);
+            auto num1 = partialDerivative(state, 1, relStep, evaluate);
+            for (size_t k = 0; k < numeric.size(); ++k) {
+                dz0[numeric[k]] = num0[k];
+                dz1[numeric[k]] = num1[k];
+            }
+
+            return { dz0, dz1 };
+        }
+
+        /**
+         * @brief Computes the gradients of a set of properties with respect to the specifications.
+         *
+         * The flash calculation defines the state variables z implicitly through the specifications s(z). By the
+         * implicit function theorem, the gradient of a property y(z) with respect to the specifications is
+         * dy/ds = (dy/dz) * (ds/dz)^-1, so only derivatives of explicit functions of the state are required and no
+         * additional flash calculations are performed.
+         *
+         * @note The derivatives dy/dz and ds/dz are analytic for the basic properties (pressure, temperature, density,
+         * volume, enthalpy, entropy, internal energy and quality) in regions 1, 2 and 5 and for saturated states up to
+         * 623.15 K, where they follow from the Gibbs free energy of IF97 and the saturation equation (see
+         * gibbsPartials). Other properties, e.g. the transport properties, and all properties in region 3, where KSteam
+         * evaluates the properties from (P, T) through the backward equations for the specific volume, use central (or,
+         * close to a boundary, second order one-sided) finite differences of the explicit functions of (P, T) or (P, x)
+         * at the converged state. Their relative error is about 1E-8 outside region 3; in region 3 it is about 1E-4,
+         * rising to about 1E-3 next to the boundaries of the region. The finite difference stencil is kept within the
+         * region and phase of the state, so at a region boundary or on the saturation line, the result is the
+         * one-sided derivative from the side of the state, as for the analytic derivatives; the derivative on the
+         * other side of the boundary may differ, or be undefined.
+         *
+         * @param state The converged state.
+         * @param spec1 The first specified property.
+         * @param spec2 The second specified property.
+         * @param properties The properties to differentiate.
+         * @param relStep The relative finite difference step, where finite differences are used.
+         * @return The gradients, stored as [dy0/ds1, dy0/ds2, dy1/ds1, dy1/ds2, ...].
+         * @throws KSteamError If the specification is singular at the state.
+         */
+        inline std::vector<FLOAT> specificationGradients(const FlashState&         state,
+                                                         Property                  spec1,
+                                                         Property                  spec2,
+                                                         std::span<const Property> properties,
+                                                         FLOAT                     relStep = SENSITIVITY_STEP)
+        {
+            std::vector<Property> all { spec1, spec2 };
+            all.insert(all.end(), properties.begin(), properties.end());
+            auto [dz0, dz1] = stateDerivatives(state, all, relStep);
+
+            // Invert the Jacobian of the specifications with respect to the state variables
+            auto det = dz0[0] * dz1[1] - dz1[0] * dz0[1];
+            if (det == 0.0 || !std::isfinite(det))
+                throw KSteamError("Singular specification", "specificationGradients", { { spec1.asString(), state.property(spec1) }, { spec2.asString(), state.property(spec2) } });
+
+            std::array<std::array<FLOAT, 2>, 2> jac { { { dz1[1] / det, -dz1[0] / det }, { -dz0[1] / det, dz0[0] / det } } };
+
+            std::vector<FLOAT> gradients(properties.size() * 2);
+            for (size_t i = 0; i < properties.size(); ++i) {
+                gradients[i * 2]     = dz0[i + 2] * jac[0][0] + dz1[i + 2] * jac[1][0];
+                gradients[i * 2 + 1] = dz0[i + 2] * jac[0][1] + dz1[i + 2] * jac[1][1];
+            }
+
+            return gradients;
+        }
+
+        /**
+         * @brief Computes the Hessians of a set of properties with respect to the specifications.
+         *
+         * The Hessian is obtained by differentiating the specification gradients along the state variables and
+         * mapping the result back to the specifications with the same inverse Jacobian. IF97 gives no closed form for
+         * the derivatives of the gradients, so they are finite differences of the gradients (see
+         * specificationGradients), with a larger step to limit the cancellation error; the result is therefore less
+         * accurate than the gradients, in particular in region 3, where the gradients are finite differences too.
+         *
+         * @param state The converged state.
+         * @param spec1 The first specified property.
+         * @param spec2 The second specified property.
+         * @param properties The properties to differentiate.
+         * @return The Hessians, stored as [d2y0/ds1ds1, d2y0/ds1ds2, d2y0/ds2ds2, d2y1/ds1ds1, ...].
+         * @throws KSteamError If the specification is singular at the state.
+         */
+        inline std::vector<FLOAT>
+            specificationHessians(const FlashState& state, Property spec1, Property spec2, std::span<const Property> properties)
+        {
+            auto gradients = [&](const FlashState& s) { return specificationGradients(s, spec1, spec2, properties); };
+
+            auto dz0 = partialDerivative(state, 0, HESSIAN_STEP, gradients);
+            auto dz1 = partialDerivative(state, 1, HESSIAN_STEP, gradients);
+
+            // The gradients of the specifications with respect to the state variables
+            auto n          = properties.size();
+            auto specs      = std::array<Property, 2> { spec1, spec2 };
+            auto [ds0, ds1] = stateDerivatives(state, specs, SENSITIVITY_STEP);
+
+            auto det = ds0[0] * ds1[1] - ds1[0] * ds0[1];
+            if (det == 0.0 || !std::isfinite(det))
+                throw KSteamError("Singular specification", "specificationHessians", { { spec1.asString(), state.property(spec1) }, { spec2.asString(), state.property(spec2) } });
+
+            std::array<std::array<FLOAT, 2>, 2> jac { { { ds1[1] / det, -ds1[0] / det }, { -ds0[1] / det, ds0[0] / det } } };
+
+            std::vector<FLOAT> hessians(n * 3);
+            for (size_t i = 0; i < n; ++i) {
+                // d/ds_j (dy/ds_k) = sum_m d/dz_m (dy/ds_k) * dz_m/ds_j
+                auto h = [&](size_t k, size_t j) { return dz0[i * 2 + k] * jac[0][j] + dz1[i * 2 + k] * jac[1][j]; };
+                hessians[i * 3]     = h(0, 0);
+                hessians[i * 3 + 1] = 0.5 * (h(0, 1) + h(1, 0));
+                hessians[i * 3 + 2] = h(1, 1);
+            }
+
+            return hessians;
+        }
+    }    // namespace impl
+}    // namespace KSteam
+
+#endif    // KSTEAM_SENSITIVITY_HPP
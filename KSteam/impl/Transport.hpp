@@ -0,0 +1,302 @@
+/*
+KKKKKKKKK    KKKKKKK   SSSSSSSSSSSSSSS      tttt
+K:::::::K    K:::::K SS:::::::::::::::S  ttt:::t
+K:::::::K    K:::::KS:::::SSSSSS::::::S  t:::::t
+K:::::::K   K::::::KS:::::S     SSSSSSS  t:::::t
+KK::::::K  K:::::KKKS:::::S        ttttttt:::::ttttttt        eeeeeeeeeeee    aaaaaaaaaaaaa      mmmmmmm    mmmmmmm
+  K:::::K K:::::K   S:::::S        t:::::::::::::::::t      ee::::::::::::ee  a::::::::::::a   mm:::::::m  m:::::::mm
+  K::::::K:::::K     S::::SSSS     t:::::::::::::::::t     e::::::eeeee:::::eeaaaaaaaaa:::::a m::::::::::mm::::::::::m
+  K:::::::::::K       SS::::::SSSSStttttt:::::::tttttt    e::::::e     e:::::e         a::::a m::::::::::::::::::::::m
+  K:::::::::::K         SSS::::::::SS    t:::::t          e:::::::eeeee::::::e  aaaaaaa:::::a m:::::mmm::::::mmm:::::m
+  K::::::K:::::K           SSSSSS::::S   t:::::t          e:::::::::::::::::e aa::::::::::::a m::::m   m::::m   m::::m
+  K:::::K K:::::K               S:::::S  t:::::t          e::::::eeeeeeeeeee a::::aaaa::::::a m::::m   m::::m   m::::m
+KK::::::K  K:::::KKK            S:::::S  t:::::t    tttttte:::::::e         a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K   K::::::KSSSSSSS     S:::::S  t::::::tttt:::::te::::::::e        a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS::::::SSSSSS:::::S  tt::::::::::::::t e::::::::eeeeeeeea:::::aaaa::::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS:::::::::::::::SS     tt:::::::::::tt  ee:::::::::::::e a::::::::::aa:::am::::m   m::::m   m::::m
+KKKKKKKKK    KKKKKKK SSSSSSSSSSSSSSS         ttttttttttt      eeeeeeeeeeeeee  aaaaaaaaaa  aaaammmmmm   mmmmmm   mmmmmm
+
+MIT License
+
+Copyright (c) 2023 Kenneth Troldal Balslev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef KSTEAM_TRANSPORT_HPP
+#define KSTEAM_TRANSPORT_HPP
+
+#include "Common.hpp"
+#include "Config.hpp"
+#include "Error.hpp"
+#include "TransportData.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace KSteam
+{
+    namespace impl
+    {
+        /**
+         * @brief Evaluates a two-dimensional Chebyshev series using Clenshaw's recurrence.
+         * @tparam DegreeX The degree of the series in the first variable.
+         * @tparam DegreeY The degree of the series in the second variable.
+         * @param coeffs The coefficients in row major order, with the first variable varying slowest.
+         * @param x The first variable, mapped to [-1, 1].
+         * @param y The second variable, mapped to [-1, 1].
+         * @return The value of the series.
+         */
+        template<int DegreeX, int DegreeY>
+        inline FLOAT chebyshevSeries(const FLOAT* coeffs, FLOAT x, FLOAT y)
+        {
+            FLOAT b1 = 0.0;
+            FLOAT b2 = 0.0;
+            for (int i = DegreeX; i >= 0; --i) {
+                const FLOAT* row = coeffs + i * (DegreeY + 1);
+
+                FLOAT c1 = 0.0;
+                FLOAT c2 = 0.0;
+                for (int j = DegreeY; j > 0; --j) {
+                    const FLOAT c = 2.0 * y * c1 - c2 + row[j];
+                    c2            = c1;
+                    c1            = c;
+                }
+                const FLOAT a = y * c1 - c2 + row[0];
+
+                if (i == 0) return x * b1 - b2 + a;
+                const FLOAT b = 2.0 * x * b1 - b2 + a;
+                b2            = b1;
+                b1            = b;
+            }
+
+            return 0.0;
+        }
+
+        /**
+         * @brief Evaluates one of the fitted background terms (the logarithm of the viscosity, or of the background
+         *        thermal conductivity) at the given temperature and density.
+         * @param coeffs The coefficients of the background term.
+         * @param temperature The temperature in K.
+         * @param density The density in kg/m³.
+         * @return The value of the fitted term, or std::nullopt if the state is outside the fitted range.
+         */
+        template<typename COEFFS>
+        inline std::optional<FLOAT> backgroundSurrogate(const COEFFS& coeffs, FLOAT temperature, FLOAT density)
+        {
+            using namespace TransportData;
+            if (temperature < BackgroundTMin || temperature > BackgroundTMax || density < 0.0 || density > BackgroundRhoMax)
+                return std::nullopt;
+
+            const FLOAT position = (IF97::get_Tcrit() / temperature - BackgroundTauMin) / (BackgroundTauMax - BackgroundTauMin) * BackgroundPatches;
+            const int   patch    = std::clamp(static_cast<int>(position), 0, BackgroundPatches - 1);
+
+            return chebyshevSeries<BackgroundTauDegree, BackgroundRhoDegree>(coeffs.data() + patch * (BackgroundTauDegree + 1) * (BackgroundRhoDegree + 1),
+                                                                             2.0 * (position - patch) - 1.0,
+                                                                             2.0 * density / BackgroundRhoMax - 1.0);
+        }
+
+        /**
+         * @brief Evaluates the fitted critical enhancement of the thermal conductivity, relative to the background term.
+         *
+         * The enhancement is stored on a quadtree in (T, rho), refined towards the critical point. Cells where the
+         * enhancement is negligible carry no coefficients, and cells that could not be fitted to the required accuracy,
+         * as well as a small box around the critical point, are flagged for exact evaluation.
+         *
+         * @param temperature The temperature in K.
+         * @param density The density in kg/m³.
+         * @return The ratio of the critical enhancement to the background term, or std::nullopt if the state must be
+         *         evaluated exactly.
+         */
+        inline std::optional<FLOAT> enhancementSurrogate(FLOAT temperature, FLOAT density)
+        {
+            using namespace TransportData;
+
+            // Above the upper temperature limit, the state is in IF97 region 5, which has no critical enhancement.
+            if (temperature > EnhancementTMax) return 0.0;
+            if (temperature < EnhancementTMin || density < 0.0 || density > EnhancementRhoMax) return std::nullopt;
+            if (temperature >= CriticalTMin && temperature <= CriticalTMax && density >= CriticalRhoMin && density <= CriticalRhoMax)
+                return std::nullopt;
+
+            FLOAT T0   = EnhancementTMin;
+            FLOAT T1   = EnhancementTMax;
+            FLOAT rho0 = 0.0;
+            FLOAT rho1 = EnhancementRhoMax;
+            int   node = 0;
+            while (EnhancementTree[node].child >= 0) {
+                const auto& split    = EnhancementTree[node];
+                const bool  upperT   = temperature >= split.splitT;
+                const bool  upperRho = density >= split.splitRho;
+
+                (upperT ? T0 : T1)       = split.splitT;
+                (upperRho ? rho0 : rho1) = split.splitRho;
+                node                     = split.child + static_cast<int>(upperT) + 2 * static_cast<int>(upperRho);
+            }
+
+            const int patch = EnhancementTree[node].patch;
+            if (patch == LeafZero) return 0.0;
+            if (patch == LeafExact) return std::nullopt;
+
+            const FLOAT g = chebyshevSeries<EnhancementDegree, EnhancementDegree>(Enhancement.data() + patch * (EnhancementDegree + 1) * (EnhancementDegree + 1),
+                                                                                 (2.0 * temperature - T0 - T1) / (T1 - T0),
+                                                                                 (2.0 * density - rho0 - rho1) / (rho1 - rho0));
+            return std::max(EnhancementScale * std::expm1(g), 0.0);
+        }
+
+        /**
+         * @brief Calculates the dynamic viscosity from the surrogate model.
+         *
+         * The surrogate reproduces the IAPWS-IF97 viscosity correlation to a relative error of about 1E-9.
+         *
+         * @param temperature The temperature in K.
+         * @param density The density in kg/m³.
+         * @return The dynamic viscosity in Pa·s, or std::nullopt if the state is outside the range of the surrogate.
+         */
+        inline std::optional<FLOAT> viscositySurrogate(FLOAT temperature, FLOAT density)
+        {
+            const auto result = backgroundSurrogate(TransportData::Viscosity, temperature, density);
+            if (!result) return std::nullopt;
+            return std::exp(*result);
+        }
+
+        /**
+         * @brief Calculates the thermal conductivity from the surrogate model.
+         *
+         * The background term reproduces the IAPWS-IF97 correlation to a relative error of about 1E-9, and the critical
+         * enhancement is fitted to a relative error below 1E-3 of the total conductivity. The bound is verified by the
+         * generator on dense grids between the fitting nodes, including the saturation boundary.
+         *
+         * @param temperature The temperature in K.
+         * @param density The density in kg/m³.
+         * @return The thermal conductivity in W/(m·K), or std::nullopt if the state must be evaluated exactly.
+         */
+        inline std::optional<FLOAT> thermalConductivitySurrogate(FLOAT temperature, FLOAT density)
+        {
+            const auto enhancement = enhancementSurrogate(temperature, density);
+            if (!enhancement) return std::nullopt;
+            const auto background = backgroundSurrogate(TransportData::Conductivity, temperature, density);
+            if (!background) return std::nullopt;
+            return 1.0E-3 * std::exp(*background) * (1.0 + *enhancement);
+        }
+
+        /**
+         * @brief Checks if a surrogate model is available for the property.
+         * @param property The property to check.
+         * @return true if the property can be evaluated from a surrogate model, otherwise false.
+         */
+        inline bool hasSurrogate(Property property)
+        {
+            switch (property.type()) {
+                case Property::DynamicViscosity:
+                case Property::KinematicViscosity:
+                case Property::ThermalConductivity:
+                case Property::PrandtlNumber:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        /**
+         * @brief Calculates a transport property from the surrogate models. States outside the range of the
+         *        surrogates are evaluated exactly.
+         * @param property The transport property to be calculated.
+         * @param temperature The temperature in K.
+         * @param density The density in kg/m³.
+         * @param exactConductivity Callable returning the exact thermal conductivity at the state.
+         * @param heatCapacity Callable returning the isobaric heat capacity at the state.
+         * @return The calculated property value.
+         */
+        template<typename COND, typename CP>
+        inline FLOAT transportProperty(Property property, FLOAT temperature, FLOAT density, COND exactConductivity, CP heatCapacity)
+        {
+            const auto viscosity = [&]() {
+                const auto result = viscositySurrogate(temperature, density);
+                return result ? *result : IF97::visc_TRho(temperature, density);
+            };
+
+            const auto conductivity = [&]() {
+                const auto result = thermalConductivitySurrogate(temperature, density);
+                return result ? *result : exactConductivity();
+            };
+
+            switch (property.type()) {
+                case Property::DynamicViscosity:
+                    return viscosity();
+                case Property::KinematicViscosity:
+                    return viscosity() / density;
+                case Property::ThermalConductivity:
+                    return conductivity();
+                case Property::PrandtlNumber:
+                    return viscosity() * heatCapacity() / conductivity();
+                default:
+                    throw KSteamError("No surrogate model for property", "transportProperty", { { "T", temperature }, { "RHO", density } });
+            }
+        }
+
+        /**
+         * @brief Calculates a transport property from the surrogate models, at given pressure and temperature.
+         * @param pressure The pressure in Pa.
+         * @param temperature The temperature in K.
+         * @param property The transport property to be calculated.
+         * @return The calculated property value.
+         * @throws KSteamError If the result is invalid.
+         */
+        inline FLOAT transportPropertyPT(FLOAT pressure, FLOAT temperature, Property property)
+        {
+            const FLOAT result = transportProperty(
+                property,
+                temperature,
+                IF97::rhomass_Tp(temperature, pressure),
+                [&]() { return IF97::tcond_Tp(temperature, pressure); },
+                [&]() { return IF97::cpmass_Tp(temperature, pressure); });
+
+            if (!std::isfinite(result))
+                throw KSteamError("Invalid transport property", "transportPropertyPT", { { "T", temperature }, { "P", pressure } });
+            return result;
+        }
+
+        /**
+         * @brief Calculates a transport property from the surrogate models, for saturated liquid or vapor at given pressure.
+         * @param pressure The pressure in Pa.
+         * @param quality The vapor quality; must be 0.0 (saturated liquid) or 1.0 (saturated vapor).
+         * @param property The transport property to be calculated.
+         * @return The calculated property value.
+         * @throws KSteamError If the result is invalid.
+         */
+        inline FLOAT transportPropertyPX(FLOAT pressure, FLOAT quality, Property property)
+        {
+            const bool  liquid = quality == 0.0;
+            const FLOAT result = transportProperty(
+                property,
+                IF97::Tsat97(pressure),
+                liquid ? IF97::rholiq_p(pressure) : IF97::rhovap_p(pressure),
+                [&]() { return liquid ? IF97::tcondliq_p(pressure) : IF97::tcondvap_p(pressure); },
+                [&]() { return liquid ? IF97::cpliq_p(pressure) : IF97::cpvap_p(pressure); });
+
+            if (!std::isfinite(result))
+                throw KSteamError("Invalid transport property", "transportPropertyPX", { { "P", pressure }, { "x", quality } });
+            return result;
+        }
+    }    // namespace impl
+}    // namespace KSteam
+
+#endif    // KSTEAM_TRANSPORT_HPP
@@ -0,0 +1,3827 @@
+//
+// Generated by tools/GenerateTransportData.cpp. Do not edit.
+//
+
+#ifndef KSTEAM_TRANSPORTDATA_HPP
+#define KSTEAM_TRANSPORTDATA_HPP
+
+#include "Config.hpp"
+
+#include <array>
+
+namespace KSteam::impl::TransportData
+{
+    constexpr FLOAT BackgroundTMin      = 273.15;
+    constexpr FLOAT BackgroundTMax      = 2273.15;
+    constexpr FLOAT BackgroundRhoMax    = 1100;
+    constexpr FLOAT BackgroundTauMin    = 0.28466929151177878;
+    constexpr FLOAT BackgroundTauMax    = 2.3690133626212706;
+    constexpr int   BackgroundPatches   = 8;
+    constexpr int   BackgroundTauDegree = 10;
+    constexpr int   BackgroundRhoDegree = 7;
+
+    constexpr std::array<FLOAT, 704> Viscosity {
+        -10.024035004138526, -0.73436126844309702, -0.74774657339654993, -0.42055202601398406,
+        -0.15005733906249746, -0.019762891708723199, 0.00548018715725753, 0.00065503054737678617,
+        0.28077846045680344, 0.81478998839141037, 0.35335309851807117, 0.14589042570903263,
+        0.034601434679584327, -0.0074457191267501329, -0.003684944432683049, -0.00042331338308101226,
+        -0.034126431868689841, -0.074953761070666036, -0.031404199646586139, -0.006044923434902442,
+        0.001174127277312193, 0.0011445457024390684, 0.00046661580630650998, 4.98522288934413e-05,
+        0.0010035729529603349, 0.0038873658913019778, 0.0013851968533212901, -0.00016636580771465438,
+        -0.00017196430452475815, -8.2628083926722894e-05, -2.5105342675433498e-05, -2.3444319643103642e-06,
+        0.00010962209364410876, -8.8951255756455154e-05, -2.8588725028967264e-05, 6.9982966051702018e-06,
+        8.2155622040341374e-06, 2.6261425610695324e-06, 5.3245772177215855e-07, 4.1408861703199046e-08,
+        -2.1080278898244487e-05, 8.6046214048901059e-07, 1.8264945451045894e-07, -1.4031738688141165e-07,
+        -6.8107465202935854e-08, -2.5134383079878312e-08, -6.4307081276188619e-09, -9.2202530459091622e-10,
+        2.9068368177156212e-06, -8.8817841970012523e-16, -2.8260222445003984e-16, -2.8260222445003984e-16,
+        2.8260222445003984e-16, -1.4130111222501992e-16, 2.0185873175002846e-16, 3.3306690738754696e-16,
+        -4.013331547899926e-07, 1.0092936587501424e-15, 6.0557619525008534e-16, -1.2111523905001707e-16,
+        -4.4408920985006262e-16, -5.4501857572507686e-16, -1.2111523905001707e-16, -2.6746281956878772e-16,
+        5.6560047160965479e-08, 5.6520444890007968e-16, 3.2297397080004555e-16, 2.0185873175002846e-16,
+        -8.0743492700011387e-17, 1.2111523905001707e-16, 2.0185873175002846e-16, -2.0690520004377916e-16,
+        -8.0933889993902008e-09, 2.4223047810003414e-16, 2.4223047810003414e-16, -2.0185873175002846e-16,
+        -1.6148698540002277e-16, -3.2297397080004555e-16, 8.0743492700011387e-17, -1.5644051710627207e-16,
+        1.1482752879856471e-09, -4.1381040008755832e-16, 1.8167285857502563e-16, 3.7343865373755267e-16,
+        2.9774162933129196e-16, 2.4223047810003414e-16, 1.261617073437678e-16, 1.7410315613439954e-16,
+        -9.6884874735467275, 0.42709206560262736, -0.24494251355947114, -0.18224938784189312,
+        -0.07648695079389381, -0.028158796812256203, 0.00098501003343577274, 0.00012515982969929002,
+        0.067690377380151018, 0.37886662349520955, 0.16111044426710633, 0.091235733707857147,
+        0.037871275853046255, -0.0015793950216944227, -0.0010220206071030115, -0.00012716655447036535,
+        -0.018842605442463765, -0.036276785915425484, -0.017405806369833406, -0.0074620861288026948,
+        -0.00014570133252199793, 0.00038852968823131144, 0.00021222336794759288, 2.5085759267406971e-05,
+        0.0012446698181156422, 0.0026018197415636542, 0.00095700116550540514, -7.6843843950195762e-05,
+        -5.1412503711050824e-05, -4.4631304266250602e-05, -1.7614932470009428e-05, -1.8294142457777405e-06,
+        -2.4505519189502419e-05, -7.1742012960320593e-05, -2.493573594832619e-05, 4.1919488658867268e-06,
+        6.853412897956833e-06, 2.1234548972111482e-06, 4.0384355383015314e-07, 2.2968353158797135e-08,
+        -1.1712713485161947e-06, 8.6046213980269082e-07, 1.8264945418748499e-07, -1.4031738708327038e-07,
+        -6.8107465122192359e-08, -2.5134383140435933e-08, -6.4307088139385496e-09, -9.2202544589202841e-10,
+        1.4172356526726498e-07, -1.6148698540002277e-16, 8.0743492700011387e-17, -8.0743492700011387e-17,
+        3.2297397080004555e-16, 1.2111523905001707e-16, 0, 4.0371746350005693e-17,
+        -1.1817465874550882e-08, -2.0185873175002846e-16, 4.0371746350005693e-17, 8.0743492700011387e-17,
+        2.0185873175002847e-17, 2.4223047810003414e-16, -1.0092936587501423e-16, 2.4223047810003414e-16,
+        1.0069520167183493e-09, 8.0743492700011387e-17, -1.8167285857502563e-16, -2.0185873175002847e-17,
+        2.0185873175002847e-17, -6.0557619525008534e-17, -3.0278809762504267e-17, 2.523234146875356e-16,
+        -8.7148490444312969e-11, 1.2111523905001707e-16, 2.4223047810003414e-16, 1.2111523905001707e-16,
+        -8.0743492700011387e-17, 3.3306690738754696e-16, -2.1195166833752989e-16, 1.1606877075626636e-16,
+        7.579028314032918e-12, -4.1381040008755832e-16, 6.0557619525008534e-17, -2.523234146875356e-16,
+        -1.0092936587501423e-17, 7.5697024406260668e-17, -2.2204460492503131e-16, 1.7410315613439954e-16,
+        -9.6619055927896351, 0.98056789202475125, -0.030206678243884465, -0.061730419366239513,
+        -0.0026160732927564419, -0.02952282022360464, 4.0482721518656206e-05, 5.4811078325450229e-06,
+        -0.030930550845750915, 0.19533375869414057, 0.061295156244848006, 0.028777467831100721,
+        0.035998469975820839, -7.4084651031485805e-05, -6.967965213682865e-05, -9.4464507969642266e-06,
+        -0.0066366890686507703, -0.011374277248584813, -0.008195074395158531, -0.0080743946404979935,
+        -0.00014967466591262669, 4.0217014264598561e-05, 3.536889195902711e-05, 4.7292134095388114e-06,
+        0.00077918763731817239, 0.0015916214765674397, 0.00058725330297521537, -3.222344401386902e-05,
+        4.7344908215351076e-05, -1.4677527220084066e-05, -1.2182348947014694e-05, -1.6094446695066624e-06,
+        -2.9436690020201439e-05, -5.453277016515495e-05, -2.1282746867967717e-05, 1.3856011263610215e-06,
+        5.4912635926869635e-06, 1.6207672333123924e-06, 2.7522938611019238e-07, 4.5278437363097364e-09,
+        2.4323532287308003e-07, 8.6046213968157559e-07, 1.8264945362228052e-07, -1.4031738712364214e-07,
+        -6.8107465202935854e-08, -2.5134382978948947e-08, -6.4307088139385496e-09, -9.2202535505559911e-10,
+        1.9584165319744527e-08, -5.6520444890007968e-16, -8.0743492700011387e-17, -1.2111523905001707e-16,
+        4.0371746350005693e-17, -1.4130111222501992e-16, -8.0743492700011387e-17, 2.523234146875356e-16,
+        -1.1664101805631719e-09, -6.8631968795009675e-16, -1.2111523905001707e-16, -2.0185873175002846e-16,
+        -1.6148698540002277e-16, -3.2297397080004555e-16, 4.0371746350005691e-16, 2.2204460492503131e-16,
+        7.1328660150077837e-11, -7.2669143430010251e-16, -1.0092936587501423e-16, 1.6148698540002277e-16,
+        -6.0557619525008534e-17, 8.0743492700011387e-17, -6.0557619525008534e-17, -3.1288103421254413e-16,
+        -4.4309606488985249e-12, -6.8631968795009675e-16, -1.2111523905001707e-16, -3.4315984397504838e-16,
+        1.0092936587501423e-16, 1.3120817563751851e-16, 6.0557619525008534e-17, -2.1195166833752989e-16,
+        2.8048775423495831e-13, -5.1473976596257261e-16, -8.0743492700011387e-17, 2.523234146875356e-16,
+        -6.0557619525008534e-17, -2.8764869274379055e-16, 6.5604087818759253e-17, -1.4130111222501992e-16,
+        -9.7525799421692607, 1.3311146987265303, 0.045235391951877653, -0.069869694306021954,
+        0.070968654773369486, -0.0296209967889885, -0.00023245423468302867, -3.6791507369006062e-05,
+        -0.054135341205194649, 0.16721236054862124, 0.0184114396484127, -0.0372008135273596,
+        0.038463728592864517, -5.4225418343424216e-05, -0.00030639354956661017, -4.9035992757931723e-05,
+        0.00010871840801985788, 0.0030579395467611255, -0.0030706298191261927, -0.0084206677359291091,
+        0.00090067461049264154, 3.0916491619721724e-06, -8.8641541844726064e-05, -1.475798639112695e-05,
+        0.00036484397038837426, 0.00085677109631470728, 0.0002759532657314071, -3.2504607906279723e-05,
+        0.00012430793125513389, 7.233247211211526e-06, -8.8075921057831597e-06, -1.6845232363449369e-06,
+        -2.1615111078303201e-05, -3.7323527367728495e-05, -1.7629757787689986e-05, -1.4207466125187358e-06,
+        4.129114287013377e-06, 1.1180795704229303e-06, 1.4661521865264795e-07, -1.391266527236726e-08,
+        4.8313461578883021e-07, 8.6046213939897342e-07, 1.8264945386451101e-07, -1.4031738708327038e-07,
+        -6.8107465445166326e-08, -2.5134382857833707e-08, -6.4307082083623545e-09, -9.2202515319686734e-10,
+        4.5181614005684878e-09, 0, -1.6148698540002277e-16, -8.0743492700011387e-17,
+        -4.0371746350005693e-17, -2.0185873175002847e-17, 1.0092936587501423e-16, 0,
+        -2.0709993316229841e-10, -7.6706318065010816e-16, -1.6148698540002277e-16, 8.0743492700011387e-17,
+        1.6148698540002277e-16, -2.0185873175002846e-16, -3.8353159032505408e-16, -1.5139404881252134e-16,
+        9.8555507189633893e-12, -5.2483270255007403e-16, -3.2297397080004555e-16, 3.0278809762504267e-16,
+        1.0092936587501423e-16, 8.0743492700011387e-17, -2.523234146875356e-16, -1.1102230246251565e-16,
+        -4.7289445087079163e-13, -8.4780667335011958e-16, 8.0743492700011387e-17, 2.0185873175002847e-17,
+        4.0371746350005693e-17, 1.2111523905001707e-16, 1.6148698540002277e-16, 2.7755575615628914e-16,
+        2.5615873059078611e-14, -3.7343865373755267e-16, 7.0650556112509961e-17, 1.6148698540002277e-16,
+        1.8167285857502563e-16, -6.2576206842508827e-16, 3.1288103421254413e-16, 1.3373140978439386e-16,
+        -9.8497634416393005, 1.7162563036673339, 0.064777558051198725, -0.21328521972002584,
+        0.16054975649366532, -0.029240364412812102, -0.0018673556164063854, -0.0003205343681395427,
+        -0.040867491044400926, 0.22395679255434378, 0.0025744909023989685, -0.10672610210118716,
+        0.052655501915945931, 0.00058361702176707396, -0.0014081856426597448, -0.00025314272274531724,
+        0.0027455601386361991, 0.010324039087524994, -0.0013310987383026364, -0.0090397241810395591,
+        0.0027438138300441232, 0.0001806375615446579, -0.00018450185365047713, -3.6916417846644123e-05,
+        0.00010070981486806377, 0.00039726860080392288, 2.3101053773980336e-05, -7.7687335627226034e-05,
+        0.00017947656540696531, 2.1101019027515054e-05, -7.4906619473039369e-06, -2.0546499454952216e-06,
+        -1.1203479205003994e-05, -2.0114284570705753e-05, -1.3976768706847054e-05, -4.2270943521251843e-06,
+        2.7669649818646231e-06, 6.1539190672603316e-07, 1.8001050932687172e-08, -3.2353174099371398e-08,
+        5.4638869053456252e-07, 8.6046213871265375e-07, 1.8264945426822846e-07, -1.4031738688141165e-07,
+        -6.8107465445166326e-08, -2.5134383463409904e-08, -6.4307090359831546e-09, -9.220255468213943e-10,
+        1.4326307211250237e-09, 1.3322676295501878e-15, 4.0371746350005691e-16, 4.0371746350005693e-17,
+        -2.0185873175002846e-16, -4.0371746350005691e-16, -4.0371746350005693e-17, 3.0278809762504267e-17,
+        -5.2229291598719513e-11, -1.0092936587501424e-15, -1.2111523905001707e-16, 2.0185873175002846e-16,
+        4.0371746350005693e-17, 6.0557619525008534e-16, 3.2297397080004555e-16, 1.0092936587501423e-17,
+        2.0391365363924376e-12, -2.8260222445003984e-16, 2.4223047810003414e-16, 2.0185873175002847e-17,
+        1.4130111222501992e-16, 0, -1.1102230246251565e-16, 1.0597583416876495e-16,
+        -7.5343771625698122e-14, -9.0836429287512806e-16, -1.4130111222501992e-16, 2.0185873175002846e-16,
+        -8.0743492700011387e-17, -7.0650556112509961e-17, -4.0371746350005693e-17, 3.4315984397504838e-16,
+        5.5460686548320318e-15, -6.7622675136259534e-16, 3.6334571715005125e-16, 0,
+        -2.1195166833752989e-16, -1.5139404881252134e-16, 4.5418214643756407e-17, -5.2987917084382473e-17,
+        -9.9073041537441053, 2.2588586487331912, 0.057655065154134058, -0.50295953626190593,
+        0.29509439404765908, -0.025733220559707212, -0.0064473742529115811, -0.0012073635331899433,
+        -0.016275665352186053, 0.32145481514228141, -0.01048950234111617, -0.18413593975158674,
+        0.0838699788236449, 0.0031707487636750786, -0.0032486306361703739, -0.00065729880484227167,
+        0.0032441114127265843, 0.013728195990613075, -0.0022751072492517691, -0.010470382741772498,
+        0.0051182103260935885, 0.00047633872003533477, -0.00027690596364291701, -6.5286658668662796e-05,
+        1.0352353094080577e-05, 0.00021311399003540933, -0.00017130333289754935, -0.00016777162717670794,
+        0.00021285081067132984, 2.692578822910912e-05, -8.231558470587915e-06, -2.7198247970988181e-06,
+        -2.111525572571922e-08, -2.9050417754593707e-06, -1.0323779627376759e-05, -7.0334420916508895e-06,
+        1.4048156764332667e-06, 1.1270424310987953e-07, -1.1061311593946693e-07, -5.079368209875474e-08,
+        5.6858408345209199e-07, 8.6046213919711467e-07, 1.8264945309744782e-07, -1.4031738785033357e-07,
+        -6.8107465929627284e-08, -2.5134383301922917e-08, -6.4307079863177496e-09, -9.2202514310393076e-10,
+        5.7628205238105773e-10, 3.2297397080004555e-16, -1.6148698540002277e-16, -3.6334571715005125e-16,
+        -8.0743492700011387e-17, 2.4223047810003414e-16, 1.4130111222501992e-16, 5.752973854875811e-16,
+        -1.6410973590165089e-11, -7.2669143430010251e-16, 0, 2.4223047810003414e-16,
+        8.0743492700011387e-17, 2.0185873175002846e-16, -2.0185873175002847e-17, 3.8353159032505408e-16,
+        5.6147006236270414e-13, -3.6334571715005125e-16, 4.0371746350005693e-17, 6.459479416000911e-16,
+        1.6148698540002277e-16, -2.6241635127503701e-16, 6.3585500501258968e-16, 5.0464682937507117e-18,
+        -1.3504349154076905e-14, -1.6148698540002276e-15, 1.4130111222501992e-16, 2.4223047810003414e-16,
+        -6.2576206842508827e-16, -1.8167285857502563e-16, -2.2204460492503131e-16, -1.9681226345627775e-16,
+        2.8714404591441548e-15, -6.7622675136259534e-16, -1.1102230246251565e-16, 5.8539032207508251e-16,
+        -6.0557619525008534e-17, 2.0185873175002847e-17, -5.5511151231257827e-16, -4.0624069764693229e-16,
+        -9.91294086010695, 3.0199965936073441, 0.010166524892373867, -0.96286081843526938,
+        0.51206984603884897, -0.014561378756578348, -0.015500363744452466, -0.0031582840110950302,
+        0.011036874543486987, 0.44202758567867106, -0.039443361202577604, -0.2780784184673073,
+        0.13531108686134977, 0.0082663476507334587, -0.0058988545963395726, -0.0013253610248303951,
+        0.0037436585791317659, 0.016574584872938673, -0.0052012814485371739, -0.013251462184068495,
+        0.0077623314319936135, 0.0007936790932567626, -0.00039054779200829097, -0.00010340928656839907,
+        0.00010161309227305828, 0.00030430726401021633, -0.00030725989428253604, -0.00030275748255472541,
+        0.00022443066704855045, 2.4707554816276328e-05, -1.1030281675473606e-05, -3.6800477915897223e-06,
+        1.1460010236936052e-05, 1.4304201020513704e-05, -6.6707905467760558e-06, -9.8397898310958514e-06,
+        4.2666371445999503e-08, -3.8998341937586517e-07, -2.3922728382091468e-07, -6.9234191369848083e-08,
+        5.7844810832172944e-07, 8.6046213814744921e-07, 1.8264945354153703e-07, -1.4031738692178342e-07,
+        -6.8107465929627284e-08, -2.5134383180807681e-08, -6.4307086322656914e-09, -9.2202590007417484e-10,
+        2.9446392798862774e-10, 5.6520444890007968e-16, -3.6334571715005125e-16, -2.8260222445003984e-16,
+        -8.0743492700011387e-17, -8.0743492700011387e-17, -8.0743492700011387e-17, -3.0278809762504267e-17,
+        -5.5435857924315064e-12, -6.8631968795009675e-16, 7.2669143430010251e-16, 5.6520444890007968e-16,
+        4.0371746350005691e-16, 6.0557619525008534e-16, 3.2297397080004555e-16, -5.0464682937507114e-17,
+        2.0327174287227867e-13, -1.453382868600205e-15, 8.0743492700011387e-17, 4.6427508302506544e-16,
+        -4.0371746350005691e-16, 2.6241635127503701e-16, 2.0185873175002846e-16, 7.5697024406260668e-17,
+        -2.1195166833752989e-16, -1.5946839808252248e-15, 6.0557619525008534e-16, 8.8817841970012523e-16,
+        -1.0092936587501423e-16, -7.0650556112509961e-17, -2.3213754151253272e-16, -3.936245269125555e-16,
+        2.1952137077815596e-15, -8.9827135628762675e-16, -3.1288103421254413e-16, 2.7250928786253843e-16,
+        -1.2111523905001707e-16, 1.4130111222501992e-16, -8.0743492700011387e-17, -5.5006504401882751e-16,
+        -9.8542751787385967, 4.0518207096408068, -0.12310410211579993, -1.6385639748487584,
+        0.85325898482832152, 0.009159574905351707, -0.030893981185252398, -0.0067903390036822197,
+        0.049862214580657274, 0.59442965846503981, -0.097338915574949378, -0.40151218036463732,
+        0.20809049224126239, 0.015657463275270702, -0.0096275349508941396, -0.0023495107901824086,
+        0.006446079356340481, 0.022167380351406699, -0.0094082474327271976, -0.017921781273873613,
+        0.010414644481092255, 0.0010361426498289154, -0.00055012125893369207, -0.00015482487925961246,
+        0.00037786738057444711, 0.00067084842272745573, -0.00038476863038138345, -0.00048264490176168226,
+        0.0002142161345386271, 1.4446318787926641e-05, -1.5886831562970308e-05, -4.9353189282412435e-06,
+        2.3090235672535382e-05, 3.1513443817374956e-05, -3.0178014668213007e-06, -1.2646137570338954e-05,
+        -1.319482934913907e-06, -8.9267108400131245e-07, -3.6784145204552227e-07, -8.7674700630848493e-08,
+        5.8424724343324064e-07, 8.6046213952008865e-07, 1.826494528148456e-07, -1.4031738837516627e-07,
+        -6.8107465283679336e-08, -2.5134382211885766e-08, -6.4307078450166373e-09, -9.220246081782916e-10,
+        2.0935972147836682e-10, -2.4223047810003414e-16, -5.2483270255007403e-16, -4.0371746350005691e-16,
+        -4.8446095620006827e-16, -1.0092936587501424e-15, -5.046468293750712e-16, -5.2483270255007403e-16,
+        -9.8725068524303916e-13, -2.5837917664003644e-15, 4.8446095620006827e-16, 6.0557619525008534e-16,
+        -7.2669143430010251e-16, 2.0185873175002847e-17, 2.4223047810003414e-16, 5.8539032207508251e-16,
+        1.1370702359479104e-13, -2.2608177956003187e-15, -1.2111523905001707e-16, 1.0092936587501424e-15,
+        7.6706318065010816e-16, 1.2313382636751737e-15, 1.1102230246251565e-15, 5.7025091719383044e-16,
+        4.0775463813505749e-15, -2.1800743029003074e-15, 4.0371746350005691e-16, 1.3322676295501878e-15,
+        4.2390333667505979e-16, 5.5511151231257827e-16, 5.046468293750712e-16, 1.8671932686877633e-16,
+        3.4669237178067388e-15, -2.9269516103754126e-16, 7.6706318065010816e-16, 1.1102230246251565e-16,
+        -1.5644051710627207e-15, -6.7118028306884468e-16, -6.8127321965634609e-16, 2.5736988298128631e-16
+    };
+
+    constexpr std::array<FLOAT, 704> Conductivity {
+        6.4493111591100023, 1.1081710519283805, -0.057648571415444216, 0.055488545764720149,
+        -0.042934574426635334, -0.0028836002960615152, 0.0037420691891043478, -9.8910778557513937e-16,
+        -0.2672156970482687, 0.14688636390172019, -0.028504029835940855, -0.010728772218760259,
+        0.0096809764086474223, -0.0055029361775986111, 0.00062437607659382444, 3.3306690738754696e-16,
+        0.017344453972486337, -0.0017720294418479554, 0.0016782729289846123, -0.0020415203707900339,
+        0.0028104491485090107, -0.00070407601088796521, 4.0480211189055446e-05, -1.2111523905001707e-16,
+        -0.0010105068760121285, -0.0010028436845612519, -0.00059192725581407913, 0.00091270288769485961,
+        -0.00056524374873526378, 0.00014680590822367036, -1.2962671010464565e-05, 2.6241635127503701e-16,
+        0.00019293946844682481, 3.610864475891227e-05, 2.1952990255828681e-05, -3.2046634417369866e-05,
+        1.690494657001874e-05, -4.0860451372516273e-06, 3.6078969489761192e-07, 3.532527805625498e-17,
+        -2.6963385574184752e-05, 3.2297397080004555e-16, 3.0278809762504267e-16, -1.2111523905001707e-16,
+        3.2297397080004555e-16, 4.6427508302506544e-16, 2.523234146875356e-16, 4.5418214643756403e-16,
+        3.3692698211508119e-06, 6.0557619525008534e-16, 1.2111523905001707e-16, -2.0185873175002846e-16,
+        -3.2297397080004555e-16, -5.046468293750712e-16, 6.0557619525008534e-17, 2.8260222445003984e-16,
+        -4.4295195919278024e-07, -3.2297397080004555e-16, 2.8260222445003984e-16, 2.0185873175002846e-16,
+        2.6241635127503701e-16, -5.0464682937507114e-17, -1.0092936587501423e-17, -3.6839218544380196e-16,
+        6.0391113049734268e-08, 0, 1.8167285857502563e-16, 3.0278809762504267e-16,
+        5.1473976596257261e-16, 5.6520444890007968e-16, 3.8857805861880479e-16, 2.4223047810003414e-16,
+        -8.4520527142796127e-09, 5.0464682937507114e-17, 5.9548325866258393e-16, 4.339962732625612e-16,
+        8.0743492700011387e-17, -4.0371746350005693e-17, -8.5789960993762094e-17, 5.5511151231257827e-17,
+        1.181980132456608e-09, 8.0743492700011387e-17, 2.169981366312806e-16, 8.5789960993762094e-17,
+        1.2111523905001707e-16, 1.7914962442815025e-16, 2.1195166833752989e-16, 1.0471421709532727e-16,
+        6.0358713285587609, 1.356592343977602, -0.11950870924720287, 0.046228594285235299,
+        -0.019322541131731728, -0.014727976892225764, 0.0048913531548294446, -8.9574812214075132e-16,
+        -0.14887663270826035, 0.094395182882677536, -0.037519141333467655, 0.0080321188628711803,
+        0.0096310151245196218, -0.0052002649473138381, 0.00042414435462050977, -2.523234146875356e-16,
+        0.013831490386966839, -0.010339723759637128, -0.0033173670761946672, 0.0058344373775249814,
+        -0.0023496009655741075, 0.00066533455461517926, -8.0436030223048199e-05, 9.5882897581263521e-17,
+        -1.6733183158201825e-05, -0.00042510536840287017, -0.00024067941171545084, 0.00039995673702485459,
+        -0.00029476460361151216, 8.1429186027079126e-05, -7.1900358909824584e-06, 9.0836429287512813e-17,
+        -7.0468181885678538e-07, 3.6108644759638963e-05, 2.1952990256171841e-05, -3.2046634416764292e-05,
+        1.6904946570139856e-05, -4.0860451372112552e-06, 3.6078969526095766e-07, 1.6148698540002277e-16,
+        -2.6700987108097993e-06, -2.2204460492503131e-16, 1.8167285857502563e-16, 2.0185873175002847e-17,
+        -2.4223047810003414e-16, -1.0092936587501423e-16, 1.0092936587501423e-17, 2.7755575615628914e-16,
+        1.9761293878029951e-07, -1.6148698540002277e-16, -1.0092936587501423e-16, 0,
+        -1.0092936587501423e-16, -2.4223047810003414e-16, -2.1195166833752989e-16, -3.8353159032505408e-16,
+        -1.5337640521276539e-08, 1.6148698540002277e-16, 2.4223047810003414e-16, 6.0557619525008534e-17,
+        2.0185873175002847e-17, -8.0743492700011387e-17, -7.0650556112509961e-17, 3.582992488563005e-16,
+        1.2335805407462626e-09, -8.8817841970012523e-16, -3.2297397080004555e-16, -3.0278809762504267e-16,
+        -2.1195166833752989e-16, -1.0092936587501423e-16, -1.2111523905001707e-16, -1.4634758051877063e-16,
+        -1.0200695338918371e-10, -8.7808548311262382e-16, 0, -1.0092936587501423e-17,
+        -1.4634758051877063e-16, 1.6148698540002277e-16, 1.766263902812749e-16, -7.5697024406260668e-18,
+        8.5576091667472944e-12, -2.6241635127503701e-16, 9.5882897581263521e-17, -1.2111523905001707e-16,
+        -5.2987917084382473e-17, -1.261617073437678e-16, -2.0942843419065454e-16, -2.901719268906659e-17,
+        5.8460696005722124, 1.4534437754604526, -0.2260167720396967, 0.1180137332300832,
+        -0.026812623803027676, -0.017496041947261134, 0.0048922038798584833, -8.0995816114698925e-16,
+        -0.042105557452210493, 0.0010938864969369194, -0.069639476355686819, 0.065188856698876571,
+        -0.018716348106307391, 0.0029196081415680075, -0.00046633081290393572, 1.0597583416876495e-16,
+        0.012366297034945972, -0.011974558283521806, -0.004098032952187641, 0.0075574413178045386,
+        -0.0042639013381650607, 0.0012502244537619541, -0.00013208065019816711, 1.0092936587501423e-16,
+        -0.00029154550480560047, 0.00015263294775561239, 0.00011056843238341976, -0.00011278941364470637,
+        -2.4285458487074216e-05, 1.6052463830851238e-05, -1.4174007713489574e-06, 1.8671932686877633e-16,
+        -2.7365348037125788e-05, 3.6108644759618777e-05, 2.1952990256091098e-05, -3.2046634416804665e-05,
+        1.6904946570442643e-05, -4.0860451371305118e-06, 3.6078969512974946e-07, 2.169981366312806e-16,
+        -5.9319286553490125e-07, -6.0557619525008534e-16, 4.0371746350005693e-17, -1.8167285857502563e-16,
+        1.2111523905001707e-16, 6.0557619525008534e-17, 3.8353159032505408e-16, 3.7343865373755267e-16,
+        3.1430587910108443e-08, 8.0743492700011387e-17, -8.0743492700011387e-17, 1.4130111222501992e-16,
+        -7.0650556112509961e-17, 9.0836429287512813e-17, 2.1195166833752989e-16, 5.5511151231257827e-17,
+        -1.7428792954309426e-09, -6.8631968795009675e-16, 0, 3.0278809762504267e-17,
+        4.0371746350005693e-17, 3.3306690738754696e-16, 8.0743492700011387e-17, -2.5232341468753557e-17,
+        9.9874759977454502e-11, -7.6706318065010816e-16, -3.2297397080004555e-16, -3.1288103421254413e-16,
+        1.3120817563751851e-16, -5.0464682937507117e-18, -5.0464682937507114e-17, -1.4887081466564598e-16,
+        -5.8776468540729221e-12, -5.2483270255007403e-16, 2.2204460492503131e-16, 1.6148698540002277e-16,
+        -8.0743492700011387e-17, -1.2111523905001707e-16, -2.9017192689066593e-16, -2.2204460492503131e-16,
+        3.5029555014241187e-13, 8.0743492700011387e-17, 5.2483270255007403e-16, 1.261617073437678e-16,
+        2.3970724395315881e-16, -6.30808536718839e-17, 1.8545770979533864e-16, 1.5013243173908367e-16,
+        5.8439909842183626, 1.3725679939947784, -0.38966341380881669, 0.29841202564373442,
+        -0.096033628401972174, -0.001829557074812986, 0.0029183074445912616, -9.4116633678450763e-16,
+        0.034689389239408792, -0.077554646904260269, -0.091145241869105567, 0.11151781082497815,
+        -0.049395115351885052, 0.012580517758207132, -0.001492876454478083, -2.8764869274379055e-16,
+        0.0059482001565674255, -0.0066765330135006148, -0.00066372469899434914, 0.0031274914500485766,
+        -0.0029324519692618903, 0.00105059368655464, -0.00011445364873570578, -3.986709952063062e-16,
+        -0.00079522117445075433, 0.00073037126391441794, 0.00046181627648198757, -0.00062553556431442882,
+        0.00024619368663712153, -4.9324258365548232e-05, 4.3552343482542648e-06, 1.1606877075626636e-16,
+        -3.4351578224824728e-05, 3.610864475998212e-05, 2.1952990256292956e-05, -3.2046634416703732e-05,
+        1.6904946570301345e-05, -4.0860451374736719e-06, 3.6078969486733309e-07, 3.0278809762504267e-17,
+        -1.9283654750790191e-07, 3.0278809762504267e-16, 0, -1.4130111222501992e-16,
+        1.6148698540002277e-16, -2.9269516103754126e-16, -1.4130111222501992e-16, 1.6148698540002277e-16,
+        7.961861200636829e-09, 4.4408920985006262e-16, 1.4130111222501992e-16, -1.6148698540002277e-16,
+        1.0092936587501423e-17, 1.7157992198752419e-16, 1.9681226345627775e-16, 1.1102230246251565e-16,
+        -3.44983243991883e-10, 2.0185873175002847e-17, 2.4223047810003414e-16, -1.4130111222501992e-16,
+        1.0092936587501423e-17, 1.0092936587501423e-16, 8.0743492700011387e-17, 4.0371746350005693e-17,
+        1.5401478072683197e-11, -8.5789960993762099e-16, -2.2204460492503131e-16, -6.0557619525008534e-17,
+        2.2204460492503131e-16, 1.0092936587501423e-16, -1.4130111222501992e-16, 4.794144879063176e-17,
+        -7.0801445514493111e-13, -5.6520444890007968e-16, -4.0371746350005693e-17, 7.0650556112509961e-17,
+        2.5736988298128631e-16, 2.6746281956878772e-16, 2.0185873175002846e-16, 7.6958641479698357e-17,
+        3.1434451001773181e-14, -6.106226635438361e-16, -1.2111523905001707e-16, -6.459479416000911e-16,
+        -4.0119422935318158e-16, -2.9521839518441663e-16, -2.3970724395315881e-16, -1.1354553660939101e-16,
+        5.9239827147826398, 1.1987334039009097, -0.55549970250346992, 0.51654427364209932,
+        -0.20568236502612239, 0.029077385449792215, -0.00074830412756965448, -6.4342470745321577e-16,
+        0.034522023214597346, -0.086087538969666907, -0.068316644840229937, 0.097795350776895662,
+        -0.05643928868026786, 0.017506298571763012, -0.0021013195985994733, 1.0092936587501423e-17,
+        -0.0069929225289370785, 0.0055543520504247705, 0.0069855576833856717, -0.0074554122257418746,
+        0.001644747141134071, 6.6442252991360078e-05, -2.7555025835512836e-05, 2.0185873175002847e-17,
+        -0.0013678316668267062, 0.0013081095800718508, 0.00081306412058005067, -0.0011382817149840907,
+        0.00051667283176182188, -0.00011470098056139259, 1.0127869468331854e-05, -1.5644051710627207e-16,
+        -3.6866584431936225e-05, 3.6108644759578404e-05, 2.1952990256393886e-05, -3.2046634416562434e-05,
+        1.6904946570240785e-05, -4.086045137271813e-06, 3.6078969500863423e-07, -3.532527805625498e-17,
+        -7.8791400071054341e-08, -1.1505947709751622e-15, -2.6241635127503701e-16, -6.0557619525008534e-17,
+        4.1381040008755832e-16, -2.2204460492503131e-16, -2.0185873175002846e-16, -4.1885686838130908e-16,
+        2.6456922713242129e-09, 4.0371746350005693e-17, -5.2483270255007403e-16, -2.0185873175002846e-16,
+        2.1195166833752989e-16, 3.4315984397504838e-16, 4.5418214643756407e-17, -2.4980018054066022e-16,
+        -9.4538690007730323e-11, -6.1566913183758685e-16, 3.1288103421254413e-16, -7.0650556112509961e-17,
+        3.3306690738754696e-16, 2.9269516103754126e-16, 1.5139404881252134e-17, -5.5511151231257827e-17,
+        3.4587484391708627e-12, 1.0092936587501423e-17, 8.2762080017511665e-16, 5.2483270255007403e-16,
+        3.8353159032505408e-16, -8.5789960993762094e-17, 8.0743492700011387e-17, -1.6401021954689813e-16,
+        -1.329088354525125e-13, -4.0371746350005691e-16, 8.4276020505636882e-16, -6.0557619525008534e-17,
+        3.7343865373755267e-16, 0, 1.4634758051877063e-16, 3.4442146104848604e-16,
+        3.8151300300755383e-15, -2.5232341468753557e-17, 1.6401021954689813e-16, -4.8446095620006827e-16,
+        2.7755575615628914e-17, -2.2709107321878203e-17, 8.9574812214075124e-17, 3.0215728908832386e-16,
+        5.8779602891915088, 1.1276341662016702, -0.6011371200055744, 0.60308401841253056,
+        -0.28252364790914059, 0.059478362689549889, -0.0047172528702174735, -1.0042471904563915e-15,
+        -0.097206048714255644, 0.030958088651955675, 0.032566107764431147, -0.025202153909651859,
+        -0.01388287015950959, 0.011420785251396287, -0.0017374872737668801, -3.6839218544380196e-16,
+        -0.026988937236834921, 0.024718096908258002, 0.018849814194952564, -0.024191269709568128,
+        0.0094676959930230249, -0.0017022298469267555, 0.00012861521850290628, -2.0690520004377916e-16,
+        -0.0019675729862285163, 0.001885847896230818, 0.0011643119646786791, -0.0016510278656544793,
+        0.00078715197688593687, -0.00018007770275734798, 1.5900504588631488e-05, 2.2204460492503131e-16,
+        -3.7971568068375447e-05, 3.6108644760264724e-05, 2.195299025627277e-05, -3.2046634417390052e-05,
+        1.6904946570180229e-05, -4.0860451365047501e-06, 3.6078969598764909e-07, 5.0969329766882186e-16,
+        -3.7812396738975712e-08, 1.2313382636751737e-15, 1.2111523905001707e-15, 1.4130111222501992e-16,
+        1.0092936587501423e-16, 1.5139404881252134e-16, -2.3213754151253272e-16, -3.7848512203130338e-16,
+        1.0474768224517045e-09, 1.6148698540002277e-16, 2.0185873175002847e-17, 8.0743492700011387e-17,
+        -1.4130111222501992e-16, -2.4223047810003414e-16, -6.0557619525008534e-16, -7.2921466844697784e-16,
+        -3.2143817910420836e-11, -9.386431026376324e-16, -1.8167285857502563e-16, -6.5604087818759251e-16,
+        -3.0278809762504267e-17, -3.3306690738754696e-16, -3.5325278056254979e-16, -3.582992488563005e-16,
+        9.9499701407394658e-13, -2.9269516103754126e-16, 5.0464682937507114e-17, -1.1203159612126581e-15,
+        -4.7436801961256686e-16, -7.0650556112509958e-16, -5.1473976596257261e-16, -1.9681226345627775e-16,
+        -3.4396727890204849e-14, -4.2894980496881049e-16, 2.1195166833752989e-16, -4.9455389278756969e-16,
+        2.4223047810003414e-16, 3.936245269125555e-16, 7.3930760503447925e-16, 9.4999765629857143e-16,
+        -1.0092936587501423e-16, 4.3147303911568582e-16, 6.3333177086571425e-16, -3.0278809762504267e-16,
+        -7.3173790259385314e-17, -3.4063660982817305e-16, -2.8260222445003984e-16, -3.7280784520083381e-16,
+        5.3855452880644332, 1.4658901986223662, -0.33674756213006551, 0.29025754021381861,
+        -0.20139029542079886, 0.061074621045773651, -0.0064898148739418607, -4.7184478546569153e-16,
+        -0.41793921237487319, 0.32904511431185723, 0.24522280897837409, -0.30669833369894195,
+        0.10424013814233701, -0.011952187533733465, 0.00015279349152101535, -6.8631968795009675e-16,
+        -0.054266319848776438, 0.050814701559995484, 0.034929044835705983, -0.047080081001428221,
+        0.020536394586405136, -0.0042554226131999492, 0.00035405708427838078, -1.261617073437678e-16,
+        -0.0025800544340169669, 0.0024635862123918643, 0.0015155598087789426, -0.0021637740163239797,
+        0.0010576311220099105, -0.00024545442495499896, 2.167313970760895e-05, 2.6241635127503701e-16,
+        -3.8534307705536975e-05, 3.6108644758952643e-05, 2.1952990256070912e-05, -3.2046634416542247e-05,
+        1.6904946571774911e-05, -4.0860451350917382e-06, 3.6078969727954496e-07, 1.27675647831893e-15,
+        -2.0693769556520438e-08, -1.7359850930502448e-15, -1.453382868600205e-15, -1.6956133467002392e-15,
+        -1.0193865953376437e-15, -8.0743492700011382e-16, -4.1381040008755832e-16, -1.6905668784064883e-16,
+        4.6634613342694763e-10, -1.2111523905001707e-15, -7.0650556112509958e-16, 1.4130111222501992e-16,
+        2.9269516103754126e-16, 2.0185873175002847e-17, 1.5139404881252134e-16, 5.6520444890007968e-16,
+        -1.2712633975811824e-11, 6.3585500501258968e-16, 9.7901484898763806e-16, 1.0193865953376437e-15,
+        1.8167285857502563e-16, 7.0650556112509961e-17, 3.7848512203130338e-16, 3.0026486347816734e-16,
+        3.424331525407483e-13, -2.1598884297253044e-15, -8.7808548311262382e-16, -1.4130111222501992e-16,
+        1.4079646539564485e-15, 2.4021189078253387e-15, 2.1195166833752987e-15, 1.0496654051001481e-15,
+        -1.3098108456429973e-14, -3.027880976250427e-15, -2.0993308102002961e-15, -2.0993308102002961e-15,
+        -2.0942843419065453e-15, -1.8722397369815139e-15, -5.576347464594536e-16, -3.4694469519536142e-16,
+        -1.2717100100251794e-15, -5.2987917084382469e-16, -4.3651950740943653e-16, -1.0648048099814002e-15,
+        -1.5366495954470918e-15, -1.9201811857721459e-15, -1.6981365808471144e-15, -1.4243656759111384e-15,
+        4.0100770832305734, 2.6310471755907914, 0.49493666137511422, -0.78815614162379577,
+        0.21481686993303128, -0.0069849237418968483, -0.0024589202863267408, 9.1088752702200349e-16,
+        -0.98642174085704049, 0.86363641636127464, 0.60337325183509027, -0.79591681905525313,
+        0.32389573415722145, -0.05888878511446128, 0.0041236956687718792, 2.2305389858378144e-15,
+        -0.088938238672497338, 0.083844166005630924, 0.055223249605641865, -0.076121846101323928,
+        0.034850842921283529, -0.0075931360458242232, 0.0006487705714954727, 1.8318679906315083e-15,
+        -0.0031994081719718304, 0.0030413245285472786, 0.0018668076528746238, -0.0026765201669964474,
+        0.0013281102671342374, -0.0003108311471523068, 2.7445774825133025e-05, -2.0438196589690383e-15,
+        -3.8859734799304412e-05, 3.6108644755298997e-05, 2.1952990251266673e-05, -3.2046634422315407e-05,
+        1.6904946568868144e-05, -4.0860451374030209e-06, 3.6078969437277924e-07, -9.7649161484076263e-16,
+        -1.2775251159976879e-08, -2.3011895419503244e-15, -7.4687730747510534e-16, -3.936245269125555e-16,
+        2.533327083462857e-15, 1.5946839808252248e-15, 2.8764869274379055e-16, -6.2576206842508827e-16,
+        2.2606765954174597e-10, -2.0892378736127944e-15, -6.5604087818759251e-16, 1.5946839808252248e-15,
+        3.4215055031629822e-15, 2.9168586737879113e-15, 3.6839218544380196e-16, -9.1088752702200349e-16,
+        -5.502623609291132e-12, -2.3718400980628344e-15, -2.62416351275037e-15, 2.0185873175002847e-17,
+        1.1203159612126581e-15, 3.007695103075424e-15, 2.0488661272627887e-15, 9.5125927337200914e-16,
+        1.4211359362031378e-13, 1.4937546149502107e-15, 1.766263902812749e-15, 2.8764869274379057e-15,
+        1.7612174345189983e-15, 1.0547118733938987e-15, -1.4155343563970746e-15, -2.1851207711940583e-15,
+        -3.333192308022345e-15, -1.4483364003064542e-15, -2.0387731906752874e-15, -2.2355854541315653e-15,
+        -4.9859106742257027e-15, -3.9816634837693118e-15, -2.6695817273941266e-15, -1.457167719820518e-15,
+        9.4116633678450763e-16, 6.2071560013133751e-16, -4.0371746350005691e-16, -2.3718400980628343e-16,
+        -1.9681226345627774e-15, -1.527818275933028e-15, -6.7874998550947067e-16, -1.8924256101565169e-16
+    };
+
+    constexpr FLOAT EnhancementTMin   = 273.16;
+    constexpr FLOAT EnhancementTMax   = 1073.15;
+    constexpr FLOAT EnhancementRhoMax = 1100;
+    constexpr FLOAT EnhancementScale  = 1;
+    constexpr int   EnhancementDegree = 5;
+
+    constexpr FLOAT CriticalTMin   = 645.096;
+    constexpr FLOAT CriticalTMax   = 650.096;
+    constexpr FLOAT CriticalRhoMin = 272;
+    constexpr FLOAT CriticalRhoMax = 362;
+
+    constexpr int LeafZero  = -1;
+    constexpr int LeafExact = -2;
+
+    struct Node
+    {
+        FLOAT splitT;
+        FLOAT splitRho;
+        int   child;
+        int   patch;
+    };
+
+    constexpr std::array<Node, 905> EnhancementTree { {
+        { 647.096, 322, 1, -1 },
+        { 460.12800000000004, 161, 5, -1 },
+        { 860.12300000000005, 161, 361, -1 },
+        { 460.12800000000004, 711, 549, -1 },
+        { 860.12300000000005, 711, 753, -1 },
+        { 366.64400000000001, 80.5, 9, -1 },
+        { 553.61200000000008, 80.5, 33, -1 },
+        { 0, 0, -1, -1 },
+        { 553.61200000000008, 241.5, 101, -1 },
+        { 0, 0, -1, -1 },
+        { 413.38600000000002, 40.25, 13, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 436.75700000000006, 20.125, 17, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 425.07150000000001, 10.0625, 21, -1 },
+        { 448.44250000000005, 10.0625, 29, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 430.91425000000004, 5.03125, 25, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 0 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 1 },
+        { 0, 0, -1, 2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 506.87000000000006, 40.25, 37, -1 },
+        { 0, 0, -1, 6 },
+        { 0, 0, -1, -1 },
+        { 600.35400000000004, 120.75, 45, -1 },
+        { 483.49900000000002, 20.125, 41, -1 },
+        { 0, 0, -1, 5 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 3 },
+        { 0, 0, -1, 4 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 100.625, 49, -1 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 140.875, 97, -1 },
+        { 0, 0, -1, 7 },
+        { 0, 0, -1, 8 },
+        { 612.03950000000009, 110.6875, 53, -1 },
+        { 0, 0, -1, 20 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 9 },
+        { 0, 0, -1, -1 },
+        { 617.88225000000011, 115.71875, 57, -1 },
+        { 0, 0, -1, -1 },
+        { 620.80362500000001, 113.203125, 61, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 10 },
+        { 0, 0, -1, -1 },
+        { 622.26431249999996, 114.4609375, 65, -1 },
+        { 0, 0, -1, -1 },
+        { 622.99465624999993, 113.83203125, 69, -1 },
+        { 0, 0, -1, -1 },
+        { 622.99465624999993, 115.08984375, 93, -1 },
+        { 622.62948437499995, 113.517578125, 73, -1 },
+        { 623.35982812499992, 113.517578125, 81, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 18 },
+        { 0, 0, -1, -1 },
+        { 622.81207031249994, 113.3603515625, 77, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 11 },
+        { 0, 0, -1, 12 },
+        { 623.17724218749993, 113.6748046875, 85, -1 },
+        { 623.54241406250003, 113.6748046875, 89, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 13 },
+        { 0, 0, -1, 14 },
+        { 0, 0, -1, 15 },
+        { 0, 0, -1, 16 },
+        { 0, 0, -1, 17 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 19 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 21 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 22 },
+        { 0, 0, -1, -1 },
+        { 600.35400000000004, 201.25, 105, -1 },
+        { 0, 0, -1, -1 },
+        { 600.35400000000004, 281.75, 141, -1 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 181.125, 109, -1 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 221.375, 117, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 23 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 191.1875, 113, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 24 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 25 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 211.3125, 121, -1 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 231.4375, 129, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 26 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 216.34375, 125, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 27 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 28 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 29 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 236.46875, 133, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 233.953125, 137, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 32 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 30 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 31 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 261.625, 145, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 251.5625, 149, -1 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 271.6875, 253, -1 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 246.53125, 153, -1 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 256.59375, 157, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 33 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 34 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 254.078125, 161, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 259.109375, 169, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 35 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 255.3359375, 165, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 36 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 37 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 38 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 260.3671875, 173, -1 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 259.73828125, 177, -1 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 260.99609375, 209, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 259.423828125, 181, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 260.052734375, 189, -1 },
+        { 0, 0, -1, 39 },
+        { 0, 0, -1, 40 },
+        { 646.54824218750002, 259.5810546875, 185, -1 },
+        { 0, 0, -1, 43 },
+        { 0, 0, -1, 41 },
+        { 0, 0, -1, 42 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 646.54824218750002, 259.8955078125, 193, -1 },
+        { 646.91341406250001, 259.8955078125, 197, -1 },
+        { 646.54824218750002, 260.2099609375, 201, -1 },
+        { 646.91341406250001, 260.2099609375, 205, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 44 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 260.681640625, 213, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 261.310546875, 233, -1 },
+        { 646.54824218750002, 260.5244140625, 217, -1 },
+        { 646.91341406250001, 260.5244140625, 221, -1 },
+        { 646.54824218750002, 260.8388671875, 225, -1 },
+        { 646.91341406250001, 260.8388671875, 229, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 45 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 46 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 47 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 48 },
+        { 0, 0, -1, -2 },
+        { 646.54824218750002, 261.1533203125, 237, -1 },
+        { 646.91341406250001, 261.1533203125, 241, -1 },
+        { 646.54824218750002, 261.4677734375, 245, -1 },
+        { 646.91341406250001, 261.4677734375, 249, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 49 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 50 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 51 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 52 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 266.65625, 257, -1 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 276.71875, 345, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 264.140625, 261, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 269.171875, 337, -1 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 262.8828125, 265, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 76 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 262.25390625, 269, -1 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 263.51171875, 313, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 261.939453125, 273, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 262.568359375, 293, -1 },
+        { 646.54824218750002, 261.7822265625, 277, -1 },
+        { 646.91341406250001, 261.7822265625, 281, -1 },
+        { 646.54824218750002, 262.0966796875, 285, -1 },
+        { 646.91341406250001, 262.0966796875, 289, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 53 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 54 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 55 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 56 },
+        { 0, 0, -1, -2 },
+        { 646.54824218750002, 262.4111328125, 297, -1 },
+        { 646.91341406250001, 262.4111328125, 301, -1 },
+        { 646.54824218750002, 262.7255859375, 305, -1 },
+        { 646.91341406250001, 262.7255859375, 309, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 57 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 58 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 59 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 60 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 61 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 62 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 63 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 263.197265625, 317, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 263.826171875, 329, -1 },
+        { 646.54824218750002, 263.0400390625, 321, -1 },
+        { 0, 0, -1, 66 },
+        { 646.54824218750002, 263.3544921875, 325, -1 },
+        { 0, 0, -1, 69 },
+        { 0, 0, -1, 64 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 65 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 67 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 68 },
+        { 0, 0, -1, -2 },
+        { 646.54824218750002, 263.6689453125, 333, -1 },
+        { 0, 0, -1, 73 },
+        { 0, 0, -1, 74 },
+        { 0, 0, -1, 75 },
+        { 0, 0, -1, 70 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 71 },
+        { 0, 0, -1, 72 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 77 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 270.4296875, 341, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 78 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 79 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 274.203125, 349, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 272.9453125, 353, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 272.31640625, 357, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 80 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 753.60950000000003, 80.5, 365, -1 },
+        { 966.63650000000007, 80.5, 373, -1 },
+        { 753.60950000000003, 241.5, 381, -1 },
+        { 966.63650000000007, 241.5, 489, -1 },
+        { 0, 0, -1, 81 },
+        { 0, 0, -1, 82 },
+        { 700.35275000000001, 120.75, 369, -1 },
+        { 0, 0, -1, 87 },
+        { 0, 0, -1, 83 },
+        { 0, 0, -1, 84 },
+        { 0, 0, -1, 85 },
+        { 0, 0, -1, 86 },
+        { 0, 0, -1, 88 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 89 },
+        { 1019.8932500000001, 120.75, 377, -1 },
+        { 0, 0, -1, 90 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 91 },
+        { 0, 0, -1, -1 },
+        { 700.35275000000001, 201.25, 385, -1 },
+        { 0, 0, -1, 108 },
+        { 700.35275000000001, 281.75, 405, -1 },
+        { 0, 0, -1, 172 },
+        { 673.72437500000001, 181.125, 389, -1 },
+        { 0, 0, -1, 96 },
+        { 673.72437500000001, 221.375, 393, -1 },
+        { 0, 0, -1, 107 },
+        { 0, 0, -1, 92 },
+        { 0, 0, -1, 93 },
+        { 0, 0, -1, 94 },
+        { 0, 0, -1, 95 },
+        { 660.41018750000001, 211.3125, 397, -1 },
+        { 0, 0, -1, 101 },
+        { 660.41018750000001, 231.4375, 401, -1 },
+        { 0, 0, -1, 106 },
+        { 0, 0, -1, 97 },
+        { 0, 0, -1, 98 },
+        { 0, 0, -1, 99 },
+        { 0, 0, -1, 100 },
+        { 0, 0, -1, 102 },
+        { 0, 0, -1, 103 },
+        { 0, 0, -1, 104 },
+        { 0, 0, -1, 105 },
+        { 673.72437500000001, 261.625, 409, -1 },
+        { 0, 0, -1, 148 },
+        { 673.72437500000001, 301.875, 461, -1 },
+        { 0, 0, -1, 171 },
+        { 660.41018750000001, 251.5625, 413, -1 },
+        { 0, 0, -1, 122 },
+        { 660.41018750000001, 271.6875, 429, -1 },
+        { 0, 0, -1, 147 },
+        { 653.75309375000006, 246.53125, 417, -1 },
+        { 0, 0, -1, 113 },
+        { 653.75309375000006, 256.59375, 421, -1 },
+        { 0, 0, -1, 121 },
+        { 0, 0, -1, 109 },
+        { 0, 0, -1, 110 },
+        { 0, 0, -1, 111 },
+        { 0, 0, -1, 112 },
+        { 0, 0, -1, 114 },
+        { 0, 0, -1, 115 },
+        { 650.42454687500003, 259.109375, 425, -1 },
+        { 0, 0, -1, 120 },
+        { 0, 0, -1, 116 },
+        { 0, 0, -1, 117 },
+        { 0, 0, -1, 118 },
+        { 0, 0, -1, 119 },
+        { 653.75309375000006, 266.65625, 433, -1 },
+        { 0, 0, -1, 136 },
+        { 653.75309375000006, 276.71875, 449, -1 },
+        { 0, 0, -1, 146 },
+        { 650.42454687500003, 264.140625, 437, -1 },
+        { 0, 0, -1, 130 },
+        { 650.42454687500003, 269.171875, 445, -1 },
+        { 0, 0, -1, 135 },
+        { 0, 0, -1, 123 },
+        { 0, 0, -1, 124 },
+        { 648.76027343750002, 265.3984375, 441, -1 },
+        { 0, 0, -1, 129 },
+        { 0, 0, -1, 125 },
+        { 0, 0, -1, 126 },
+        { 0, 0, -1, 127 },
+        { 0, 0, -1, 128 },
+        { 0, 0, -1, 131 },
+        { 0, 0, -1, 132 },
+        { 0, 0, -1, 133 },
+        { 0, 0, -1, 134 },
+        { 650.42454687500003, 274.203125, 453, -1 },
+        { 0, 0, -1, 143 },
+        { 0, 0, -1, 144 },
+        { 0, 0, -1, 145 },
+        { 648.76027343750002, 272.9453125, 457, -1 },
+        { 0, 0, -1, 140 },
+        { 0, 0, -1, 141 },
+        { 0, 0, -1, 142 },
+        { 0, 0, -1, 137 },
+        { 0, 0, -1, 138 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 139 },
+        { 660.41018750000001, 291.8125, 465, -1 },
+        { 0, 0, -1, 159 },
+        { 660.41018750000001, 311.9375, 477, -1 },
+        { 0, 0, -1, 170 },
+        { 653.75309375000006, 286.78125, 469, -1 },
+        { 0, 0, -1, 153 },
+        { 653.75309375000006, 296.84375, 473, -1 },
+        { 0, 0, -1, 158 },
+        { 0, 0, -1, 149 },
+        { 0, 0, -1, 150 },
+        { 0, 0, -1, 151 },
+        { 0, 0, -1, 152 },
+        { 0, 0, -1, 154 },
+        { 0, 0, -1, 155 },
+        { 0, 0, -1, 156 },
+        { 0, 0, -1, 157 },
+        { 653.75309375000006, 306.90625, 481, -1 },
+        { 0, 0, -1, 164 },
+        { 653.75309375000006, 316.96875, 485, -1 },
+        { 0, 0, -1, 169 },
+        { 0, 0, -1, 160 },
+        { 0, 0, -1, 161 },
+        { 0, 0, -1, 162 },
+        { 0, 0, -1, 163 },
+        { 0, 0, -1, 165 },
+        { 0, 0, -1, 166 },
+        { 0, 0, -1, 167 },
+        { 0, 0, -1, 168 },
+        { 0, 0, -1, 173 },
+        { 1019.8932500000001, 201.25, 493, -1 },
+        { 0, 0, -1, 178 },
+        { 1019.8932500000001, 281.75, 505, -1 },
+        { 0, 0, -1, 174 },
+        { 0, 0, -1, -1 },
+        { 993.26487500000007, 221.375, 497, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 175 },
+        { 0, 0, -1, -1 },
+        { 979.95068750000007, 231.4375, 501, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 176 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 177 },
+        { 0, 0, -1, -1 },
+        { 993.26487500000007, 261.625, 509, -1 },
+        { 0, 0, -1, -1 },
+        { 993.26487500000007, 301.875, 533, -1 },
+        { 0, 0, -1, -1 },
+        { 979.95068750000007, 251.5625, 513, -1 },
+        { 0, 0, -1, -1 },
+        { 979.95068750000007, 271.6875, 521, -1 },
+        { 0, 0, -1, -1 },
+        { 973.29359375000013, 246.53125, 517, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 181 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 179 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 180 },
+        { 0, 0, -1, -1 },
+        { 973.29359375000013, 266.65625, 525, -1 },
+        { 0, 0, -1, -1 },
+        { 973.29359375000013, 276.71875, 529, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 182 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 183 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 184 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 185 },
+        { 0, 0, -1, -1 },
+        { 979.95068750000007, 291.8125, 537, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 973.29359375000013, 286.78125, 541, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 969.9650468750001, 284.265625, 545, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 186 },
+        { 0, 0, -1, 187 },
+        { 0, 0, -1, 188 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 553.61200000000008, 516.5, 553, -1 },
+        { 366.64400000000001, 905.5, 693, -1 },
+        { 553.61200000000008, 905.5, 741, -1 },
+        { 0, 0, -1, -1 },
+        { 600.35400000000004, 419.25, 557, -1 },
+        { 0, 0, -1, -1 },
+        { 600.35400000000004, 613.75, 673, -1 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 370.625, 561, -1 },
+        { 0, 0, -1, -1 },
+        { 623.72500000000002, 467.875, 669, -1 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 346.3125, 565, -1 },
+        { 0, 0, -1, -1 },
+        { 635.41049999999996, 394.9375, 601, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 358.46875, 569, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 364.546875, 573, -1 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 361.5078125, 577, -1 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 367.5859375, 593, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 363.02734375, 581, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 362.267578125, 585, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 191 },
+        { 0, 0, -1, -1 },
+        { 646.91341406250001, 361.8876953125, 589, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 190 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 189 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 366.06640625, 597, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 194 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 192 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 193 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 382.78125, 605, -1 },
+        { 0, 0, -1, -1 },
+        { 641.25324999999998, 407.09375, 665, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 376.703125, 609, -1 },
+        { 0, 0, -1, -1 },
+        { 644.17462499999999, 388.859375, 661, -1 },
+        { 0, 0, -1, -1 },
+        { 645.63531250000005, 373.6640625, 613, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 205 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 195 },
+        { 0, 0, -1, -1 },
+        { 646.36565625000003, 375.18359375, 617, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 374.423828125, 621, -1 },
+        { 0, 0, -1, -1 },
+        { 646.73082812500002, 375.943359375, 641, -1 },
+        { 646.54824218750002, 374.0439453125, 625, -1 },
+        { 646.91341406250001, 374.0439453125, 629, -1 },
+        { 646.54824218750002, 374.8037109375, 633, -1 },
+        { 646.91341406250001, 374.8037109375, 637, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 196 },
+        { 0, 0, -1, 197 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 198 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 199 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 200 },
+        { 646.54824218750002, 375.5634765625, 645, -1 },
+        { 646.91341406250001, 375.5634765625, 649, -1 },
+        { 646.54824218750002, 376.3232421875, 653, -1 },
+        { 646.91341406250001, 376.3232421875, 657, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 201 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 202 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 203 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, 204 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 206 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 207 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 208 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 209 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 210 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 211 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 212 },
+        { 576.98300000000006, 662.375, 677, -1 },
+        { 0, 0, -1, 216 },
+        { 0, 0, -1, -1 },
+        { 588.66849999999999, 638.0625, 681, -1 },
+        { 565.29750000000013, 686.6875, 685, -1 },
+        { 0, 0, -1, 215 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 213 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 571.14025000000015, 698.84375, 689, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 214 },
+        { 0, 0, -1, -1 },
+        { 413.38600000000002, 808.25, 697, -1 },
+        { 0, 0, -1, -1 },
+        { 413.38600000000002, 1002.75, 733, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 436.75700000000006, 856.875, 701, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 425.07150000000001, 881.1875, 705, -1 },
+        { 0, 0, -1, 219 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 430.91425000000004, 893.34375, 709, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 433.83562500000005, 899.421875, 713, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 435.29631250000006, 902.4609375, 717, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 434.56596875000002, 903.98046875, 721, -1 },
+        { 0, 0, -1, 218 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 434.93114062500001, 904.740234375, 725, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 435.11372656250001, 905.1201171875, 729, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 217 },
+        { 0, 0, -1, -1 },
+        { 436.75700000000006, 954.125, 737, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 220 },
+        { 0, 0, -1, 221 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 222 },
+        { 0, 0, -1, 223 },
+        { 506.87000000000006, 1002.75, 745, -1 },
+        { 0, 0, -1, -1 },
+        { 483.49900000000002, 954.125, 749, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 224 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 753.60950000000003, 516.5, 757, -1 },
+        { 966.63650000000007, 516.5, 829, -1 },
+        { 753.60950000000003, 905.5, 869, -1 },
+        { 0, 0, -1, -1 },
+        { 700.35275000000001, 419.25, 761, -1 },
+        { 0, 0, -1, 270 },
+        { 0, 0, -1, 271 },
+        { 806.86625000000004, 613.75, 821, -1 },
+        { 673.72437500000001, 370.625, 765, -1 },
+        { 0, 0, -1, 261 },
+        { 673.72437500000001, 467.875, 813, -1 },
+        { 0, 0, -1, 269 },
+        { 660.41018750000001, 346.3125, 769, -1 },
+        { 0, 0, -1, 246 },
+        { 660.41018750000001, 394.9375, 797, -1 },
+        { 0, 0, -1, 260 },
+        { 653.75309375000006, 334.15625, 773, -1 },
+        { 0, 0, -1, 229 },
+        { 653.75309375000006, 358.46875, 777, -1 },
+        { 0, 0, -1, 245 },
+        { 0, 0, -1, 225 },
+        { 0, 0, -1, 226 },
+        { 0, 0, -1, 227 },
+        { 0, 0, -1, 228 },
+        { 0, 0, -1, 230 },
+        { 0, 0, -1, 231 },
+        { 650.42454687500003, 364.546875, 781, -1 },
+        { 0, 0, -1, 244 },
+        { 648.76027343750002, 361.5078125, 785, -1 },
+        { 0, 0, -1, 235 },
+        { 648.76027343750002, 367.5859375, 789, -1 },
+        { 0, 0, -1, 243 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 232 },
+        { 0, 0, -1, 233 },
+        { 0, 0, -1, 234 },
+        { 647.92813671875001, 366.06640625, 793, -1 },
+        { 0, 0, -1, 240 },
+        { 0, 0, -1, 241 },
+        { 0, 0, -1, 242 },
+        { 0, 0, -1, 236 },
+        { 0, 0, -1, 237 },
+        { 0, 0, -1, 238 },
+        { 0, 0, -1, 239 },
+        { 653.75309375000006, 382.78125, 801, -1 },
+        { 0, 0, -1, 254 },
+        { 653.75309375000006, 407.09375, 809, -1 },
+        { 0, 0, -1, 259 },
+        { 650.42454687500003, 376.703125, 805, -1 },
+        { 0, 0, -1, 251 },
+        { 0, 0, -1, 252 },
+        { 0, 0, -1, 253 },
+        { 0, 0, -1, 247 },
+        { 0, 0, -1, 248 },
+        { 0, 0, -1, 249 },
+        { 0, 0, -1, 250 },
+        { 0, 0, -1, 255 },
+        { 0, 0, -1, 256 },
+        { 0, 0, -1, 257 },
+        { 0, 0, -1, 258 },
+        { 660.41018750000001, 443.5625, 817, -1 },
+        { 0, 0, -1, 266 },
+        { 0, 0, -1, 267 },
+        { 0, 0, -1, 268 },
+        { 0, 0, -1, 262 },
+        { 0, 0, -1, 263 },
+        { 0, 0, -1, 264 },
+        { 0, 0, -1, 265 },
+        { 780.23787500000003, 565.125, 825, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 272 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 913.37975000000006, 419.25, 833, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 273 },
+        { 940.00812500000006, 370.625, 837, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 926.69393750000006, 346.3125, 841, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 920.03684375000012, 334.15625, 845, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 274 },
+        { 923.36539062500015, 328.078125, 849, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 921.70111718750013, 325.0390625, 853, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 275 },
+        { 922.53325390625014, 323.51953125, 857, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 922.11718554687513, 322.759765625, 861, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 276 },
+        { 922.32521972656264, 322.3798828125, 865, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -2 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 700.35275000000001, 808.25, 873, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 673.72437500000001, 759.625, 877, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 660.41018750000001, 735.3125, 881, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 277 },
+        { 667.06728124999995, 723.15625, 885, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 663.73873437499992, 717.078125, 889, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 662.07446093749991, 714.0390625, 893, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 661.2423242187499, 712.51953125, 897, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 660.8262558593749, 711.759765625, 901, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, 278 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+        { 0, 0, -1, -1 },
+    } };
+
+    constexpr std::array<FLOAT, 10044> Enhancement {
+        0.00064356925771229148, 0.00095741164207178769, 0.00039688132799723015, 0.00010535025630138379,
+        2.6710312342528235e-05, 4.5836062295109177e-06, -8.0989142244965908e-05, -0.00013102956080817538,
+        -7.1145584218526309e-05, -2.7934079173368312e-05, -8.1271062438082308e-06, -1.3429769960777613e-06,
+        4.5831455553094012e-06, 7.7359891677714635e-06, 4.6650862907726817e-06, 1.9998000088466403e-06,
+        5.6956605296412383e-07, 8.2173692370584881e-08, -9.4984956309042339e-08, -1.488900993381523e-07,
+        -6.5235019214866521e-08, -4.2494063791743924e-09, 1.1846875398152628e-08, 5.702154138293672e-09,
+        -4.6542772965092964e-08, -8.4647960853850019e-08, -6.2641745217721919e-08, -3.6256446064851338e-08,
+        -1.4885268511961326e-08, -3.4714873794051726e-09, 8.922086093116967e-09, 1.5883107209883321e-08,
+        1.1070278824566143e-08, 5.7528352478344717e-09, 1.9931785445498375e-09, 3.1729911090997653e-10,
+        0.012833513181304955, 0.021509061395916868, 0.012778433393565826, 0.005442491951608534,
+        0.0015717681820281745, 0.00023498406081047803, -0.010981916833433542, -0.018955904072810517,
+        -0.012091647267651762, -0.0055255768904256429, -0.0016575587278585869, -0.00025291359733345506,
+        0.0042940503665362386, 0.0074590410983482753, 0.0048340733166752229, 0.0022505811671059061,
+        0.0006863247323825218, 0.00010626749349331371, -0.0012955691218773659, -0.0022507503033951759,
+        -0.001458577053006253, -0.0006782208082564816, -0.00020613571752994326, -3.1723611052127687e-05,
+        0.0002214125079087798, 0.00038318316237511687, 0.00024542479867529268, 0.00011180722113824417,
+        3.296619981869464e-05, 4.8619581178730968e-06, -1.1338550018540313e-05, -1.9254287766822902e-05,
+        -1.1607999982248796e-05, -4.7084262482995625e-06, -1.1310765588290389e-06, -1.1221515054606601e-07,
+        0.0036235047205354985, 0.0057186767881517503, 0.0028760919997178201, 0.0010071505493481471,
+        0.00026465545986458986, 3.9006743819451052e-05, -0.0012053627100234014, -0.0020087066395033616,
+        -0.0011679302985086602, -0.00047438475533398503, -0.00012660951092415508, -1.6659140389364224e-05,
+        0.0002290824694685288, 0.00039598367914325149, 0.00025441732738369361, 0.00011911014424286584,
+        3.7909085786705111e-05, 6.6280243597425479e-06, 9.0564886877365559e-06, 1.8014603075765125e-05,
+        1.6284293327853735e-05, 1.165816798569294e-05, 5.6850200671659565e-06, 1.507754147070403e-06,
+        -1.2564907163378884e-06, -2.0606574356174136e-06, -1.0594368054315001e-06, -1.8148030568064751e-07,
+        1.5174948693130291e-07, 1.0179705768369199e-07, 2.8288289499475387e-06, 4.9900854183095839e-06,
+        3.3837810859076729e-06, 1.6962067993262463e-06, 5.7200732846086554e-07, 1.0084446396940794e-07,
+        0.31183454166236196, 0.53876135727186591, 0.34444976334531896, 0.15774714104789414,
+        0.047334393518787356, 0.0071995397502076473, -0.47402261507608107, -0.8219968739804473,
+        -0.52999161289313579, -0.24461028644029212, -0.073666026722199268, -0.011211288265502644,
+        0.24923938136224735, 0.43222680358422344, 0.27860196831532308, 0.12836761638991437,
+        0.038505171030100163, 0.0058207483271726602, -0.08535702235576241, -0.14776249454477394,
+        -0.094721950216862652, -0.04321874629647128, -0.012773163817166595, -0.0018903527955103144,
+        0.016236579120165028, 0.027979093099141369, 0.017683608119430184, 0.0078664132273116479,
+        0.0022352135676480898, 0.00031177195356300988, -0.0011298067847039734, -0.0019202606992964047,
+        -0.0011611493564582958, -0.00047400667190541798, -0.00011541646798303879, -1.1864655909699987e-05,
+        0.0099323525606698233, 0.015784227916268028, 0.0080876278427199858, 0.0028873492801433451,
+        0.00076544109497720379, 0.00011707012408419363, -0.0053707709985297697, -0.0089472452464580236,
+        -0.0051956531209764517, -0.0021061099243876681, -0.00056228237349605591, -7.4185404640975277e-05,
+        0.001041884846975778, 0.0017604360575311298, 0.0010532275447835248, 0.00043106996682141477,
+        0.00010893693167530909, 1.2323546285231034e-05, -0.00024500898175123837, -0.00042289173029932118,
+        -0.00026971993998450025, -0.00012333024781967155, -3.7257957776847069e-05, -5.706079111303921e-06,
+        0.00012360178959591544, 0.00021968775754320738, 0.00015277761856525763, 8.132585271538162e-05,
+        3.0803201131981116e-05, 6.9034621731354617e-06, -2.0021184485417774e-05, -3.4514322415074993e-05,
+        -2.1804330528885244e-05, -9.4912037451543906e-06, -2.4345108334600219e-06, -1.565251880346049e-07,
+        0.057594037230985488, 0.094400572709670436, 0.052453145854927323, 0.020178586790767814,
+        0.0052423016810821321, 0.00072081860712439971, -0.059009334475916927, -0.099303173064782937,
+        -0.059007922465427153, -0.024335818891793377, -0.0064809080658926382, -0.00085936779625643361,
+        0.021229815306890751, 0.036052646385653642, 0.021879475070348004, 0.0091784086016298283,
+        0.0024349715956675324, 0.00031520516057019791, -0.0056214566262188454, -0.0095454310411558062,
+        -0.0057772930795776606, -0.0023963651826012355, -0.00061957195461489394, -7.6896574177163704e-05,
+        0.000997408004695721, 0.0016799730297125243, 0.00099034759468098689, 0.00039004695381427562,
+        9.2085466514018967e-05, 9.5271914171132395e-06, -0.00010310635134065207, -0.0001741120705383573,
+        -0.00010443670115613043, -4.6251097700704021e-05, -1.6339034284800243e-05, -5.0489882687864579e-06,
+        0.11211566528805197, 0.18224320550521569, 0.098742379602146699, 0.036643725118869243,
+        0.0093121934647172264, 0.001331846417557563, -0.14463964806251764, -0.24101567428355955,
+        -0.13956225523814295, -0.056013055285100831, -0.014900950898646704, -0.0021223371206976283,
+        0.069571664184489623, 0.11752044620342174, 0.070430252592356121, 0.029205498356228002,
+        0.0077447151164066847, 0.00098275538108562885, -0.025528427469524693, -0.04312349969726368,
+        -0.025688293916028185, -0.010311864472656961, -0.0024694000828503187, -0.0002319017686544229,
+        0.0063641179105853847, 0.010588783127453018, 0.0059641702217406237, 0.0021214064415205976,
+        0.00039298743192728731, 4.1541239192635311e-05, -0.0008034155057455646, -0.001276998726098786,
+        -0.00061549892551574057, -0.00016194805655668723, -2.8283530752653063e-05, -1.4150854783988588e-05,
+        0.19658442793429026, 0.078333768398500328, 0.0042221728402539955, -0.00095968801820240453,
+        -0.00027201742959259646, -9.9777013388240248e-06, -0.077476056671085466, -0.03640165906396399,
+        0.00045124594919144107, 0.0018517604563489676, 0.00039993631409176273, -1.0090847921196153e-06,
+        0.011227904241957572, 0.0032000213838995293, -0.0022107263953351718, -0.00098199665922525312,
+        -0.00017201432697156393, 1.1330767413993522e-05, -0.00084890553964284935, 0.0010135561927509856,
+        0.00096202481403038413, 0.00030802868048653497, 5.1615634579357824e-05, -1.2498159575166398e-05,
+        -8.2465798106628262e-05, -0.00039622456006640041, -0.00020291773182712838, -6.5257194119491805e-05,
+        -8.4179103050294479e-06, 8.9620643733258379e-06, 2.2009963074670501e-05, 4.8481701532402508e-05,
+        2.0371792382615731e-05, 7.6959491266774002e-06, -7.1628243388190587e-07, -2.801361549236269e-06,
+        0.099624428493377201, 0.033191600725945285, 0.0019415126645482364, 4.7922033570171612e-05,
+        -2.1872101712689971e-06, -3.6458171619019891e-06, -0.026783139666681801, -0.010846434614905899,
+        -0.00099571568350167853, -8.6552194060581888e-05, -5.0946516527132484e-06, 9.7403546590755548e-07,
+        0.0026703794295601618, 0.0014715355916891189, 0.00025226235818605802, 2.8148663879955718e-05,
+        -1.764589771899004e-06, -1.0044888474324825e-06, -0.00030194411748177226, -0.00024914328847231581,
+        -5.0863556834100474e-05, -6.5413314395809894e-07, 1.9859552965560921e-06, 3.3342145244512318e-07,
+        4.2282829330979344e-05, 3.7272090770834966e-05, 3.2839078156737085e-06, -2.027647292644661e-06,
+        -6.1035915584571176e-07, -3.6538681726741704e-08, -4.6478265080345638e-06, -2.3276777892882931e-06,
+        1.1725613914562711e-06, 6.259573543367603e-07, 8.3810233295012978e-08, -7.4425909504395649e-09,
+        0.26007397576643543, 0.041389880232691113, 8.0085651268659651e-05, -0.00030402187969157628,
+        -4.7686181302649567e-05, -1.3751292883374652e-06, -0.051127005177016481, -0.0065255941248227953,
+        0.0013939111287882254, 0.00043407093173674608, 7.3266195968460819e-05, 2.2475423437168868e-06,
+        0.0025931706018908368, -0.0012491128707082699, -0.00072714014614747317, -0.00022750783094728302,
+        -4.3478795611257627e-05, -1.1382675169659912e-06, 0.0002518359306482534, 0.00055030226934910185,
+        0.00025301288571677872, 9.3248035175604128e-05, 1.777566652148238e-05, 2.5392297255147273e-07,
+        -8.544154565491887e-05, -0.00011912491273429648, -6.3558159955789394e-05, -2.4545000668172236e-05,
+        -4.3686571004255163e-06, -1.2387703254508638e-08, 9.487909629087603e-06, 1.3754220084465271e-05,
+        7.9866306517853912e-06, 3.031889395564292e-06, 4.967341186032137e-07, 0,
+        0.26919978706166536, 0.010012986099335403, 3.2257852631026214e-05, -1.1741838829715363e-06,
+        -9.5215248932253973e-09, 1.502986537087883e-10, -0.013192589187016929, -0.00045916424547558682,
+        6.9472291466531698e-06, 1.8686678426355736e-07, -1.9845269266286725e-09, 1.1105403561143433e-10,
+        0.00019248060653120327, -5.2350863933874449e-06, -4.7532032900722215e-07, 2.3435851144275071e-09,
+        -2.0176564856356377e-11, -1.012849068333456e-10, 4.3648671270730327e-07, 4.6449952645129242e-07,
+        1.0959673383688787e-09, -1.0255338980246919e-10, 8.4596189605833298e-11, 4.3398216789479411e-11,
+        -7.8288998295523932e-08, -2.9977514370937341e-09, 1.7891961110814394e-10, -8.0936433790708884e-11,
+        -1.0334286134687065e-11, -1.46364262273777e-11, 7.2871049564333382e-10, -1.5620259842473393e-10,
+        3.7543289415180334e-11, 5.9696722200381034e-12, -5.9510008889503708e-13, 3.1367782432088428e-12,
+        0.27191169288078465, 0.0012348228773471242, 4.5761860921024255e-07, -2.2361003499922215e-09,
+        -2.0198262266476179e-12, 6.0293183744616815e-15, -0.0016539352246210347, -6.9252684414813466e-06,
+        1.3684562359794095e-08, 4.2286606890683477e-11, -6.8296653933877369e-14, 3.8723319555521869e-15,
+        2.9534644407553365e-06, -1.0936291296087341e-08, -1.1062580206581529e-10, 1.0697060541449893e-13,
+        -3.3097220587352095e-15, -2.1891565100284381e-15, 1.0916814002471301e-09, 1.104087512561983e-10,
+        -1.8543316360116273e-14, -7.4956446595923068e-16, 3.9527102836196166e-16, -5.2535965767486915e-16,
+        -1.886116293537136e-11, -5.9513103238697237e-14, -1.6547602562367845e-15, 1.1379092394865132e-15,
+        1.1525058927192057e-15, -3.880782078136591e-16, 1.4114696779270953e-14, 1.9905698834270042e-15,
+        -2.0734481927277379e-16, -1.2842986476573953e-15, -7.9576154213994323e-16, 8.0875296490529797e-16,
+        0.26862748802340952, 0.001220889034856497, 4.8410205703928337e-07, -2.1506949765129374e-09,
+        -2.1606555566516999e-12, 7.5321869399430454e-15, -0.0016302602177224236, -7.0074744984719852e-06,
+        1.2798742248994981e-08, 4.3107305167042561e-11, -6.9703511901849365e-14, -1.5483280063994066e-16,
+        2.9647630018203115e-06, -9.6168580105305622e-09, -1.1079112933791403e-10, 9.3214385589785634e-14,
+        8.6025965056437413e-16, -1.6400737322252133e-16, 7.9209633939117327e-10, 1.0946422111240302e-10,
+        -9.6097100968948411e-17, -2.0439190861486545e-15, -9.4774866571852842e-18, -9.3904579526539708e-17,
+        -1.8584020847229186e-11, -6.7536434341696622e-14, 2.2651468255542141e-15, 3.7072588917649475e-16,
+        2.0364310660842497e-16, 4.0108470826748252e-16, 1.4687244073345718e-14, -1.1616096851930783e-15,
+        -1.0425650280018532e-16, -1.0964829569124221e-17, 1.3165486398368405e-17, -6.5266382100284077e-17,
+        0.27509066118139341, 0.00066730558642624088, 3.5015259223289915e-07, 1.234333261321054e-10,
+        7.1247577707024715e-14, -2.2632658936117959e-15, -0.00090297330454305988, -3.2098260590725585e-06,
+        -2.7698880389844635e-09, -1.9450785732063966e-12, -2.091908574263226e-14, 5.3197019886258529e-15,
+        1.2664975944392273e-06, 5.9799204399949212e-09, 7.5960184395835978e-12, 8.8325516462558412e-14,
+        1.1663471152698184e-14, -5.3257691967470121e-15, -1.6642510359982216e-09, -1.0201067677784824e-11,
+        -9.3992539697684718e-14, -4.8414270148819172e-14, -3.9769541067656594e-15, 3.6688867472413441e-15,
+        2.1316799085643821e-12, 3.4504891069034544e-14, 3.6862769920374778e-14, 2.1782802896881734e-14,
+        -1.2550602423149331e-15, -1.9175063320103826e-15, -8.9588143333660968e-16, -3.8111482622181009e-15,
+        -1.1913522111121517e-14, -5.6807264755879974e-15, 2.0127015938420755e-15, 1.6574148518775219e-15,
+        0.27158148642931412, 0.0010629445078282275, 0.00013812449982121628, -9.8188254512082595e-05,
+        -0.00010294397056617469, 1.3894914129943372e-05, -0.0008499190893177834, -4.1311998755082935e-05,
+        -1.192854161898624e-05, 8.9749107136140384e-06, 9.2168493341766479e-06, -1.3074214024107812e-06,
+        9.44963686194295e-07, 3.0827302887823523e-07, 9.2946483992212749e-08, -7.0700547951254981e-08,
+        -7.2316920220080216e-08, 1.0355568453113371e-08, -5.9551795982610145e-10, -1.0699449630747609e-09,
+        -3.2256046320073816e-10, 2.4695097847471729e-10, 2.5199995858410113e-10, -3.6286105978713295e-11,
+        1.637095081495105e-13, 1.9835168486933739e-12, 5.9212985723397702e-13, -4.5788451878230533e-13,
+        -4.6449967489821832e-13, 6.6642450186698418e-14, -8.7092473501455665e-16, -3.0403343495840047e-15,
+        1.90656205673681e-17, 2.5432294333596208e-15, 2.3849161199695192e-15, 1.3685994183084614e-15,
+        0.26988918536104267, 0.00098274641535390302, 0.00011499884453528947, -8.0794740602272813e-05,
+        -8.5079320139124401e-05, 1.1361549803153907e-05, -0.00084238792149118761, -3.8896635560642114e-05,
+        -1.1200292096302586e-05, 8.4210363907692021e-06, 8.6502841079772313e-06, -1.2263004494819787e-06,
+        9.3783260766664358e-07, 2.9562274284565121e-07, 8.9132345141449448e-08, -6.7780698121205286e-08,
+        -6.9337285062413645e-08, 9.9265378566351326e-09, -5.9303889025304269e-10, -1.0385314204397055e-09,
+        -3.1315836563080906e-10, 2.3971350854851264e-10, 2.4462766386916356e-10, -3.5222420242082539e-11,
+        1.4612922799086367e-13, 1.9453236639811276e-12, 5.8259581916546375e-13, -4.4723125422901018e-13,
+        -4.5564732062854641e-13, 6.5529472479061375e-14, 3.234887450608043e-16, -1.810618078256605e-15,
+        -4.1134322997473235e-16, -9.7864342773382137e-16, 8.639462176481715e-16, 1.856203401243051e-15,
+        0.27329478371819033, 0.00066093339035649859, 3.446721769975483e-07, 1.1976067729197362e-10,
+        5.7814237951671821e-14, 1.01753447194764e-15, -0.00089292063200874553, -3.1624703234750078e-06,
+        -2.7107738251681804e-09, -1.7765181293998806e-12, -1.3365842463315609e-15, -2.2828475185844232e-16,
+        1.2467294677376686e-06, 5.8595265094570869e-09, 7.2655315425953354e-12, 7.7041124515687801e-15,
+        -1.5454870270827324e-16, 4.2972885081184875e-16, -1.6305767466175364e-09, -9.8941353305275886e-12,
+        -1.6924400270879732e-14, 2.4072614726964874e-16, 9.9853815318298348e-18, 1.4592205684384748e-16,
+        2.0777532945452984e-12, 1.6846150406596715e-14, -3.5721521498269756e-16, 1.4243806697905263e-16,
+        6.2795327177859807e-17, 5.3176953220488995e-17, -2.5937667592909219e-15, -3.3751061745425625e-16,
+        5.1214619052088342e-16, -5.0734128705130109e-16, 2.6153599130145423e-16, -1.7168062575704286e-16,
+        0.27151885472403864, 0.00065465495307183397, 3.3930811533067052e-07, 1.1626559761317503e-10,
+        5.5061857522017623e-14, 7.5273584444710548e-16, -0.00088302450316643088, -3.116064602310539e-06,
+        -2.6534558273729094e-09, -1.7191626311236244e-12, -1.5670870822997001e-15, -7.6998653982380076e-16,
+        1.2273601374759313e-06, 5.7423562268261932e-09, 7.0643318275435165e-12, 6.8928576547938842e-15,
+        -3.1407873968627938e-16, -3.5844095905703964e-16, -1.5977788554832923e-09, -9.6352254791935805e-12,
+        -1.6389592058757315e-14, 8.7307627963857611e-17, -2.6432273428231631e-16, -2.564991532139622e-17,
+        2.0231578775138605e-12, 1.6260582113055879e-14, 4.3209896586688053e-16, 2.4185642634260488e-16,
+        3.3921015025390057e-16, 4.9198537580983837e-16, -2.7365838535365503e-15, 9.6414212299581225e-17,
+        1.3844126373486726e-16, -2.6987678524973329e-16, 2.2843453117778843e-16, -1.046518573738258e-16,
+        0.27755274778337669, 0.0026847557299433606, 5.6191471263722898e-06, 7.9322576227817987e-09,
+        1.2651580731380207e-11, -2.3776895914259735e-13, -0.0036564545772746343, -5.1870800643682039e-05,
+        -1.789139760472228e-07, -4.6183275470546204e-10, 3.880744161492485e-12, 4.7314660946490744e-13,
+        2.0588422242873868e-05, 3.8847927947669032e-07, 1.9279726081723554e-09, -1.6323574622064953e-12,
+        -3.298734264495728e-12, -2.4533273067540153e-13, -1.0871715864410554e-07, -2.6479316300872502e-09,
+        -1.0496258657661046e-11, 4.0922662079249114e-12, 1.4303968663657557e-12, 6.0804994391296441e-14,
+        5.5898270096986255e-10, 1.5063716950158404e-11, -2.0578367761798724e-12, -1.136621968869654e-12,
+        -3.8490877025646303e-13, 7.9297449445051429e-15, -2.688647496338401e-12, 2.4844702806382753e-13,
+        2.9513171756817242e-13, 1.4477520126734851e-13, 4.9528006751389076e-14, -8.9994748107372751e-15,
+        0.28296751633110395, 0.0027300935275991868, 5.716111126258595e-06, 8.532520278390011e-09,
+        1.023439161011459e-10, 4.7529844298848928e-12, -0.0037616442988318848, -5.3323779692881789e-05,
+        -1.848935600549437e-07, -1.0021352461138721e-09, -1.3065556602218633e-10, -6.7553749007809693e-12,
+        2.1380131636622875e-05, 4.0322798002874943e-07, 1.9520104100527635e-09, 2.1515717442873275e-10,
+        5.2643819602710748e-11, 2.2858518781703877e-12, -1.1372871184959243e-07, -2.3120459473825946e-09,
+        7.6533064895870716e-11, -3.6308060814556654e-11, -8.9815923444608764e-12, -2.31414253439812e-13,
+        5.0829666054706655e-10, -7.25742087499594e-11, -2.5827357859896917e-11, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.18336786391121623, 0.050982531612340017, 0.0024797295310062502, 9.5539550360067789e-05,
+        3.5672439876351489e-05, -1.0529631932382883e-06, -0.058989757784500933, -0.021910600532476596,
+        -0.001752957121939847, -0.00018470791492537794, -6.2508154192453773e-05, 1.8003122504319064e-05,
+        0.0079340151965579756, 0.0038878396944371958, 0.00049007361380354027, 0.00016227182515858446,
+        1.003452656366731e-05, -5.1992697803280856e-05, -0.0010991204975046825, -0.00060662391067189307,
+        -0.00016837441837917898, -4.3380769231816023e-05, 6.1384532858829984e-05, 5.0838051893305581e-05,
+        0.0001265080828523074, 7.4722901895230476e-05, 2.9267942003345688e-05, -3.0761947109835904e-05,
+        -3.551193601675114e-05, 8.6396521433279527e-06, -1.4645726726511987e-05, -1.6839169811844053e-05,
+        -5.9767863073149274e-06, 8.0124381993431567e-06, -1.1038934744775571e-05, -3.023275707973452e-05,
+        0.30955486717676584, 0.076350925625839325, 0.003887091849785976, 9.8301273256002047e-05,
+        -4.6789004053506603e-05, 1.4355261415513841e-05, -0.12319396686816152, -0.043800952126811878,
+        -0.0036582528727636984, -0.00014477514371036585, 7.4286471526260637e-05, -1.6458215721882805e-05,
+        0.021304408929543214, 0.0099094107390945933, 0.0011387550142586858, 4.0589466197569847e-05,
+        -7.6486429664459054e-05, 3.1178503116996271e-05, -0.0034948527503564893, -0.0019350442895935246,
+        -0.00027354173179548427, 2.5976895924713514e-05, 2.8857023597075782e-05, -1.4426374849131138e-05,
+        0.00050700807131385714, 0.00030987587104165063, 2.5679289532996312e-05, 1.9608941398539504e-06,
+        -3.0720394541284731e-05, 2.1667495975665419e-05, -6.1594549092493852e-05, -9.2210201331805184e-06,
+        -1.4790671252920277e-05, 1.235095022682023e-05, 2.2062830498003561e-06, -9.6607308264211451e-06,
+        0.50448281981761833, 0.12232841098598828, 0.0086192374813635151, 0.0013441588554420768,
+        0.00058064949992341281, 0.00014453962938567482, -0.25812035933784355, -0.097159595296101894,
+        -0.011272142459021365, -0.0022297339688768596, -0.0010022384268104777, -0.00025175748898814449,
+        0.058781540127345593, 0.030396452438183522, 0.0047356997885997171, 0.0012478987889464122,
+        0.00064197490904989722, 0.00016496878854638301, -0.012157267908041343, -0.0075769939819226393,
+        -0.0013522163043641964, -0.00049075215987145896, -0.00029755265988710522, -7.8430359055501049e-05,
+        0.0019665609060163167, 0.0013114572446865115, 0.00023499621150371971, 0.0001280714218918723,
+        9.1419569106384279e-05, 2.464513187754695e-05, -0.00017947423258240464, -0.00011437558484615046,
+        -1.7195470022605534e-05, -1.7274487978006253e-05, -1.4301546650549645e-05, -3.9255593870177914e-06,
+        0.82367299467956356, 0.23122809647332065, 0.027369733529708028, 0.0038006810213342223,
+        0.00047974294757810009, 4.262805230556854e-05, -0.54549025636589643, -0.24660821158455873,
+        -0.040295135258830765, -0.0059521902025728079, -0.00075799049926916816, -6.7662252761693835e-05,
+        0.1481067213095468, 0.089927803423904745, 0.017742401169267456, 0.0028208645980967806,
+        0.00037149351214592021, 3.3376497979713008e-05, -0.029128705021053768, -0.020866935930243129,
+        -0.0045932775357811206, -0.00077530262876150647, -0.00010579721521414844, -9.502981220120988e-06,
+        0.0029543900239842186, 0.0023267471458242989, 0.00054855296034731632, 9.6945479673602651e-05,
+        1.3631306043974606e-05, 1.2123048220377179e-06, 0, 0,
+        0, 0, 0, 0,
+        0.6807094337635452, 0.065229095305155277, 0.0027184836399254506, 0.00019026272872529234,
+        1.3628789988503644e-05, 9.1895839343295577e-07, -0.22833734500735026, -0.045986577980207007,
+        -0.0037110287777204608, -0.00029437815135526711, -2.1764876744091119e-05, -1.5104936208637683e-06,
+        0.041146470101942792, 0.013901783768655836, 0.001561406931915929, 0.00014350954634754489,
+        1.1534394995987782e-05, 8.4373608800195602e-07, -0.0075878500399057126, -0.0034157975065882422,
+        -0.00045976635899198562, -4.7293716905806437e-05, -4.105384118257038e-06, -3.1665361541160471e-07,
+        0.0011295277993987349, 0.00059312385760263797, 8.9090357419337131e-05, 9.9313660224403048e-06,
+        9.1579817956272903e-07, 7.3905097732916056e-08, -9.4050993141504727e-05, -5.3884720045337863e-05,
+        -8.6808111455293355e-06, -1.0236451176569129e-06, -9.8753661730659196e-08, -8.2620340573559037e-09,
+        0.84330898883124628, 0.10059861301578331, 0.0065914101495921909, 0.00046277448127988058,
+        2.4857258226308584e-05, 1.6106918978273539e-06, -0.36621578863856419, -0.09693405983979185,
+        -0.0097556098056419752, -0.00071999789090111525, -3.8566644596879403e-05, -2.5506662983880113e-06,
+        0.089509798132543492, 0.036971788230855084, 0.0045628458360343332, 0.00035176807501232076,
+        1.8188850645607152e-05, 1.2507392065874888e-06, -0.020789516285704392, -0.010617037513859666,
+        -0.0014487255751648173, -0.00011047008610278639, -4.9629603679850448e-06, -3.5541860039209451e-07,
+        0.0035935877814986818, 0.0020423358685645889, 0.00029149414243370122, 2.0593035432981863e-05,
+        6.1493965597012536e-07, 4.5637200077608333e-08, -0.00032879961134372408, -0.00019783535073275831,
+        -2.8513590262917658e-05, -1.7228115401708287e-06, 0, 0,
+        1.0592214737375683, 0.15460468048275841, 0.013175201806114742, 0.0012077147511217869,
+        9.2407297483734842e-05, 3.3691446449417958e-06, -0.56903292693306917, -0.17205660935857331,
+        -0.019563130392470946, -0.0018764864235513835, -0.00014601727142231704, -5.2595544067572131e-06,
+        0.15163350784049304, 0.064681041913274853, 0.0086118059796162719, 0.00088740857664782054,
+        7.1404712069362563e-05, 2.4580416917365127e-06, -0.030273219567241702, -0.015182783377405125,
+        -0.0022286483653818729, -0.00024395336771320866, -2.0230893158716672e-05, -6.3739413443124568e-07,
+        0.0030983628908529555, 0.0016992581261292365, 0.00026626641345328834, 3.0518886607258694e-05,
+        2.5869512565755633e-06, 7.0758814877885837e-08, 0, 0,
+        0, 0, 0, 0,
+        0.83925244877597205, 0.036001706989251273, 0.00088539749058563267, 3.5566390726051738e-05,
+        1.4491765399598808e-06, 5.7680641325374598e-08, -0.19970359102133828, -0.023603625683795006,
+        -0.0011516146168299884, -5.2917079213256012e-05, -2.2904503085070844e-06, -9.4123061312581546e-08,
+        0.031437046437342783, 0.006615856064948895, 0.00044869702975213231, 2.4575120203703414e-05,
+        1.1792686142819696e-06, 5.151238740383101e-08, -0.0053671486489602852, -0.0015116989046063264,
+        -0.00012424565364489303, -7.7481381719550746e-06, -4.0629294477926502e-07, -1.8858035382793118e-08,
+        0.00075132146654610947, 0.00024829529912906358, 2.2996516982519665e-05, 1.5686335362510102e-06,
+        8.8001212590700432e-08, 4.2962271212397007e-09, -5.9781677742175948e-05, -2.1687245876887655e-05,
+        -2.1667578767328324e-06, -1.5711767689866319e-07, -9.260702872204444e-09, -4.7011562056609776e-10,
+        0.92004038186202886, 0.045295756795271189, 0.0015001169216442714, 7.1088366893722903e-05,
+        3.0172083009290873e-06, 3.2583427387379641e-08, -0.25869152743607582, -0.03615881501848095,
+        -0.0020863901963169285, -0.00010974618392954088, -4.8432076809608246e-06, -4.6419710427892049e-08,
+        0.049483199010572215, 0.011804634299855472, 0.00090085495644623773, 5.4549697197370531e-05,
+        2.5626039298163077e-06, 1.4363016399314743e-08, -0.0097807898322960496, -0.0030245671034898189,
+        -0.00027247703165497321, -1.8330363522798979e-05, -9.0144535373271192e-07, 1.2833693760426819e-09,
+        0.0015138591468195201, 0.00053986802400000434, 5.3992229277847366e-05, 3.9065368336998304e-06,
+        1.9669133977474902e-07, -2.2638234097665347e-09, -0.00012884076397048726, -5.0002642671646132e-05,
+        -5.3501894729922101e-06, -4.0664037604267043e-07, -2.0563283621764215e-08, 5.008626423379001e-10,
+        1.8839682718521942, 0.43114517937593966, 0.048472829891888593, 0.0047989451541638863,
+        0.00038121688569031756, 1.6038110415678307e-05, -1.4848016056994202, -0.55305883950942381,
+        -0.070056464481605393, -0.0071018656075344582, -0.00056953868281247938, -2.3867280079574893e-05,
+        0.41589242280254979, 0.18901749138613402, 0.026139539228284402, 0.0027661968134455326,
+        0.00022631125860587519, 9.350117239280218e-06, -0.055297694072584426, -0.02783778472208806,
+        -0.0041056612632223164, -0.00045245403833982668, -3.7780844809623828e-05, -1.5186658161730472e-06,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.94466910069272869, 0.018015707920866441, 0.00016889018323515184, 6.0300789967275407e-05,
+        4.803792142665032e-05, 1.2684273041429648e-05, -0.15102292079964239, -0.0092627321118896183,
+        -0.00016605742713639697, -0.00010415264108566497, -8.4137213804828833e-05, -2.2220956735238726e-05,
+        0.018566219853354562, 0.0019631512894926115, 2.9346398617343201e-05, 6.7754076574027123e-05,
+        5.58644082827248e-05, 1.4760036357394603e-05, -0.0026386293632588193, -0.00032206034808572565,
+        5.0598509561792881e-06, -3.2283308001198577e-05, -2.699753675017892e-05, -7.1355686928977171e-06,
+        0.00033228005852845851, 3.0918803812458947e-05, -4.5301718881000396e-06, 1.0224021418727707e-05,
+        8.6222850881565441e-06, 2.2794627972449268e-06, -2.5991425834386293e-05, -1.4929195352832177e-07,
+        9.6717502125443192e-07, -1.6440063457651025e-06, -1.3932521809597091e-06, -3.6839067055139359e-07,
+        0.98275078413869121, 0.020089210471071355, 0.00027025942979966343, 5.7891121030972993e-06,
+        1.3097727445402158e-07, 2.9718144802906704e-09, -0.17204118795274539, -0.011779682856737186,
+        -0.00032376216312698941, -8.2978780494351658e-06, -2.034941182908269e-07, -4.7916539872310665e-09,
+        0.023441225418617918, 0.0029113994608560472, 0.00011428905330873151, 3.6140097460423513e-06,
+        1.0041996365187073e-07, 2.5477788670470428e-09, -0.003567270802665677, -0.00060069616544411453,
+        -2.9197789248799286e-05, -1.0720070781749478e-06, -3.306109643281027e-08, -9.0194281599031781e-10,
+        0.00045781220470958401, 9.1626940805534599e-05, 5.0833707429297587e-06, 2.0643915348617792e-07,
+        6.8826484716721411e-09, 1.9925927743958242e-10, -3.4332447149165665e-05, -7.6023052968036723e-06,
+        -4.5807564811137178e-07, -1.9896472413833908e-08, -7.0203422815097002e-10, -2.1294789106238193e-11,
+        1.4224131380933989, 0.11534914884444471, 0.0057292232696127543, 0.00028232519579802806,
+        1.2607777040411219e-05, 5.2160039578760518e-07, -0.69599204827582095, -0.12557958562837693,
+        -0.00788351820654766, -0.00040804087645072572, -1.8622099495641417e-05, -7.7881406846004515e-07,
+        0.15555157712682027, 0.037555389390551176, 0.0027103256459063531, 0.00015106304345651012,
+        7.1949788168499357e-06, 3.0874903436297294e-07, -0.018053234872914405, -0.0049935344926336578,
+        -0.00039437451586205323, -2.3379537438764202e-05, -1.1620777851820065e-06, -5.136621678743796e-08,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.7127525714562921, 0.1791738773281466, 0.010782948204168152, 0.00060366479338259406,
+        3.0375185131447268e-05, 1.4144411631039499e-06, -1.0302847312893031, -0.21480931398188266,
+        -0.015249021485124858, -0.00088499860225621139, -4.5237025563825858e-05, -2.1233401067586735e-06,
+        0.25985856356438286, 0.069047298555198561, 0.005485168614656334, 0.00033757460345553504,
+        1.7837492944225565e-05, 8.5394235745352104e-07, -0.032372355932985902, -0.0096874026209413221,
+        -0.00083191717811836896, -5.3944584995099966e-05, -2.9529122563387392e-06, -1.4478976461951654e-07,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        2.1862509114239459, 0.30269583978408465, 0.020743037228135076, 0.00096095070875634281,
+        8.3510824073446118e-06, 2.882833823907827e-07, -1.624353873497687, -0.39156634463805312,
+        -0.029885148326941526, -0.001407216770917689, -1.088939486415471e-05, -3.5772846871532485e-07,
+        0.45810918815744622, 0.13391843711580101, 0.011086600879518111, 0.00053231572645693291,
+        2.5868238790707792e-06, 9.0675931566254772e-08, -0.061014113707133326, -0.019709524405930674,
+        -0.0017275598064577476, -8.3388909924166486e-05, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.456785689839313, 0.063216896127928981, 0.0019079889855812744, 2.8958433987408547e-05,
+        6.9293501478371589e-07, 1.5356497306388978e-08, -0.58356333537091742, -0.070368231433995468,
+        -0.0027487614485937344, -4.0864577362459715e-05, -1.009434340563922e-06, -2.270626397525964e-08,
+        0.15122030600050762, 0.025753813883867098, 0.0011507642396224437, 1.4417914960489639e-05,
+        3.7745823524256434e-07, 8.7824639033764035e-09, -0.029566644929521501, -0.0058924436163617696,
+        -0.0002805557601936263, -2.1250717659178764e-06, -5.8706795667463784e-08, -1.4154347252617965e-09,
+        0.0029689458104364555, 0.00064513622960970878, 3.1333692951399779e-05, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1718585807482051, 0.012776095099241321, 0.00010499654520621516, 1.3229736310671359e-06,
+        1.8126776554689401e-08, 5.3741325904822547e-10, -0.17363017062410582, -0.0073575492736978974,
+        -0.00012194185064767111, -1.8827395441647522e-06, -2.8020893043126036e-08, -9.0521638694200732e-10,
+        0.02285699670326647, 0.0017484541690854956, 4.1869596574654079e-05, 8.0668350446540376e-07,
+        1.3679787668175625e-08, 5.4727825331266175e-10, -0.0033656531982891734, -0.00035026850470457516,
+        -1.0464619249135861e-05, -2.3548754393621896e-07, -4.4515759141683577e-09, -2.3736447040710092e-10,
+        0.00042136722643587381, 5.2338650134578137e-05, 1.7922328044354592e-06, 4.4749460312721951e-08,
+        9.1676487855813772e-10, 6.8791111829903178e-11, -3.1082291990931716e-05, -4.2822566931116516e-06,
+        -1.59611114424145e-07, -4.2675527969014437e-09, -9.2591816993314011e-11, -1.0342005036350209e-11,
+        1.1983047779886669, 0.013684924081294788, 0.00012279490782938322, 1.657697135064551e-06,
+        2.3905444601143396e-08, 5.256162911685868e-10, -0.18939818225661287, -0.0084317601149105706,
+        -0.00014751864538370405, -2.402990479119812e-06, -3.7310694166588085e-08, -8.7359723354846837e-10,
+        0.026722385775218061, 0.0021262176458416793, 5.3019417134671533e-05, 1.0637015215453024e-06,
+        1.8587940354682869e-08, 5.0826999116745687e-10, -0.004159798184169344, -0.00044663059394505779,
+        -1.3773389738072014e-05, -3.2017684145487705e-07, -6.1672570928370063e-09, -2.0776176131507161e-10,
+        0.00054227899059084274, 6.9103555888869555e-05, 2.429649912390338e-06, 6.238673958409438e-08,
+        1.2867955327454274e-09, 5.5965178820875251e-11, -4.1105925073264986e-05, -5.7925052259300047e-06,
+        -2.2106745572753866e-07, -6.0660580432799647e-09, -1.301581631234078e-10, -7.6833389463222787e-12,
+        1.6166685899849622, 0.072507101174037289, 0.0021923267480027831, 6.5677360782258345e-05,
+        1.7948256309340577e-06, 4.4201188326827531e-08, -0.6991652556556226, -0.078077814648811153,
+        -0.0029949702979800812, -9.4755809157685676e-05, -2.6474651131148128e-06, -6.5834538841428367e-08,
+        0.153387816656813, 0.023004819178672389, 0.0010212358659172883, 3.4931621739762046e-05,
+        1.0199247769751442e-06, 2.5929151062042346e-08, -0.017571668544240998, -0.0030272801519171479,
+        -0.00014757651399256543, -5.38143097138501e-06, -1.6415185484522371e-07, -4.2664768469885793e-09,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1881855738373905, 0.0028442198508511303, 4.1338551005369576e-06, 2.7761267488652839e-08,
+        3.8930898274457879e-08, 1.6748300384461278e-08, -0.047468240752909743, -0.00046889051837807491,
+        -1.5855302776706829e-06, -3.8750931062054112e-08, -6.9819305077556129e-08, -3.004575162169621e-08,
+        0.0017768213870037466, 3.3150123484681498e-05, 9.8062376832289183e-08, 2.4495300833600224e-08,
+        4.9902594971102148e-08, 2.1478968651065294e-08, -8.2925971367724181e-05, -2.1534061099613062e-06,
+        3.5355239246911588e-08, -1.3055719412924769e-08, -2.7413319029131562e-08, -1.1798865870409272e-08,
+        4.1436750385598431e-06, 9.5997232602791848e-08, -1.9373914709273558e-08, 5.0340111125480429e-09,
+        1.0639777809572402e-08, 4.579284725997183e-09, -1.7808107980860443e-07, 3.785096560697925e-09,
+        4.3856544303139627e-09, -1.0779859103239091e-09, -2.2827280660726287e-09, -9.8220152731910512e-10,
+        1.104947630737924, 0.0021079765314784967, 1.8432433937729133e-06, 2.4636887499137393e-09,
+        4.6241797763871464e-12, 1.5346724165629413e-12, -0.036348518882658859, -0.00028157263574311094,
+        -7.4759436497648789e-07, -1.7006611375837274e-09, -3.1386630496342719e-12, -7.7298605726451316e-13,
+        0.0010774222375770396, 1.5955262773348642e-05, 7.0065417357455729e-08, 2.3928907353184015e-10,
+        1.2373581638502961e-13, -7.5092940843726749e-14, -3.9922599414870294e-05, -8.7155176236054442e-07,
+        -5.3563118032180083e-09, -2.3991144758866545e-11, 4.1631787127061453e-13, 5.4015987622109844e-13,
+        1.6276447162717657e-06, 4.7001433882188137e-08, 3.711341936967706e-10, 1.0757839963961833e-12,
+        -7.1365184894907233e-13, -9.933255975059356e-13, -7.005395064605072e-08, -2.5179299109014999e-09,
+        -2.5207695345323284e-11, -4.6653385497343811e-13, -7.5735843505914715e-13, -2.4531659924146605e-13,
+        1.2160722892005242, 0.0015501394824226316, 1.2801108022825368e-06, 1.9610960493082327e-09,
+        -1.1424910341476882e-09, 4.3913532128679068e-10, -0.025934939453549591, -0.0001374162742895524,
+        -2.716974818665858e-07, -1.1346491381765714e-09, 1.7783668658825497e-09, -6.7825275865609651e-10,
+        0.0005184461761874727, 5.1651847684879104e-06, 1.5279589802694574e-08, 3.181247863797506e-10,
+        -7.9366022551856066e-10, 2.9685625915436725e-10, -1.0998599577820168e-05, -1.5352243012514765e-07,
+        -4.5495343857088955e-10, -5.4246629525072577e-11, 1.5864307951372541e-10, -5.6272965373491494e-11,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1679442534004543, 0.0013110149069129335, 8.4053430889127611e-07, 8.0727475005101689e-10,
+        6.1519737526291565e-13, 4.1643849185277562e-13, -0.022296185750341122, -0.00010311951120405321,
+        -1.7282404822633808e-07, -2.5984767295205452e-10, -7.4044797334635143e-13, 1.9480897660956879e-13,
+        0.00039537258175562925, 3.4828294630293118e-06, 9.4340542624221751e-09, 2.0931531411182753e-11,
+        -2.8950781121658298e-13, 3.8169524463674853e-13, -8.765946752956758e-06, -1.1382474082955762e-07,
+        -4.2738389699686105e-10, -1.3028268022958864e-12, -7.5290457712267106e-14, -1.2403356093716781e-13,
+        2.1401977752887328e-07, 3.6768699021525592e-09, 1.7490700810648128e-11, 2.7523725341079537e-13,
+        -1.9407392287900811e-13, 2.6204824735421144e-13, -5.5206473643140887e-09, -1.1803227551392169e-10,
+        -8.0367128393362632e-13, -2.0156941591760238e-14, -5.5280819560044413e-14, 8.0725775735024491e-14,
+        1.1091784240495617, 0.0021228417166864761, 1.8731640147576841e-06, 2.5256364835548881e-09,
+        4.1353305554806037e-12, 5.7450918265056347e-13, -0.036917710215716784, -0.0002876359925293654,
+        -7.6834878720234512e-07, -1.7600243479032155e-09, -4.182835038069643e-12, -6.3528295767347785e-13,
+        0.0011099025228181964, 1.6527473501717639e-05, 7.3006729633094934e-08, 2.5153367652669354e-10,
+        4.2605860974349171e-13, 5.2960296292797295e-13, -4.1709509201254577e-05, -9.1561022836186689e-07,
+        -5.6602119498567626e-09, -2.5993068971929254e-11, 8.2742423916777928e-14, 1.6261161863331433e-14,
+        1.7247075271871137e-06, 5.0082702699129973e-08, 3.9783431784325686e-10, 2.4332845211332357e-12,
+        -7.0320143067542198e-13, 1.38030782058894e-13, -7.5290205580201631e-08, -2.7207428881718842e-09,
+        -2.6216523250439167e-11, -3.1069089375134587e-14, 3.5481649936039117e-13, 2.3608536062616248e-13,
+        1.1376202653397991, 0.0011517040758494195, 5.8266235401747722e-07, 4.4472965988047096e-10,
+        1.8936603613711966e-13, 9.5976085857011584e-13, -0.020325162829705559, -8.4604439956437145e-05,
+        -1.2279891124611573e-07, -1.545898072142039e-10, -3.6774014468100075e-13, 4.6776501168856337e-13,
+        0.00033283833598732646, 2.6436895550731317e-06, 6.3003723630864561e-09, 1.1588898038846016e-11,
+        4.6840444941937479e-13, -2.1515615507589676e-13, -6.8121789761510223e-06, -7.9765108150428612e-08,
+        -2.6499710214963828e-10, -4.3629949175244862e-13, 3.3338304149964664e-13, 1.1079559821122804e-13,
+        1.5344829495035677e-07, 2.3770123714170744e-09, 1.0347169946722292e-11, 1.9735276611821232e-13,
+        9.4415225772710409e-14, 1.6297373354444435e-13, -3.650951022093222e-09, -7.0555234295624103e-11,
+        -8.0503684703436179e-13, -1.7870749481719082e-13, -5.2534033791969132e-13, -1.800356295585265e-13,
+        1.1399283517273811, 0.0011563867825027008, 5.8802456626981196e-07, 4.5107634100667063e-10,
+        3.7440739784752772e-14, 1.0975636506894927e-12, -0.02049536003077863, -8.5594326680462813e-05,
+        -1.2467807704115944e-07, -1.5799692504247004e-10, -3.1480977982542578e-13, 9.2350120745550949e-14,
+        0.00033817656737919569, 2.694661403818001e-06, 6.4432576502612464e-09, 1.2123909934444265e-11,
+        -1.6498966850109305e-13, -9.3989173208929308e-14, -6.9738565694627465e-06, -8.1919661749055054e-08,
+        -2.7294776620142436e-10, -1.2002493418425002e-12, 3.9192248385484519e-13, -5.8328509369772225e-13,
+        1.5828480996741641e-07, 2.4586817716715569e-09, 1.1323197596969509e-11, -9.7125652553136242e-13,
+        7.6109853983071832e-13, -9.6060710801381708e-13, -3.794433669492938e-09, -7.325128414955199e-11,
+        -2.1996410404961225e-13, 2.4251039280067491e-13, 1.0787850313016503e-13, 2.908676304791438e-13,
+        1.1422458466662395, 0.0011611126900986713, 5.9346312213861786e-07, 4.5739129729075944e-10,
+        3.4207802379908714e-13, 1.047813359213245e-12, -0.020667552153427238, -8.6599392301751633e-05,
+        -1.2659367540973341e-07, -1.6087951880091578e-10, 2.1819244529804874e-14, 3.8164003738443215e-13,
+        0.00034361790318380905, 2.7467968081068523e-06, 6.5918043793490787e-09, 1.2648617625177856e-11,
+        9.1850449178956311e-13, 3.5371095062554368e-13, -7.1399074564807149e-06, -8.4138440638196302e-08,
+        -2.8118159165737077e-10, -3.2871281896454985e-13, 4.6614667853448186e-13, 3.4484532741737477e-13,
+        1.6328978920452646e-07, 2.5467130456230039e-09, 1.1781690239199665e-11, 1.1605240524038518e-12,
+        8.396462540822977e-13, 1.0953400828997323e-12, -3.9443137292967996e-09, -7.6525832634077655e-11,
+        -9.9947615021221078e-14, -3.4727489713128326e-14, 3.1922269195726769e-13, 1.0924228044027728e-13,
+        1.1445728371703834, 0.0011658824122369339, 5.9897874339501061e-07, 4.6375443022946405e-10,
+        4.276546344344893e-13, 8.62179879582675e-13, -0.020841769852519714, -8.7619933782463844e-05,
+        -1.2854688196417627e-07, -1.6414283899604929e-10, -1.0876102292607276e-13, 2.5801934614328627e-13,
+        0.00034916469922011362, 2.8001259729027536e-06, 6.7419263135987034e-09, 1.256952191049099e-11,
+        -2.2148254628015444e-13, -1.4908009489554232e-13, -7.310466041086325e-06, -8.6426675841843159e-08,
+        -2.9072357770378041e-10, -8.6954506761863144e-13, -3.3933351377252058e-13, -1.5875900601221173e-13,
+        1.6846949887747553e-07, 2.6343288371854354e-09, 1.142688896248002e-11, -4.8906660658148204e-13,
+        3.5139705288437068e-14, -5.6935842579416771e-13, -4.1005355686371475e-09, -7.9724893332631565e-11,
+        1.2866023144639894e-13, 1.1410335180366642e-13, 5.226689054092003e-13, 1.3509182236419544e-13,
+        1.1469094114926695, 0.0011706965748207469, 6.045723809585645e-07, 4.708567979502549e-10,
+        -6.1231989262179087e-13, 1.2915428905397343e-12, -0.021018044381240848, -8.8656254714384119e-05,
+        -1.3053867664531612e-07, -1.6804243616571484e-10, -1.7215831616465241e-13, -4.9907368318091492e-13,
+        0.00035481937899445965, 2.8546811636412365e-06, 6.898783710142892e-09, 1.2004316179096841e-11,
+        1.3069265079478847e-12, -1.1591312315916066e-12, -7.4856696170181709e-06, -8.8784549234029541e-08,
+        -2.99364472786693e-10, -6.5171601770697563e-13, -2.5853509661017597e-14, 3.9565907932790383e-14,
+        1.7383121577857196e-07, 2.7278497966909283e-09, 1.1182663503748812e-11, 3.6079528620124661e-13,
+        -5.9562802991496385e-13, 2.6541454719575107e-13, -4.2635855788437164e-09, -8.3279619443339885e-11,
+        1.4894050567797897e-13, -3.0380317954276019e-15, 5.3058437871186925e-13, 9.5461243989210864e-14,
+        1.149255659150767, 0.0011755558149548068, 6.1024832835608754e-07, 4.7792721491645995e-10,
+        3.1050169551743088e-13, 1.6408584302436373e-12, -0.021196407607337937, -8.9708663406402298e-05,
+        -1.3257062829096749e-07, -1.7067398373454553e-10, -1.3774461388762164e-12, 1.7251304907090541e-13,
+        0.00036058442488874794, 2.910498489212484e-06, 7.0556881660525841e-09, 1.3996807278281128e-11,
+        -1.2913317526007777e-12, 6.4281083602467364e-13, -7.6656619110125375e-06, -9.1215322776193428e-08,
+        -3.0832801720273426e-10, -5.4152492612614917e-13, 1.8625370203182729e-13, 1.5779938589676089e-13,
+        1.7938215326893901e-07, 2.8236624971798114e-09, 1.1595242205845397e-11, -2.0243120266050064e-13,
+        -7.8519583266092854e-13, -2.274468349388761e-13, -4.4336775439642847e-09, -8.675426759958816e-11,
+        2.5076049951088475e-13, 2.5868314531922274e-14, 6.1433123235146628e-13, 1.1343497000168986e-13,
+        1.1516116709479876, 0.0011804607822224467, 6.1600569476883721e-07, 4.8406595924870169e-10,
+        5.2756265575490337e-13, 8.509025806816409e-13, -0.021376892024327458, -9.077748002242528e-05,
+        -1.3464062310925923e-07, -1.7444345180824343e-10, -2.8729195060088789e-13, -1.6002869286236745e-13,
+        0.00036646239363134325, 2.9676073061557467e-06, 7.220126613562111e-09, 1.4066449584038969e-11,
+        -7.3774778587382229e-13, 2.1413831515840306e-13, -7.8505913490788974e-06, -9.3722223653561317e-08,
+        -3.1831070137396548e-10, -1.3263923690964547e-12, -1.9916181031056896e-13, -4.6398313620253157e-13,
+        1.8512965174526845e-07, 2.9237510321385421e-09, 1.2211763714811827e-11, -1.3594840963574653e-13,
+        -5.0443719027672153e-13, -2.1675501108005214e-13, -4.6112762794887856e-09, -8.9917874315374304e-11,
+        1.2498452127402928e-13, 7.6763171055045496e-13, 4.2687240414434804e-13, 8.7529760430526309e-13,
+        1.1539775390026248, 0.0011854121424428048, 6.2184576289888429e-07, 4.9155086243681756e-10,
+        -4.2104997565248045e-13, 1.250332425606393e-12, -0.021559530773741238, -9.18630281079591e-05,
+        -1.3675400702266611e-07, -1.7667058882171013e-10, -1.4711394087558261e-12, 1.0632243246784144e-12,
+        0.00037245590592775219, 3.026045525463921e-06, 7.3892303724783277e-09, 1.4735788475179548e-11,
+        -2.1390573904486654e-14, 4.7539728178847763e-13, -8.040610893812652e-06, -9.6305607800464895e-08,
+        -3.2858632286820493e-10, -6.0502789924221006e-13, -5.9655723751317244e-13, 2.4937634056547571e-13,
+        1.9108117747059795e-07, 3.0280701233450233e-09, 1.2922180830569874e-11, 2.700344619982402e-13,
+        -3.0953679756292698e-13, 1.6110391141140454e-13, -4.7966855026832992e-09, -9.5339972674763111e-11,
+        -3.0928549497864342e-13, -7.5489690083584084e-13, 2.2833273693507539e-13, -7.7550679459093013e-13,
+        1.1563533567752156, 0.0011904105706238989, 6.2777276815792892e-07, 4.9838985560084575e-10,
+        1.1988777984689826e-13, 9.9213011690352971e-13, -0.021744357651620638, -9.2965644199774757e-05,
+        -1.3890698944848796e-07, -1.8059944629473736e-10, 2.2834846163960948e-13, 7.2812240895808149e-13,
+        0.00037856765517419507, 3.0858481192067518e-06, 7.5627858891511714e-09, 1.4773029111635832e-11,
+        6.1123885565633027e-13, 2.0700011514439528e-13, -8.2358788765907244e-06, -9.8970234358254445e-08,
+        -3.3847886373619625e-10, -3.331896045114325e-13, -2.3827062580968063e-13, 5.6767830178133909e-13,
+        1.9724442300416268e-07, 3.1362408293874497e-09, 1.3339456705799572e-11, 4.9103675535090187e-13,
+        -3.0751341093568365e-13, 3.7331842104560635e-13, -4.9901687265000324e-09, -9.8644242956314984e-11,
+        -4.8159194278561624e-13, 1.151460251736441e-14, -4.8557427943397652e-14, 9.5867346993331655e-14,
+        1.1587392190911596, 0.001195456759446225, 6.3378648462394455e-07, 5.0677830793041458e-10,
+        2.5394631486409525e-13, 1.9438567756200768e-12, -0.02193140713448995, -9.4085669292673696e-05,
+        -1.4110469460658194e-07, -1.8478853230845435e-10, 1.7269554642426506e-13, 1.6925024063522904e-13,
+        0.00038480040806696951, 3.1470527298793073e-06, 7.7400678368693278e-09, 1.4581536128096813e-11,
+        3.2378274380263924e-13, -4.0820171130125762e-13, -8.4365601258700874e-06, -1.0171863386074434e-07,
+        -3.4948642454277452e-10, -4.1725219281664817e-13, -6.370150554987516e-13, 5.315423004839785e-13,
+        2.0362819797497534e-07, 3.2480676735675089e-09, 1.4214542011630324e-11, -1.2506544529870575e-13,
+        -2.9914140148000695e-14, -1.1204136044747892e-13, -5.1919316935561481e-09, -1.0328037542575307e-10,
+        -4.9791640239296465e-13, -2.0583400186338072e-13, 7.5472082575355193e-14, -1.9263511957343079e-13,
+        1.1611352221727771, 0.0012005514101961325, 6.398895357406085e-07, 5.1311049888759495e-10,
+        6.706718092398786e-13, 8.7784378736739391e-13, -0.02212071438923045, -9.5223453472784625e-05,
+        -1.4334807621578173e-07, -1.891240202444911e-10, -1.0233412533298914e-12, -4.5435703272256516e-13,
+        0.00039115700822264809, 3.2096995377283199e-06, 7.9226312286651673e-09, 1.5839285138287413e-11,
+        2.3506385644004799e-13, 3.8532094196704143e-13, -8.6428239680021398e-06, -1.045533106783557e-07,
+        -3.6047931626261214e-10, -1.5791888491533966e-13, -5.8965924303384435e-13, 7.721307785029026e-13,
+        2.1024066514037055e-07, 3.3650675312355065e-09, 1.4580527146799837e-11, 2.153383603732614e-13,
+        -4.3212921319890759e-13, 9.3194221005801304e-14, -5.4026078888949361e-09, -1.0758440400999952e-10,
+        -4.8388875034450261e-13, 3.0646065018141014e-14, 6.8468177399354918e-14, 1.31409392682146e-13,
+        1.1635414636648937, 0.0012056952459507694, 6.4608258674844158e-07, 5.2164548306913556e-10,
+        3.100120886125865e-13, 1.6899570127723691e-12, -0.022312315291234633, -9.6379354570168046e-05,
+        -1.4563588224428826e-07, -1.9200800765753312e-10, -1.1566916830795985e-12, 5.8944067763325571e-13,
+        0.0003976403773931991, 3.2738260457874139e-06, 8.110963056355263e-09, 1.5858282121342162e-11,
+        1.1117641071530702e-12, 1.0866670802706342e-13, -8.8548465044813642e-06, -1.0747895086944652e-07,
+        -3.7131753090137129e-10, -1.544249653164787e-12, 6.1488870464745879e-14, -6.2838120267970509e-13,
+        2.1709163393876261e-07, 3.4856957894264856e-09, 1.578933207650125e-11, -4.8671553340092517e-13,
+        2.4302184836877895e-13, -4.5971231897483964e-13, -5.6225068166610132e-09, -1.1309899380809083e-10,
+        -2.6329286651799753e-13, -7.954772952503146e-13, 3.086839156079096e-13, -6.8230125963519581e-13,
+        1.1659580426670177, 0.0012108889977022826, 6.5236920364339826e-07, 5.2945907197645186e-10,
+        7.8694103115317258e-13, 1.6825862966547409e-12, -0.022506246444229386, -9.755374456057016e-05,
+        -1.479685123913221e-07, -1.9727409979706912e-10, 3.5187540267223765e-13, -8.0316659918894724e-13,
+        0.00040425351661719903, 3.339473914563938e-06, 8.3030938239568679e-09, 1.5846853867630315e-11,
+        1.9714220969572032e-13, -3.4046194941295542e-13, -9.0728106428054835e-06, -1.1049480294065725e-07,
+        -3.8373143489114728e-10, -3.3540145070164863e-13, -6.3583499896073469e-13, 5.6469933170298511e-13,
+        2.2419002763819522e-07, 3.612354695150435e-09, 1.6707022764280451e-11, -2.7841056511048543e-14,
+        6.8243987960325021e-13, -8.0668878283126317e-14, -5.8528162853987349e-09, -1.1798373436776948e-10,
+        -1.3708483277783922e-12, -6.823191825861468e-13, -8.5067607313899006e-13, -5.6366292456125047e-13,
+        1.2790581750279759, 0.0017761282204530244, 1.7755491712884964e-06, 3.0706097475751009e-08,
+        1.172930173633428e-08, 2.8951966605798297e-09, -0.03207424091275507, -0.00018967643290553084,
+        -5.0599247246969429e-07, -4.3949885616803615e-08, -1.7878157828496683e-08, -4.4306672387808442e-09,
+        0.00077221340375775694, 8.5789692851811251e-06, 6.2666821738733565e-08, 1.8072953938574452e-08,
+        7.5100442893721105e-09, 1.8851027854769014e-09, -1.9181819232545471e-05, -3.0267909904631922e-07,
+        -7.2010949445375382e-09, -3.2267481849045656e-09, -1.3592530775497408e-09, -3.4966970234813265e-10,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.168385059759552, 0.0012161334150450737, 6.5874989641057845e-07, 5.3704054660547215e-10,
+        8.700133521779339e-13, 1.3403596891805666e-12, -0.022702545199904604, -9.87469959221027e-05,
+        -1.503507135972634e-07, -1.9959543726873362e-10, 2.0498682099404677e-13, 8.4924735903995897e-13,
+        0.00041099951317545504, 3.406687372312126e-06, 8.5021675989070441e-09, 1.7411892791064338e-11,
+        1.1817067354500475e-12, 6.1254484436026421e-13, -9.2969039941508597e-06, -1.1360882399840895e-07,
+        -3.9528264355777607e-10, -1.4307609603559531e-12, -4.5383171399619013e-14, -3.1527478850931531e-13,
+        2.3154518943392979e-07, 3.7432177172117557e-09, 1.6832477470929946e-11, -3.7267524004430074e-13,
+        1.5039445895638151e-13, -3.6965571607018706e-13, -6.0925339112988296e-09, -1.2252626309522305e-10,
+        -9.6255086442504363e-13, 6.2207688610093343e-14, -2.8905050547905758e-13, 6.1046889110924345e-14,
+        1.1708226170375147, 0.0012214292627019468, 6.6522710625351026e-07, 5.4461425053014135e-10,
+        8.2760417271285834e-13, 6.7074546310875116e-13, -0.022901249671902754, -9.995950089984719e-05,
+        -1.5278172424696151e-07, -2.046205325916655e-10, 9.8689354256246606e-14, 5.6977990657618698e-15,
+        0.00041788153723176791, 3.4755073829430114e-06, 8.7051872597045079e-09, 1.7249358195279519e-11,
+        2.9310184155899565e-13, 8.3223407395736172e-14, -9.5273227339932389e-06, -1.1682045528275065e-07,
+        -4.0737639376643756e-10, -4.618212247778034e-13, 4.7941832693040815e-13, 6.664425754929634e-13,
+        2.391683654803727e-07, 3.8799515382159123e-09, 1.7484603985646936e-11, -6.2673109076002117e-14,
+        2.4929617391651242e-13, -1.1965187625662326e-13, -6.3432410711883265e-09, -1.2807601535722288e-10,
+        -9.4400118991590426e-13, 1.4185722335885572e-13, -2.2946956142251984e-13, 1.8787169326330663e-13,
+        1.2824494953165468, 0.00178726866968748, 1.7405141924200802e-06, 3.0718812082543091e-09,
+        -4.5625383987145711e-10, 6.1288136886384526e-10, -0.032191127219548636, -0.00018892886323702835,
+        -4.1898984733502006e-07, -1.733941217328604e-09, 6.3395885054684775e-10, -8.421025383640192e-10,
+        0.0006787152459554423, 7.0659625061318601e-06, 2.2934488548973338e-08, 3.0262030478802018e-10,
+        -1.7838982921688385e-10, 2.3192944757588828e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.28603805373646, 0.0018013132830881151, 1.7715926072984138e-06, 1.528991708744709e-09,
+        9.398679731151066e-10, -1.0496769171669821e-09, -0.032572374965930226, -0.00019232606830880291,
+        -4.3151479102961777e-07, 4.4128194125723741e-10, -1.2863936446169287e-09, 1.4402103029393956e-09,
+        0.00069303446420228027, 7.2534674624194965e-06, 2.4252405646990461e-08, -2.9574428432599381e-10,
+        3.484729706656256e-10, -3.8996217787552774e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1732708181406621, 0.0012267773218505185, 6.7180249318318264e-07, 5.5270856156203395e-10,
+        3.9619917877909983e-13, 6.1188875033883206e-13, -0.023102398758765824, -0.00010119165317507153,
+        -1.5526351646217842e-07, -2.0868048403746672e-10, -3.1357022874308438e-13, 1.6661134328715885e-13,
+        0.00042490285085107493, 3.5459808649051276e-06, 8.9149395109240612e-09, 1.7917029631168032e-11,
+        6.0420393433452362e-13, 1.5253613302437175e-13, -9.7642693832810475e-06, -1.2013661821022845e-07,
+        -4.2045609532001109e-10, -1.0883925816856387e-12, 5.7518543273701708e-13, -6.2527034235373277e-14,
+        2.4706997452916849e-07, 4.0224455746119288e-09, 1.7993444196811059e-11, 3.8266256994804871e-13,
+        -7.1104856065669002e-14, 3.6521726725393736e-13, -6.6048321452356759e-09, -1.3320383946221727e-10,
+        -3.3711687419610736e-13, 5.9693628820901844e-13, 3.4782043869278392e-13, 5.4330292825229331e-13,
+        1.1757297682864827, 0.0012321783904783157, 6.7847873898423863e-07, 5.6267013772929242e-10,
+        1.8704651370985621e-13, 2.2097193631779157e-12, -0.023306032163276133, -0.00010244386040101699,
+        -1.5779724930159023e-07, -2.1241277792202446e-10, -1.3776701861108619e-12, 8.2565211305216571e-13,
+        0.00043206680558767593, 3.618154661035207e-06, 9.1297096975941963e-09, 1.9010015433336086e-11,
+        -3.5381321286531079e-14, 7.4603700417297938e-13, -1.0007953626686585e-05, -1.2355927886086434e-07,
+        -4.3376368534887938e-10, -1.409908769546782e-12, 8.0114578632500222e-13, -2.5046467253928444e-13,
+        2.5526139196047849e-07, 4.1683183629263508e-09, 1.8959917323632982e-11, -1.4043607195533088e-12,
+        2.7407967120541117e-13, -1.4820663484212986e-12, -6.877829179676795e-09, -1.4054767078022874e-10,
+        9.748388500166509e-13, -6.4028601188628683e-13, 1.7056882971523595e-12, -5.6604683731608751e-13,
+        1.2896549424880606, 0.0018156018327942776, 1.8008723097670394e-06, 4.1829775265808819e-09,
+        -1.5202519466499509e-11, 1.6881432520233933e-09, -0.032960504775789871, -0.00019581423758366091,
+        -4.4087811303595348e-07, -3.1460966668337246e-09, 1.9985418008661384e-11, -2.3206850737374108e-09,
+        0.00070773558960225821, 7.4487231976693302e-06, 2.464830125347774e-08, 6.8189939058281405e-10,
+        -1.9353245178620594e-12, 6.3990524593580631e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.2933006494437291, 0.0018301312093751973, 1.8330514959033077e-06, 1.6268501463131064e-09,
+        1.0181100991612752e-09, -1.0117765310645199e-09, -0.033355692957343655, -0.00019938345058342788,
+        -4.5350797829981791e-07, 4.3784523821629951e-10, -1.4061133122646889e-09, 1.4002248166903417e-09,
+        0.00072283206656611522, 7.648487344381698e-06, 2.5865277977309181e-08, -3.1485891587229009e-10,
+        3.9040824723901412e-10, -3.8852723026190861e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1578100796057786, 0.0023038640176330739, 2.2601403735848928e-06, 3.4015143807897542e-09,
+        6.3128591520370766e-12, 1.24273989346398e-12, -0.044072400570971476, -0.00036693432995900616,
+        -1.0526921971372239e-06, -2.6194232146098503e-09, -6.1921368859571084e-12, -1.4439127890913881e-13,
+        0.0015564824860181865, 2.47091100595058e-05, 1.1691872393780918e-07, 4.3251758089410397e-10,
+        6.5668236625220853e-13, -7.8306152536415624e-13, -6.8666351246803178e-05, -1.6070408875821459e-06,
+        -1.0632006936956666e-08, -5.2063526247827117e-11, -5.0497091640759186e-13, 5.6327910902450624e-13,
+        3.3355457575111153e-06, 1.0329018848039314e-07, 8.7992523644132867e-10, 5.4465057956717867e-12,
+        9.3350670745796223e-13, -7.759253375345605e-14, -1.7111473872434505e-07, -6.5961175533403541e-09,
+        -6.8532006942281906e-11, -1.1421683850097468e-12, 3.1684377531001156e-14, -6.8510553532312119e-13,
+        1.2969756709521765, 0.0018449146991321363, 1.8644372112981887e-06, 1.1233169876411514e-09,
+        3.9654755451881545e-10, -1.436891110871624e-09, -0.033758116008516782, -0.00020304617262170135,
+        -4.6430561553634029e-07, 1.184428077944331e-09, -5.536369696253241e-10, 1.9771923208061651e-09,
+        0.00073833634566138322, 7.8556630462624616e-06, 2.6517495669780825e-08, -5.1372757545523016e-10,
+        1.6355768770801526e-10, -5.3577942408383575e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.3006805191160533, 0.0018599597589691907, 1.8973896148231128e-06, 3.323805497811303e-09,
+        4.6422594458759353e-10, 6.3937025910646819e-10, -0.034167960255773643, -0.00020680663024667136,
+        -4.7648166582335366e-07, -1.7749277201529996e-09, -6.3565083880589467e-10, -8.7617885762493994e-10,
+        0.00075426245187706778, 8.0708119749158479e-06, 2.7459192204599369e-08, 2.83707977285156e-10,
+        1.7646961069930028e-10, 2.3907251602365976e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1624360191601391, 0.0023221100386877037, 2.3015403992156656e-06, 3.5013703607349064e-09,
+        6.3826263297587076e-12, 9.4537908705034478e-13, -0.044814791508567653, -0.00037548330523277978,
+        -1.084729494795769e-06, -2.720865009276766e-09, -6.1746802000173912e-12, 2.1482186158791723e-13,
+        0.0016068528080317832, 2.5665659631333193e-05, 1.2225783983891655e-07, 4.5662653260594701e-10,
+        1.2119076198031924e-12, 2.2804092549206559e-14, -7.1967531151626992e-05, -1.6946840835022323e-06,
+        -1.1284683805514982e-08, -5.7094749968555836e-11, 1.5850686161730491e-13, -6.6806084887157617e-13,
+        3.5493706409432115e-06, 1.1059208328037536e-07, 9.4684991726925134e-10, 5.883377811810206e-12,
+        -4.9894126894573698e-13, -1.461739038717271e-13, -1.8487511894421687e-07, -7.1703293906295845e-09,
+        -7.54616217855847e-11, -8.5267200703700923e-13, -3.3963574013442759e-13, -1.9100364530993496e-13,
+        1.3044157182142004, 0.001875267804845304, 1.9313454777144034e-06, 2.8803651429373522e-09,
+        7.2819701706665324e-10, -1.4346218452338094e-11, -0.034585416590910939, -0.00021066058819587828,
+        -4.892613036976204e-07, -1.1032044312434646e-09, -9.9757660232940506e-10, 1.747387793720053e-11,
+        0.00077062454509205366, 8.2922179579849526e-06, 2.8500377520379044e-08, 9.7375046156120324e-11,
+        2.7402937539877963e-10, -1.092124183616783e-12, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.3081818059681609, 0.0018908479098311444, 1.9651901919361988e-06, 1.8387543980253096e-09,
+        7.5610299666131115e-11, -1.1545722636947282e-09, -0.035010681789274835, -0.00021461411604202206,
+        -5.0107885726866426e-07, 4.0789369733502085e-10, -9.9997046630932443e-11, 1.5962165034558723e-09,
+        0.00078743719203854109, 8.5209195005066816e-06, 2.9202632822927546e-08, -3.3047638682341477e-10,
+        2.6951635435510219e-11, -4.419930773607473e-10, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.2442178635357608, 0.0015260587074172279, 1.1795081479683388e-06, 1.3481038798093328e-09,
+        1.328871323514325e-12, 6.6898451742120061e-13, -0.029066909872175434, -0.00015191245184876731,
+        -2.9248199723789182e-07, -5.1355697535416162e-10, -1.8242456598096944e-12, 6.033592591101311e-13,
+        0.00065475527713306045, 6.5019538982132389e-06, 2.0106725490753497e-08, 5.0765507624718025e-11,
+        1.6265174295416805e-13, 7.8875920638665717e-14, -1.8440846044637763e-05, -2.7003718659542876e-07,
+        -1.1535614606629631e-09, -4.6457176080156721e-12, 4.4890913933137198e-13, -7.9831114419785621e-13,
+        5.7259018458709092e-07, 1.1096490214032652e-08, 6.1424403687695248e-11, -5.0870205237308183e-13,
+        9.3280086239874037e-13, -7.89529072777486e-13, -1.8795397756306585e-08, -4.5385514616755474e-10,
+        -2.5691263940299818e-12, -2.1611218790488825e-13, 5.1531411915401998e-13, -3.2366476976957365e-13,
+        1.1670987858148985, 0.0023406921406245139, 2.3441676904990543e-06, 3.6061680717319856e-09,
+        6.5771410490904622e-12, 1.3913807374059204e-12, -0.045574540625730395, -0.00038429355145097295,
+        -1.1180190512290694e-06, -2.8276832138358705e-09, -7.2014236397305837e-12, 1.547550701018344e-13,
+        0.0016591798315577016, 2.6666051106118203e-05, 1.2788206710097116e-07, 4.8087106534018403e-10,
+        7.9766723110195889e-13, -2.5754901403119763e-13, -7.5449365101620922e-05, -1.7877328068210977e-06,
+        -1.1984540286513047e-08, -6.0710610984416034e-11, -9.2187111443028112e-13, -4.1398540767480988e-13,
+        3.7783648060425402e-06, 1.1846292676665095e-07, 1.0220299941425877e-09, 5.9911326936480507e-12,
+        5.9340519654057725e-13, -4.4048070643189538e-13, -1.9983759009321522e-07, -7.7984282951357965e-09,
+        -8.1509802536984251e-11, -1.0345640443556137e-13, 7.7969942104029415e-13, 5.0219701600351996e-13,
+        1.2822945976544038, 0.0034769875807263199, 6.6071905588233142e-06, 1.7318196543259923e-08,
+        1.0284292605293172e-09, -9.5844068287420632e-10, -0.065420484525682582, -0.00076002316590810851,
+        -3.3634132611367717e-06, -1.1533925346991924e-08, -1.7501531181056752e-09, 1.6798461412080666e-09,
+        0.0032625592081639313, 7.1693250533999531e-05, 4.9914684599466191e-07, 1.2787204171688762e-09,
+        1.1350040798450809e-09, -1.1155975270095484e-09, -0.00020037976325552246, -6.4071854873088187e-06,
+        -5.9851116926130904e-08, 3.2726385173952795e-10, -5.4027039074404164e-10, 5.3879313627151439e-10,
+        1.2436882625797398e-05, 5.0675892906445905e-07, 5.6838188237542697e-09, -1.9207769134346373e-10,
+        1.7038336828944344e-10, -1.7177680298382394e-10, -5.6187716345447535e-07, -2.650272282173921e-08,
+        -3.2155847581566513e-10, 3.5485695781918641e-11, -2.7015184040915131e-11, 2.7769737997749425e-11,
+        1.1717990617117267, 0.0023596203470595332, 2.3880742486013326e-06, 3.7146292407311329e-09,
+        6.722110487873654e-12, 9.7599286456979593e-13, -0.046352180666710478, -0.00039337532335292967,
+        -1.1526209808183612e-06, -2.9399015990796365e-09, -7.7804981085108398e-12, -4.0335593808697911e-14,
+        0.0017135535900104091, 2.7712647449771722e-05, 1.3381209810130066e-07, 5.0763225366269695e-10,
+        2.0618999249869237e-12, 3.4431844375723773e-13, -7.9123038640300792e-05, -1.8865638144136942e-06,
+        -1.2731950004879393e-08, -6.403667163569739e-11, -8.1189893494406885e-13, 4.4417068118780586e-13,
+        4.0237133111467178e-06, 1.2695261635748996e-07, 1.1022203660995532e-09, 7.1973837128256263e-12,
+        3.6918011046490432e-13, 2.8260258386693001e-13, -2.1611776706254497e-07, -8.4880338868623359e-09,
+        -8.9500170824520757e-11, -1.1074565183397411e-12, 5.1828765553060941e-13, -2.9543392202933328e-13,
+        2.296107450865009, 0.17334580589761162, 0.0074526710626521128, 0.00028694772070464599,
+        9.9294705985731455e-06, 3.1942326484560513e-07, -1.5092436743207798, -0.22032448361040127,
+        -0.010707167688328396, -0.00042431182410957976, -1.4860557589607466e-05, -4.8104244754011231e-07,
+        0.41226305504337285, 0.074090586300047889, 0.0039639937951789052, 0.0001649747042421861,
+        5.9354093025906514e-06, 1.9517539401070941e-07, -0.053798548364592871, -0.010771680454031181,
+        -0.0006182080822881615, -2.6936635515523559e-05, -9.9872239778125501e-07, -3.3497455358115109e-08,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        2.7155818498683066, 0.24997263819087909, 0.012077013456022103, 0.00049833895978909073,
+        1.529258240316271e-05, 3.9231398480958222e-08, -2.0550554898325033, -0.33119057999390084,
+        -0.017568303327047893, -0.00074105354144255115, -2.2894368208204444e-05, -5.1810523055400709e-08,
+        0.5997791022060357, 0.11565997891874311, 0.0066523360958644327, 0.00029184178801269778,
+        9.145380172565122e-06, 1.2656117721501952e-08, -0.081539661802331465, -0.01733752786862031,
+        -0.0010610903710551961, -4.8353359172724768e-05, -1.5366538506058728e-06, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.625969470913647, 0.032187819241630972, 0.00048738893573604106, 7.8887564701767161e-06,
+        1.1448039853618198e-07, 2.8518023445877266e-09, -0.50703745849058435, -0.030467672628378621,
+        -0.00063667166799416953, -1.1140946684749701e-05, -1.6617580127013655e-07, -4.2913892068043647e-09,
+        0.095948067605143919, 0.0081431351121117306, 0.00020409362273996121, 3.9435060273278487e-06,
+        6.1664037758556204e-08, 1.7513272855647592e-09, -0.010073714751154378, -0.0010012469408059138,
+        -2.7987468314945995e-05, -5.8329401973605024e-07, -9.4541524061340426e-09, -3.0605209621535581e-10,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.6945687208581204, 0.036500805859385706, 0.00059471781426146655, 1.0099889283487455e-05,
+        1.5660335522435177e-07, 1.7254906978132209e-09, -0.57352557522016112, -0.036147143541922264,
+        -0.00078882768051776527, -1.4367213246574482e-05, -2.2870306133488267e-07, -2.5137494097301278e-09,
+        0.11403047207662337, 0.0099844476394452073, 0.00025835313859320046, 5.1576443267501201e-06,
+        8.6168173871867053e-08, 9.2984123799607856e-10, -0.012324389363039851, -0.0012561589032948444,
+        -3.6072420033020209e-05, -7.7361008038670382e-07, -1.3491528472519584e-08, -1.3614604640737916e-10,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.4138952662405562, 0.0090905639687168683, 5.9399853609360075e-05, 4.5104824786978692e-06,
+        1.3291802901731403e-06, 2.2224361691371474e-07, -0.20194005169854254, -0.005626063521747094,
+        -7.5781661890320207e-05, -7.9348545984500802e-06, -2.3809337699838363e-06, -3.9813033575785846e-07,
+        0.028404932333922668, 0.0014218534669576868, 3.2612554514363543e-05, 5.5331708021315133e-06,
+        1.7094249798833236e-06, 2.8577968786175188e-07, -0.0044132419546289957, -0.00030394532609929602,
+        -1.164691918037321e-05, -2.9938015566455291e-06, -9.4489249533318045e-07, -1.578366992603651e-07,
+        0.00057621047869239276, 4.9192393715220568e-05, 3.3619090765226742e-06, 1.1657416104828686e-06,
+        3.7258658567783957e-07, 6.2143699258171934e-08, -4.3986112431062123e-05, -4.6422250012188832e-06,
+        -6.3349172590184826e-07, -2.6554165918925831e-07, -8.5420993234042346e-08, -1.421557643008798e-08,
+        0.0090638072978522846, 0.012960418462158858, 0.0044376795736300583, 0.00054432607077541887,
+        -3.1582942942926094e-06, -7.6380409942303157e-06, -0.0061658439056726183, -0.0091206530787979797,
+        -0.0035506997624000915, -0.00062793002038173695, -2.6087269035542036e-05, 8.2393730607623207e-06,
+        0.0014659499316686264, 0.0022405345586085355, 0.00097733350438318121, 0.00022420761919381095,
+        2.0731329495639566e-05, -1.2045990792717019e-06, -0.0003100053026578844, -0.00048697598460636021,
+        -0.00023283133239301607, -6.5121695551633436e-05, -9.7918532174799189e-06, -7.9814047361928103e-07,
+        6.2612660076197724e-05, 0.00010092747007157691, 5.2506216540667052e-05, 1.7413507969494651e-05,
+        3.6333621917352212e-06, 5.1184309176032509e-07, -1.2322573494520207e-05, -2.0271606534909408e-05,
+        -1.1273671036828343e-05, -4.1589227011348046e-06, -9.7396615627559208e-07, -5.8250191438163983e-08,
+        0.0025816221903856473, 0.0035325708790139741, 0.00099249208272564294, 3.240838061530489e-05,
+        -9.4595448394435034e-06, -9.5211305931142815e-08, -0.0013106285692480811, -0.0018338378600916334,
+        -0.00056966496567472833, -4.1712230966195364e-05, 5.6246163917627288e-06, 6.6163917660324042e-07,
+        0.00018448715735975896, 0.00026703960243679609, 9.5080538305927371e-05, 1.2213827398104698e-05,
+        -5.0968197045402882e-07, -1.6894945042439625e-07, -2.5425074396143246e-05, -3.7633007272800543e-05,
+        -1.45896205623843e-05, -2.4371293923918246e-06, -2.5050361064818609e-08, 4.0038253745440109e-08,
+        3.0121174845603706e-06, 4.5663633149592976e-06, 1.9227941546023474e-06, 3.8724298226337111e-07,
+        1.4086842593312751e-08, -9.6283984738379282e-09, -3.5315252789884661e-07, -5.4107459914504292e-07,
+        -2.3636371041215611e-07, -5.1227103229342749e-08, -1.8610736080749549e-09, 2.0680650328374717e-09,
+        0.066414207888915028, 0.033535939826716342, 0.002341372253641357, -6.7122202410448359e-05,
+        -6.5591075483791797e-06, -9.782713374344592e-07, -0.031781672636685701, -0.018482890043093909,
+        -0.0016270707719157403, 3.0543945125026163e-05, -5.6062806010647989e-07, -4.5037722888605976e-06,
+        0.0053292639833231919, 0.0034248117723531773, 0.00032652891317718516, 5.7049189476760073e-06,
+        1.1414346425632402e-05, 3.2750374932588888e-06, -0.00074157765276615926, -0.0004937199076484553,
+        -6.4233237643881156e-05, -2.2533954798737757e-05, -9.6497792820215421e-06, -7.6991826146825865e-07,
+        9.7700666486358063e-05, 8.2831627925901929e-05, 3.455309797563211e-05, 1.6489059724082461e-05,
+        3.1931680295298515e-06, -5.3368428152831691e-07, -2.0665555297261315e-05, -2.9382080024835934e-05,
+        -1.7204514402126909e-05, -5.3801792044579307e-06, 9.6034671142872551e-08, 5.03496378852123e-07,
+        0.028075790747874807, 0.012395458615062065, 0.00061954420504189468, -3.2045887858747096e-05,
+        -1.4675025355938896e-06, -2.8440493436027005e-06, -0.0099198977786655682, -0.004913151899931619,
+        -0.0003120969021425751, 1.0979690013371788e-05, 7.4589808291233321e-07, 1.9953556396295507e-07,
+        0.0011694163796856761, 0.00064780927258095461, 5.4263853729897329e-05, 5.295900989387401e-07,
+        -1.9061442473661519e-08, -4.2257633066338164e-08, -0.00012176980251597214, -7.6465321356416162e-05,
+        -9.1939734829436512e-06, -5.4788198095452073e-07, 3.4038005083573507e-08, 2.2813799111483833e-08,
+        1.2505863687305741e-05, 9.2919228950197084e-06, 1.543149416315157e-06, 9.980142179542585e-08,
+        -2.6217845771649252e-08, -7.5404486392856006e-09, -1.3558103835091889e-06, -1.1715344468415975e-06,
+        -2.1378250769410966e-07, 2.0502880536312048e-09, 1.0359753790436512e-08, 1.7731834753133643e-09,
+        0.14876850266920888, 0.047837780748705983, 0.0011822839448094081, -0.00011847044490667607,
+        -5.0404969130586193e-06, 1.1795748979141838e-05, -0.081407181841936932, -0.031189246512370723,
+        -0.0016790116897247055, -5.9521717016221636e-06, 1.7874380355820538e-05, -7.046308515523564e-06,
+        0.016324049792844603, 0.0080701368026437487, 0.00089043450662931256, 2.1963600481536175e-05,
+        -2.1953144949402973e-05, -8.2137565682843846e-06, -0.0032720846873783792, -0.0022604597939426749,
+        -0.00033364194849133736, -7.3131341326383046e-06, -4.076011277223475e-06, -6.2318568433296583e-06,
+        0.00077473453111900014, 0.00062007737923281726, 8.2606869533955013e-05, -5.3502376270662603e-06,
+        6.3615102836612855e-06, 1.6172045473331359e-05, -0.00017486485178463422, -0.00011452846622962016,
+        1.9138519226679713e-06, 2.793620367212536e-05, 8.1468240689359512e-06, -3.62309091272978e-06,
+        0.056162398035179334, 0.015208680759953066, 4.5432950190498984e-05, -5.6938450981713876e-05,
+        -8.3669458721986204e-07, 8.9103944615511907e-08, -0.021630428979598808, -0.0066004371804926926,
+        -7.2954945588326491e-05, 3.2129191215165884e-05, 1.7064058688855551e-06, -1.196501545387256e-07,
+        0.0028529950187934864, 0.0010075544200388146, 1.8807714558969108e-05, -8.315702351383603e-06,
+        -4.9222248578305248e-07, 1.3206711331259994e-07, -0.00034051695854987513, -0.00013462186219641178,
+        4.3261960947452158e-09, 2.0412138604363227e-06, -4.8780604467976404e-08, -6.5272282008913587e-08,
+        3.8072956478566669e-05, 1.3503242139083499e-05, -1.5990675092989209e-06, -3.7992145909191401e-07,
+        7.6232764451678714e-08, 2.0005409226213255e-08, -3.1403667252441169e-06, 1.8872519761731167e-07,
+        6.5087754892778141e-07, 1.6981838142538735e-08, -3.701444861906616e-08, -5.0074348987450498e-09,
+        0.016814343614958149, 0.010174372728218995, 0.0003680625538963434, -0.00012736259938549759,
+        -3.8081068266859252e-06, 2.7766200685581797e-06, -0.0095877971469836322, -0.0061940187078213865,
+        -0.00026867173889984024, 9.2901200438515473e-05, 4.3979732725130035e-06, -1.4485771183937706e-06,
+        0.0016301538164075499, 0.0011525551862064224, 6.0915129058764383e-05, -2.078587095785298e-05,
+        -6.0461215184329418e-07, 5.7552044216485471e-07, -0.0002543328046687017, -0.00018868481861157024,
+        -1.1599434788325589e-05, 2.6095773508659855e-06, -3.2753513654709098e-07, -1.0131773791559034e-07,
+        3.441480301194022e-05, 2.7338552341053877e-05, 2.8688681606513652e-06, 1.7207644928898517e-07,
+        9.9936050833568867e-08, -2.9645210132304706e-08, -4.7306129036706493e-06, -4.2223288524173148e-06,
+        -7.5962624051616123e-07, -7.7665406388628965e-08, 3.0881461662357135e-08, 2.5162340952492463e-08,
+        0.00079825101690680922, 0.0010703533185828134, 0.00027099641403430355, -3.3995199991856557e-06,
+        -1.5250109146592292e-06, 8.0480893620446848e-07, -0.00061364513591525129, -0.00083111163453941758,
+        -0.00022283569988739221, -3.0940645187939439e-06, 2.7642429470041485e-06, 5.1826116748785438e-07,
+        4.1395371158229645e-06, 7.6240273218916882e-06, 4.1761730227032971e-06, 5.8172902906962678e-07,
+        9.3699644552093948e-08, 2.5494751303879784e-07, -2.0964257478329996e-05, -2.894337968663846e-05,
+        -8.7434669720756496e-06, -6.8006441271643193e-07, 2.2556385139597261e-07, 1.6919247673362178e-07,
+        -7.1106227300337875e-06, -9.8072923250307923e-06, -3.0313775184160425e-06, -3.0509394431024276e-07,
+        1.1217467537361137e-07, 1.0547793004278537e-07, -3.7280453652642868e-06, -5.212627555813382e-06,
+        -1.7222870175349331e-06, -2.2217782022441746e-07, 6.5322924048264597e-08, 6.5986570873836123e-08,
+        0.0047501173960805901, 0.0027270343540320512, 8.2842745478176399e-05, -3.0985431797745267e-05,
+        -2.707676298356036e-08, 2.5575035620685704e-06, -0.0036852718301731177, -0.0020991302165934431,
+        -6.2933433747881351e-05, 1.7807644263745042e-05, 9.2699658369437979e-08, 1.3203537368063792e-06,
+        9.3087403249878352e-05, 8.1494405998171974e-05, 1.8195986767827908e-06, -3.9845117242541653e-06,
+        -6.0968719614998166e-08, 8.7897048819696127e-07, -0.00012472147220238901, -6.9039051257204753e-05,
+        -3.6438097759303989e-06, -6.0660174207645808e-07, 3.7220440833488262e-08, 4.9468239446828077e-07,
+        -3.5722292662054721e-05, -1.5977419608797557e-05, -7.931093867248795e-07, -6.5778908463421462e-07,
+        3.6814216812527894e-09, 3.1372732822763686e-07, -1.9404988567932815e-05, -8.9325609008241341e-06,
+        -5.853540318956368e-07, -3.8932225297979304e-07, 1.3509549479566296e-08, 1.9432468205858633e-07,
+        7.9421685078803688e-05, 3.5581444220099185e-05, 2.2090152416189817e-06, 1.0158308989251691e-06,
+        3.4496725120706391e-07, -1.3576497307496097e-06, -0.00015131348778484334, -6.7816383948328483e-05,
+        -4.2134291973618043e-06, -1.9396608409804475e-06, -6.586330260015492e-07, 2.5922516526625522e-06,
+        0.00014312303695074413, 6.3886650055233103e-05, 3.9389019760461151e-06, 1.7932491044908203e-06,
+        6.0948090579532945e-07, -2.3974366010950615e-06, -0.00012114638927512415, -5.3853384738878053e-05,
+        -3.2939883251582402e-06, -1.4821502327671618e-06, -5.0424370469391968e-07, 1.9822772904188998e-06,
+        0.00010095313204878354, 4.4368089176091471e-05, 2.6536363701721068e-06, 1.1537053699820737e-06,
+        3.9366356442345496e-07, -1.5447672321768488e-06, -7.0390032881991721e-05, -3.0360539911132205e-05,
+        -1.7470225612216814e-06, -7.1238540183143911e-07, -2.4448258073261507e-07, 9.5599111606170338e-07,
+        0.00017188877956086102, 4.9100359426977826e-05, -6.7587421130297012e-06, 6.197383682989549e-07,
+        6.3028063371416119e-07, -9.8163890752405002e-07, -0.00032603964359852335, -9.2485240673495747e-05,
+        1.2300109551350426e-05, -1.1232706834331997e-06, -1.1371528506272098e-06, 1.7694956969470775e-06,
+        0.00029448586318672298, 7.7678088623656547e-05, -6.4139013347852043e-06, 5.4304149266082735e-07,
+        5.0886491067039332e-07, -7.7765096486504403e-07, -0.00023562431335361186, -5.6109311862780989e-05,
+        2.8700511479286883e-07, 5.2017188034829269e-08, 1.2809927665573581e-07, -2.2536114201398299e-07,
+        0.00017729584315555715, 3.3454633807054727e-05, 6.812236710363556e-06, -7.4472868437088822e-07,
+        -8.6922782753427674e-07, 1.393142949449954e-06, -0.00010879688421936077, -1.3125827658745029e-05,
+        -1.0117334545731742e-05, 1.052882739354254e-06, 1.1828866411852674e-06, -1.8829643276931826e-06,
+        0.28105103128461623, 0.033857891079923208, 9.9054871330347532e-05, -2.2001961525598029e-05,
+        1.2278186549086796e-07, 1.5124250674379698e-08, -0.10095571652331276, -0.017524916105966262,
+        -0.00040920786794823783, -7.7948804903146824e-08, -2.5595578276024481e-07, -1.1011183527242683e-08,
+        0.015317036319981775, 0.0036758408224056936, 0.00017890288730954991, 6.7510120610560988e-06,
+        3.2716532709455648e-07, 8.89244634445949e-09, -0.0023458990545422707, -0.00075009533141180381,
+        -6.0467292524554434e-05, -3.9033494553361119e-06, -2.1274509232197086e-07, -7.676507076128704e-09,
+        0.00037344850349345181, 0.00015828812707155583, 1.8367901556672526e-05, 1.581307920876743e-06,
+        1.0419532583095878e-07, 5.1058143538178446e-09, -6.2666806920365717e-05, -3.4069554686119412e-05,
+        -5.0817319932163749e-06, -5.3289532858300728e-07, -4.2074595832652748e-08, -2.6029661870451607e-09,
+        0.15063389959740667, 0.014516511884792731, -0.00021496441314932093, -5.2458469485780876e-06,
+        6.5805645954721528e-06, 4.4218602638451647e-06, -0.039004016815012435, -0.0042528714130699447,
+        2.3996482731152918e-05, 2.5270196485674238e-06, 5.3265784291832272e-06, 6.4594789770935997e-06,
+        0.0034280910417684171, 0.00040254365292159743, 5.3462537683707722e-05, 5.8293796438631007e-06,
+        -9.0578102468185574e-06, -7.5289207544847118e-06, -0.00027004621158780589, -0.00013559901449874688,
+        -8.3584001834779973e-05, 8.748958810672893e-06, -5.8594120575193974e-06, -1.7750693282489415e-05,
+        4.5619405923240955e-05, 0.00011058773175835309, -2.6764886506901948e-05, -3.2158408220086159e-05,
+        2.0617826024854216e-06, 3.7277017193380164e-06, 4.8218965916887373e-06, 8.4622601474215503e-06,
+        7.8366933109162354e-05, -1.0131541286480776e-05, -3.5860053824837425e-06, 1.5423324023103438e-05,
+        0.34875918199718048, 0.03364627990333463, -0.00014538801231045882, -1.8305855649579458e-05,
+        2.9488609803103057e-07, 1.5551485390679722e-09, -0.13933873696068272, -0.020882913021658494,
+        -0.00043906610014373521, -5.0111447834193809e-06, -2.9870408102547947e-07, 8.0268072631387882e-09,
+        0.024427253937241027, 0.0055320929419862353, 0.00029640879076303167, 1.3153082111175897e-05,
+        4.5328823599495191e-07, 2.7272117041849928e-09, -0.004527484433047956, -0.0014919857875608743,
+        -0.00013342637947933984, -8.7306856256822858e-06, -4.0236446357921108e-07, -1.1244186693395029e-08,
+        0.00092340599791558976, 0.00041919597778607533, 5.1712615079097466e-05, 4.3844781099821282e-06,
+        2.6907673250039649e-07, 1.2230531846445922e-08, -0.00020329600564056833, -0.00011714408221075955,
+        -1.7972091603974145e-05, -1.8628931170775532e-06, -1.4286664969667716e-07, -8.4892745855046629e-09,
+        0.17751748026741099, 0.012235933494434241, -0.00037809986568560438, -2.3746417848127893e-05,
+        1.6188495243298968e-05, 2.0953727367130303e-06, -0.047305566003112462, -0.0040759860265309842,
+        -3.2206331559500182e-05, -2.3594214891329857e-05, 2.6883235617179023e-05, 7.6528026114454047e-06,
+        0.0046741329891634197, 0.00078279490958237498, -4.351563347074526e-05, -3.2064367907380562e-05,
+        1.1250550910562924e-05, 1.6529501867862115e-05, -0.00052727857930224067, -1.3011837492217355e-05,
+        9.8389591632314072e-06, -3.0492453858949032e-05, -4.1811927238199582e-06, 2.2803860576891898e-05,
+        5.1607693458443489e-05, -1.6426145409545887e-05, 4.1724395595264035e-05, -2.2972912387005177e-05,
+        -1.5445783397225141e-05, 2.2038944803159768e-05, 1.7012142041198145e-05, -4.554677957616488e-05,
+        3.5894955024583367e-05, -9.0365340903850853e-06, -1.5634700240705508e-05, 1.2047695012035426e-05,
+        0.084792609373815706, 0.012879759088189837, -0.00059779304090100719, -4.4795108784877923e-05,
+        -5.5897643167450036e-06, -5.4403861988458756e-06, -0.034162133718177036, -0.0056347289642454373,
+        0.00027206848215277385, 1.8214757576318178e-05, 1.2499963155316428e-05, 1.0798697861572223e-05,
+        0.0047990036385239009, 0.00091378539885566461, -1.0652589660618187e-05, -3.5138137394684322e-06,
+        -1.7475669578895545e-05, -1.2069137815788584e-05, -0.0006059586411323425, -0.00014359647038753446,
+        -8.9578001773691252e-06, 1.1278377736835627e-05, 1.915392445378451e-05, 1.1786955859987391e-05,
+        6.3348537300790777e-05, 1.5127108878780245e-05, -6.3053163164607875e-06, -1.7931632644948403e-05,
+        -1.9633375873148585e-05, -1.1585524350760179e-05, -1.5779607495805596e-07, 6.2146149656653865e-06,
+        1.2728102378370188e-05, 1.7151093568276437e-05, 1.5915598312177437e-05, 9.1824632472184692e-06,
+        0.47472512788271798, 0.020907939905308547, -4.7830321269975339e-05, -2.189974799199054e-06,
+        8.3046770012860857e-09, -5.258605894941522e-10, -0.12194851198364989, -0.0099874900708283535,
+        -0.0001780603105362981, -2.8269359896742962e-06, -2.36375082012178e-08, 8.3034277261379352e-10,
+        0.015305172247221329, 0.0022105144116743337, 8.8968016710308517e-05, 2.608608318380952e-06,
+        5.0311378608636657e-08, 4.4874384567386512e-10, -0.0022257582107134341, -0.00049818704847702814,
+        -3.0306011321597991e-05, -1.258488155773477e-06, -3.7613065755998523e-08, -8.0996074839574058e-10,
+        0.00036771020624785147, 0.00011207616281755943, 8.9785217232050902e-06, 4.8721100298197182e-07,
+        1.9677809149698893e-08, 6.1375556323057583e-10, -6.4934911517409958e-05, -2.4707058769881616e-05,
+        -2.4414783100536707e-06, -1.634391989370804e-07, -8.2187999444401342e-09, -3.2523917920591517e-10,
+        0.30587584885332852, 0.0096645767381995026, -0.00014612288940015663, -2.3829219145602312e-06,
+        1.6853543953668701e-08, 2.6591625128702251e-10, -0.055679293514723879, -0.0027169519662370478,
+        1.6195337640193893e-05, 8.4482797043600531e-07, 3.8370678894851001e-09, -6.8362211728171953e-11,
+        0.0042477687386470123, 0.00030324661891057472, 1.2718601290978515e-06, -8.5245276515005034e-08,
+        -2.0819301950765012e-09, -1.8588239880783963e-11, -0.00033211901046371466, -3.3905338760845914e-05,
+        -5.6716128478925196e-07, 3.9101669581212231e-09, 4.5685353180030622e-10, 9.160051223692777e-12,
+        2.8000465243007713e-05, 4.020067234370207e-06, 1.182367623206777e-07, 7.4911281974166835e-10,
+        -6.975283822992244e-11, -2.2809675029732489e-12, -2.5561893780820068e-06, -4.83809942813877e-07,
+        -1.9541203784114464e-08, -2.886069768383732e-10, 7.6717293852323261e-12, 4.3112569366120944e-13,
+        0.51607617761518787, 0.020421581199455887, -7.3687658556897018e-05, -2.1494734828347294e-06,
+        -3.6010654728632995e-09, -6.3651392237810796e-10, -0.14345898170324942, -0.011552637398840047,
+        -0.00021360691035446591, -3.0418856040595518e-06, -1.3748760782581742e-09, 1.405677354848664e-09,
+        0.020547144250761405, 0.003061778414265789, 0.00012536646554709631, 3.4752730409744737e-06,
+        5.7220009214599594e-08, 1.9766259359460698e-10, -0.0035204928338151793, -0.00081259426945583853,
+        -4.9597953731803947e-05, -2.0035760058178093e-06, -5.6286411724266798e-08, -1.044670023456352e-09,
+        0.00068668250440867605, 0.00021371059710174499, 1.7187133727347318e-05, 9.2162524875934185e-07,
+        3.6020766477979415e-08, 1.0476181661505147e-09, -0.00014205816150968762, -5.4913929838917696e-05,
+        -5.457120881023044e-06, -3.6311472844088433e-07, -1.7863826112402329e-08, -6.7583967570592401e-10,
+        0.32394897806724138, 0.0083862137548982325, -0.0001729184687445674, -2.0688332034703755e-06,
+        2.2524551540109746e-08, 3.0177476382656351e-10, -0.060950881199011944, -0.0025459266355568736,
+        2.6641967992014115e-05, 8.9071298291824711e-07, 1.6027507793551486e-09, -1.5982869961070541e-10,
+        0.004860784153694701, 0.00030874312627696387, 4.0809898731388776e-08, -1.2024719206855481e-07,
+        -2.203959844412899e-09, 9.1013813786305665e-12, -0.00040422219897534188, -3.8117878718087512e-05,
+        -4.7091538029167575e-07, 1.2495241017587186e-08, 6.0113016693703457e-10, 4.4464573889172299e-12,
+        3.6999294214606877e-05, 4.9795005335218761e-06, 1.1903888819752415e-07, -7.2513834959497446e-10,
+        -1.1331836308293581e-10, -1.8995381176697539e-12, -3.6891781898058012e-06, -6.5121474614294287e-07,
+        -2.1966018000774187e-08, -9.1819432444004465e-11, 1.7101592469356241e-11, 4.8273529331945111e-13,
+        0.19884734028022252, 0.0090632151160199605, -0.00042422585887937525, -6.6650335324039439e-06,
+        2.5674935134219802e-07, 2.1050076407770623e-09, -0.055167531108200926, -0.003645813991378893,
+        0.00011644825163866462, 4.0996841262405609e-06, -7.2294807300495262e-08, -2.6409125559776655e-09,
+        0.0059649841858661901, 0.00055286999698801102, -1.0984356228327112e-05, -7.6012240955872549e-07,
+        4.6674817375348161e-09, 6.278974676277015e-10, -0.00062200906752664918, -7.198714132521893e-05,
+        8.2778627174165474e-07, 1.1371700229539138e-07, 7.7088041764896724e-10, -9.9676266617437544e-11,
+        6.528118808475075e-05, 9.2545578580473234e-06, 1.9393742407578856e-09, -1.585018856958943e-08,
+        -4.5638544596871405e-10, 1.0118248332151276e-11, -7.0588073838006328e-06, -1.2825766276275261e-06,
+        -2.1919072890263817e-08, 2.070639572375246e-09, 1.3030311059021669e-10, 1.3110315359079305e-13,
+        0.55624683471025704, 0.019726966903156527, -0.0001002419677562301, -2.3068175267531189e-06,
+        -1.5757444270209114e-08, -5.3893201170068394e-10, -0.16838742853834998, -0.013405533558232926,
+        -0.00024921072989759064, -2.8073097617233e-06, 3.2496811366354077e-08, 1.960165130707128e-09,
+        0.027816774342045013, 0.0042472228967648058, 0.00017260983445161301, 4.3958210042364076e-06,
+        5.5993305322478551e-08, -3.7877982277172278e-10, -0.0056304855391049319, -0.0013224958803488755,
+        -7.9757156890490551e-05, -3.0779358042062708e-06, -7.8188969746153923e-08, -1.0966549062585253e-09,
+        0.0012947082959574691, 0.00040702671762480724, 3.2491851764590586e-05, 1.6954435124488038e-06,
+        6.2561356701069591e-08, 1.6214805087556497e-09, -0.00031356556762277167, -0.00012207346868856297,
+        -1.2069869260943066e-05, -7.8693655381636926e-07, -3.7129411497108585e-08, -1.302988137897259e-09,
+        0.33926407603784375, 0.0069101580965193572, -0.00019537769459794071, -1.6586008858608119e-06,
+        2.8821933116454143e-08, 3.2205701690063023e-10, -0.065795627142516022, -0.0022898803343063467,
+        3.7360603397781069e-05, 8.8513900157454936e-07, -2.6284186758689879e-09, -2.6121482181354493e-10,
+        0.0054736218127333222, 0.00030272540124823483, -1.6010541408131714e-06, -1.5197129346223213e-07,
+        -1.6318225843409138e-09, 4.9166761776885363e-11, -0.00048363239941828882, -4.1118051921336725e-05,
+        -2.617872148871817e-07, 2.2364367777463261e-08, 6.0191203235971229e-10, -5.0185306287571747e-12,
+        4.7859661414417726e-05, 5.8637280520853097e-06, 9.8425734996453833e-08, -2.7710825380672909e-09,
+        -1.3721792462438396e-10, -2.8365839806941791e-13, -5.1670809586213366e-06, -8.2600234491377591e-07,
+        -2.1127283214865139e-08, 2.5227411508898357e-10, 2.5277447536742829e-11, 2.8509726151593967e-13,
+        0.59480767300822668, 0.018809302335826575, -0.00012973919238703526, -2.6279995231126894e-06,
+        -2.3090397199081033e-08, -1.3234491032305661e-10, -0.19729057146793161, -0.015522018822097836,
+        -0.00027842053247448284, -1.9549463747837858e-06, 7.4731389644878546e-08, 2.1618491058258257e-09,
+        0.037869331603323571, 0.0058534695637128542, 0.00023034144462194826, 5.1861966648619638e-06,
+        3.9974554831619531e-08, -1.2510387706211489e-09, -0.0090465597935912596, -0.0021311518443040906,
+        -0.00012488224860075144, -4.4908843302140234e-06, -9.7215927281475323e-08, -7.172174929240323e-10,
+        0.0024468912349267929, 0.00076803255752941465, 6.0016877370162636e-05, 2.9876268853320611e-06,
+        1.0073565053961386e-07, 2.1670457499335081e-09, -0.00069279901329002199, -0.00026878690969645751,
+        -2.6089320203970056e-05, -1.6371094379315418e-06, -7.2204524921307927e-08, -2.2521056147610341e-09,
+        0.35146419719094424, 0.0052758476089649767, -0.00021230428708491987, -1.1469606985957551e-06,
+        3.501384636832326e-08, 2.8450067170808716e-10, -0.070043651944828783, -0.0019496490359398374,
+        4.7543666586129931e-05, 7.9713657935429258e-07, -8.5684969709247295e-09, -3.2146283244089334e-10,
+        0.0060602342425885242, 0.00028226752374897128, -3.5418098895936768e-06, -1.6804011154907224e-07,
+        -2.5666724698641064e-10, 8.6141227013317456e-11, -0.00056700495283108429, -4.1986798615345025e-05,
+        5.9042609486510518e-08, 3.0568813195923383e-08, 3.8671224068835138e-10, -1.6399828878632921e-11,
+        6.0243127379123863e-05, 6.4812193849471733e-06, 5.2240547713276581e-08, -4.8780956535342472e-09,
+        -1.177110237259298e-10, 2.3236336147755483e-12, -6.9734698707691817e-06, -9.7574829629226734e-07,
+        -1.5558890876265426e-08, 6.7895040187270107e-10, 2.6466160980731074e-11, -2.0630529999987332e-13,
+        0.21337761446321746, 0.0054217535786745723, -0.00047855463782824564, -2.3406455001047775e-06,
+        2.762367971842281e-07, -2.4312125456379612e-10, -0.061388193761638482, -0.0025409310438036228,
+        0.00015706088358711045, 2.5541217731996744e-06, -1.1787319438448145e-07, -1.6933358039192266e-09,
+        0.0069555207148414532, 0.00043078121429485842, -1.9220752872973663e-05, -5.7887024822370748e-07,
+        1.802706387554535e-08, 6.331909739080346e-10, -0.00075501270255503119, -5.9881526103219351e-05,
+        2.184229723713827e-06, 1.0519228621097101e-07, -2.0661153887975129e-09, -1.6816000624397721e-10,
+        8.3133063297913072e-05, 8.4116835675811905e-06, -2.1983030062346787e-07, -1.9824075523161575e-08,
+        5.4397580819667098e-11, 3.8660899053746016e-11, -9.697218319503452e-06, -1.3256637301063039e-06,
+        1.4136465983096877e-08, 3.7445669240222058e-09, 5.2927312986362259e-11, -7.727466221853223e-12,
+        0.10412463707825954, 0.0061554505237229233, -0.0009529516636994841, 3.6158445815049418e-06,
+        5.8598615995397088e-06, 1.9168859634161111e-06, -0.042304003737164468, -0.0024414656619340036,
+        0.00036664421919564423, -1.2467490401956166e-05, 3.4490104595174053e-06, 2.3651069080053436e-06,
+        0.0060961494041616594, 0.00038844400864859757, -3.8582452473800274e-05, -9.7416405957365807e-06,
+        -8.4426401619805234e-06, -6.3455197558707196e-06, -0.00071429981053859257, -4.0557847907147968e-05,
+        -5.4364970988685706e-05, 2.0269477061144745e-07, -2.3368858553549878e-06, -3.6370078603096755e-06,
+        8.6470054769843057e-05, 0.00010775793729591236, 4.1772223601392724e-05, -1.8620923546156757e-05,
+        6.0675397692986525e-06, 7.8402651249679488e-06, -1.979308751936891e-05, -5.5959663900904667e-05,
+        3.9628652157761808e-05, 2.5806191376826241e-05, -3.4490227400308695e-06, 1.2347657124826984e-06,
+        0.035527841538226475, 0.0074179985325904616, -0.00096871376218979062, -8.3066703193361796e-05,
+        3.8879760861578096e-06, 3.0676198826977326e-07, -0.020674041793765224, -0.0040444771204825149,
+        0.0007420903880314731, 6.5567644696808421e-05, -1.8346606922716326e-06, -4.7553479000107053e-07,
+        0.0036942384632539906, 0.00072076920489896749, -0.00017617562353665548, -2.7590341936587042e-05,
+        -1.5722450441879448e-06, 7.2776533567810004e-07, -0.00060316122699102218, -0.00011001665041392973,
+        5.3190011584503245e-05, 1.2887500175926483e-05, -3.4106703299964547e-07, -8.975127552130546e-07,
+        7.6018443737934638e-05, -4.7637354063274906e-06, -1.8691802555597579e-05, -1.563640578300732e-06,
+        1.7395351324390144e-06, 5.85612174006873e-07, -7.0391676206067163e-06, 5.3078749611551745e-06,
+        1.2405741971084354e-06, -2.3521451189725673e-06, -1.1576282711327026e-06, -1.8133422202398356e-07,
+        0.71908795951561821, 0.012127965596719531, -2.5203487367451225e-05, -5.4483861500474662e-07,
+        -4.9339939404248611e-09, 8.9827994886118488e-12, -0.16099792215043715, -0.0082071438531980227,
+        -0.00010865775469217074, -6.9080712787137311e-07, 4.8939707505590877e-09, 1.3030956884747355e-10,
+        0.024105094298415446, 0.0024410851451001202, 6.3356138684334437e-05, 9.9816017960197245e-07,
+        8.4166037074404495e-09, -1.0247242393273233e-11, -0.0045530198460393655, -0.00069018229172759305,
+        -2.6309700869330212e-05, -6.4049808323433175e-07, -1.0414789840579813e-08, -1.0098737298077935e-10,
+        0.00095700110005883933, 0.00019238891169216131, 9.72285434184077e-06, 3.2062832083492517e-07,
+        7.5032819117736438e-09, 1.2568543566931522e-10, -0.0002106906603289165, -5.2532741312099377e-05,
+        -3.2949952669043239e-06, -1.359472217749541e-07, -4.0649436852407278e-09, -9.1230273051466235e-11,
+        0.50342725607189298, 0.0041856876122477139, -8.0220188797454356e-05, -3.9109226234072275e-07,
+        3.2366917933101442e-09, 4.8192141721674312e-11, -0.069499820146874558, -0.0013987536783748643,
+        1.0087372717464253e-05, 2.2949654862815091e-07, 3.8051782180392649e-10, -3.3306146116731887e-11,
+        0.0050008396838778424, 0.00020213868882762136, 2.1225203115435272e-07, -4.0002379042638892e-08,
+        -3.894856741978802e-10, 5.3466942749508112e-12, -0.00043893079300871065, -2.8406485622335315e-05,
+        -2.1246294382157224e-07, 5.2451682007669319e-09, 1.0758763827867405e-10, -3.317424265354321e-13,
+        4.3674513596236113e-05, 3.8509900776662333e-06, 5.1095153854698623e-08, -5.0189058838960503e-10,
+        -2.1662304860818999e-11, -8.9048681782447833e-14, -4.5920226613948565e-06, -5.0791255555065279e-07,
+        -9.6063534745701588e-09, 1.8867528508746004e-11, 3.6409800457717154e-12, 4.0924447108149421e-14,
+        0.743120357220734, 0.0118984100565631, -3.2464919566261976e-05, -6.9238863391901559e-07,
+        2.2607687145322418e-08, 3.051763714011737e-08, -0.17830672123858751, -0.0091081526529503184,
+        -0.00011645956439265219, -6.1153845974468442e-07, 1.3400898129638154e-08, 7.6922199757265927e-09,
+        0.029533660490637607, 0.002998139001275889, 7.6147112013152579e-05, 1.1343924601303138e-06,
+        6.3203699193206546e-09, -1.9515577994128986e-09, -0.0061703034266384488, -0.00093439284899479432,
+        -3.5063644590104681e-05, -8.237110184420163e-07, -1.2326896193804962e-08, 3.9329444205042523e-11,
+        0.0014333198885154665, 0.00028780607847799888, 1.4379806414461941e-05, 4.6269588472745363e-07,
+        1.0349422135006801e-08, 1.4354899444407544e-10, -0.00034816261000259152, -8.6676243542808555e-05,
+        -5.3837170716887161e-06, -2.1774642758201803e-07, -6.2943611959965171e-09, -1.3098741378390979e-10,
+        0.51114237470218249, 0.0035255927847557262, -8.486549038791213e-05, -4.1420697004866122e-07,
+        3.3121429942872816e-08, 3.3892021909073161e-08, -0.072207840105968452, -0.0013069387690663064,
+        1.2882616363871288e-05, 2.3708366290864766e-07, -3.741461943823656e-09, -3.4813363816153136e-09,
+        0.0054052350515252116, 0.00020183481001766611, -2.9251593048198592e-07, -4.2790535474396819e-08,
+        -1.0830721908574379e-09, -9.7581748621288988e-10, -0.00049722441163700117, -2.9826636607735432e-05,
+        -1.3995183227934552e-07, 6.7587332223513686e-09, 1.3519020454887015e-10, 4.6978253109957547e-11,
+        5.1761979615336449e-05, 4.2297057685436114e-06, 4.2972119431473188e-08, -8.5137460926863874e-10,
+        -2.3421740925715551e-11, -1.5407628683128783e-12, -5.6832494650494763e-06, -5.8281757536386594e-07,
+        -9.0093462015668697e-09, 8.1979931756914259e-11, 4.3088120574996541e-12, 1.2930629182938866e-13,
+        0.36028080171866755, 0.0035321719333720361, -0.00022262458373571684, -6.070406268724693e-07,
+        9.5323607001171385e-09, -5.4173598667798901e-09, -0.073534151234286749, -0.0015336205187699437,
+        5.6265127197893119e-05, 7.3749865052784532e-07, 4.7458310864743797e-08, 8.7945012731892551e-09,
+        0.0065900997946678206, 0.00024595200634598127, -5.5094479750788378e-06, -1.4857856795005583e-07,
+        5.9079315519267844e-09, 8.0290301338436787e-10, -0.00064929012458046873, -3.9972554954798264e-05,
+        4.4865396337437137e-07, 3.2372370393000086e-08, -6.4510508864922689e-10, -1.2027672300902508e-10,
+        7.3418501717469119e-05, 6.6375603078180262e-06, -1.5505644414675487e-08, -6.1846316395957252e-09,
+        -1.5054228293067461e-11, 9.1974861394147951e-12, -9.0188971284934661e-06, -1.0609585114573851e-06,
+        -5.1143524711914419e-09, 1.0355825048672571e-09, 1.5799572939177412e-11, -8.502862340840314e-13,
+        0.76663395489730612, 0.011608938433701319, -4.0041034206483483e-05, -6.8346564914763859e-07,
+        -3.2090876737137257e-09, 8.3756673798947984e-11, -0.19747546736730687, -0.010065784405875779,
+        -0.00012270448294148702, -4.5211636757001607e-07, 9.8282764559519434e-09, 9.8652791928579984e-11,
+        0.03618347132550543, 0.0036635620264140558, 9.0418381568185211e-05, 1.2488126849500426e-06,
+        6.8860145877782668e-09, -6.3327456245239672e-11, -0.0083533697692397442, -0.0012579519575080819,
+        -4.6201868040953523e-05, -1.0379997004314776e-06, -1.4362151663350825e-08, -9.1140766076966284e-11,
+        0.0021437095093318533, 0.00042812688065703284, 2.1038735256916709e-05, 6.5614443340563199e-07,
+        1.3944193672340731e-08, 1.9775545334829267e-10, -0.00057421347438193387, -0.00014213188116377748,
+        -8.6986067704448192e-06, -3.4278208170592714e-07, -9.514841810890121e-09, -1.9015699484437077e-10,
+        0.51750377772688838, 0.0028331583980460897, -8.8134967885630387e-05, -2.5727482312550196e-07,
+        5.1111688019017679e-09, 4.2444231463124296e-11, -0.074710156947344591, -0.0011931646048470271,
+        1.554595008277458e-05, 2.1797336401358277e-07, -1.160306131884505e-09, -4.0955433660569118e-11,
+        0.0058047809270714412, 0.00019723424632798946, -8.6175311102962032e-07, -4.7884126053875637e-08,
+        -7.2463703511380593e-11, 1.0033918669856269e-11, -0.00055771795204883365, -3.0590847935670941e-05,
+        -4.8864843774887373e-08, 8.1692895953694478e-09, 6.5777480167504756e-11, -1.7408541474207664e-12,
+        6.0528482392744762e-05, 4.5265152701814466e-06, 3.0643514765634276e-08, -1.1904396169959826e-09,
+        -1.9304787120370513e-11, 2.2747638911203455e-13, -6.9170102166297823e-06, -6.4977710565544655e-07,
+        -7.6102972321890987e-09, 1.5085262427074218e-10, 4.2503550408744712e-12, -1.7778164538306574e-14,
+        0.87792498249711448, 0.0077171444906809937, -4.1670863380674226e-06, -1.2570651542598458e-07,
+        -5.7451939347812684e-10, 4.1341760313357848e-12, -0.15084856958249865, -0.0049517730268471109,
+        -4.2550497519522024e-05, -1.81471054976742e-07, 2.4862194915364045e-10, 6.0628611983476075e-12,
+        0.020321411942629597, 0.0013064365055529055, 2.1277075301998469e-05, 2.1495195555006883e-07,
+        1.3114642143558813e-09, 3.2672106542527291e-12, -0.0034360094069012643, -0.00032681314679974507,
+        -7.8149805894666545e-06, -1.2079818259463038e-07, -1.2925130770613737e-09, -9.6317718879304237e-12,
+        0.00064126975698929891, 8.0791680024805881e-05, 2.5595732432317593e-06, 5.327607861258222e-08,
+        8.0045481803199828e-10, 9.1923301582411329e-12, -0.00012549732668988518, -1.9640456652578044e-05,
+        -7.7262603685499794e-07, -2.0086907355581668e-08, -3.8265268425409504e-10, -5.7656627145907562e-12,
+        0.66981767313009566, 0.0026680706151406539, -2.9653027815274913e-05, -1.0751583230323403e-07,
+        4.0154681893037603e-10, 5.3726300637674692e-12, -0.069521433776333699, -0.00098093578069190527,
+        2.1793171222224602e-06, 5.9011829886203027e-08, 1.2145656624859216e-10, -2.9897928413531708e-12,
+        0.0047081261941195598, 0.0001390386535503724, 3.4134351791688252e-07, -8.7463554525262255e-09,
+        -6.8892194941501052e-11, 3.3573177072319309e-13, -0.00040278789232356009, -1.8159077032961502e-05,
+        -1.1594773960305429e-07, 8.8421291093646826e-10, 1.6411839312775766e-11, 1.0296546580089516e-14,
+        3.8110462674619746e-05, 2.2926755873762276e-06, 2.3395672673879138e-08, -3.857195472290307e-11,
+        -2.8977654999334611e-12, -9.4818849386733956e-15, -3.7871857952162748e-06, -2.843764767921758e-07,
+        -3.9745290882806875e-09, -9.3679569250873579e-12, 4.1239168212596012e-13, -1.7333014316978493e-15,
+        0.89332105188352362, 0.0076776240975738432, -5.727863329394094e-06, -1.3418653229110014e-07,
+        -4.7992425949692973e-10, 5.890814619648603e-12, -0.16109936134209893, -0.0053008102419774411,
+        -4.4700067865628816e-05, -1.7647911324439732e-07, 3.7317510139464956e-10, 5.3683104158561416e-12,
+        0.023112924305392163, 0.0014873317320828329, 2.3984228891941221e-05, 2.3637695033257423e-07,
+        1.3658805581959779e-09, 2.8024365296163035e-12, -0.0041570035434502382, -0.00039549731131305219,
+        -9.394942466268275e-06, -1.4301972859149569e-07, -1.4884536895966653e-09, -1.0238312046366003e-11,
+        0.00082551720050453236, 0.00010405741728537818, 3.2819366256379154e-06, 6.7612317848110144e-08,
+        9.9769392638930351e-10, 1.0469903990070202e-11, -0.00017180192996598019, -2.6898715354535508e-05,
+        -1.0543538782595807e-06, -2.7187938467292376e-08, -5.1017641918148076e-10, -6.7605412074203086e-12,
+        0.67491258702200618, 0.0024258030280363339, -3.0901119917874148e-05, -1.0023082132328792e-07,
+        5.0896992976860175e-10, 5.3371220468492955e-12, -0.071463608122492764, -0.00096064033496944055,
+        2.8970710388401469e-06, 6.0454078354779788e-08, 5.757774113612113e-11, -3.3780728717529199e-12,
+        0.0049885890361436418, 0.00014133140995743973, 2.3002524131329679e-07, -9.7858952373223284e-09,
+        -6.0568916862272055e-11, 4.8305211807524605e-13, -0.0004399968741643318, -1.9039748371697036e-05,
+        -1.0376013952769877e-07, 1.1468852151107012e-09, 1.6325544056586463e-11, -2.2069260218389009e-14,
+        4.2880945158416087e-05, 2.4771829578572224e-06, 2.2646452369653038e-08, -8.6965518622080219e-11,
+        -3.1529132638612392e-12, -3.0776885968953625e-15, -4.3880072942158263e-06, -3.1650338329988942e-07,
+        -4.0444038395466864e-09, -2.0700231327860256e-12, 5.041298542090305e-13, 1.5914581606313557e-14,
+        0.5224562601271191, 0.002117180895361111, -9.0705258114307441e-05, -1.6923560794353356e-07,
+        5.8581169890146307e-09, 3.1394621380400298e-11, -0.076964099041777298, -0.0010587115817217725,
+        1.8023507477515031e-05, 1.9295911201042241e-07, -1.9562356439643581e-09, -3.7771564668550875e-11,
+        0.0061905322024315163, 0.00018803774021811722, -1.4364943737777816e-06, -4.7378634724072132e-08,
+        1.3808504637940188e-10, 1.0782634966528429e-11, -0.00061896937514494324, -3.057459562549727e-05,
+        5.423330053492044e-08, 8.9131388365317532e-09, 2.5620624544504549e-11, -2.2357503345602181e-12,
+        6.97779760497544e-05, 4.7096656131245559e-06, 1.4679770940615029e-08, -1.4551051530563584e-09,
+        -1.328279846570821e-11, 3.7537684281625971e-13, -8.2709221404598374e-06, -7.0229907658008021e-07,
+        -5.4086851219778766e-09, 2.1441707859498706e-10, 3.5752127347088511e-12, -5.2095724881636015e-14,
+        0.3655503807538914, 0.0017352229407137519, -0.00022533696428132566, 1.0155349808234132e-07,
+        4.0675407984687738e-08, -4.3793877115812175e-11, -0.076130637223893002, -0.0010584451679809398,
+        6.1800616071240868e-05, 3.3454994598191119e-07, -1.9409739033242032e-08, -1.4612462225297848e-10,
+        0.0070324377281141461, 0.00019497928966086183, -7.1791301759426523e-06, -1.1572419860423483e-07,
+        3.4356938763974933e-09, 7.2918106164521194e-11, -0.0007244055811292553, -3.4818399273646783e-05,
+        8.3488130254303386e-07, 2.9327256624484547e-08, -5.0122984032231687e-10, -2.170379744816099e-11,
+        8.6328603706236305e-05, 6.208797099812742e-06, -9.1682381786144704e-08, -6.1744040707813191e-09,
+        5.6492972973413834e-11, 5.1407153333833556e-12, -1.1140070250478776e-05, -1.0489948489605809e-06,
+        8.3092537233768421e-09, 1.1510821248734504e-09, -2.9805021657736449e-12, -1.0659245611996983e-12,
+        0.22036065617093833, 0.0015617862357551855, -0.0004784140075195525, 1.4839803237555947e-06,
+        -1.1960076748353383e-07, 2.2462306659683015e-07, -0.065136547150694807, -0.0011900190734832115,
+        0.00017764312369187272, 2.5112262225869786e-07, -4.2023835783171735e-07, 1.664032907628063e-07,
+        0.0076451932933365285, 0.0002547557821810864, -2.4155179903134133e-05, -1.9835038288131227e-07,
+        3.7077230247248774e-08, -6.8789236568801099e-09, -0.00085388901969892937, -3.8204179333306386e-05,
+        3.1288606764492166e-06, 4.8501717949027373e-08, -2.981609436970073e-09, -9.869421948883009e-10,
+        9.7500931280647133e-05, 5.786031543663192e-06, -4.2282315881484267e-07, -1.2806059767174864e-08,
+        4.1840524180259235e-10, 2.4150709218670405e-10, -1.2092214675182738e-05, -1.0324481210687003e-06,
+        5.8082234189708254e-08, 3.2048233613823116e-09, -8.4313529152338912e-11, -3.0295958371757199e-11,
+        0.90862529177132234, 0.0076252385853446784, -7.3802657933763598e-06, -1.4089390966421953e-07,
+        -3.5235887720524838e-10, 8.0516731598214971e-12, -0.17206521095811569, -0.0056667712613111083,
+        -4.6778116229393574e-05, -1.6958621041480404e-07, 4.8427539089986957e-10, 3.518387508669195e-12,
+        0.026288708561195383, 0.0016909268020410925, 2.6953451325393878e-05, 2.5861222281553568e-07,
+        1.4127653182713992e-09, 3.2179408215400525e-12, -0.0050288887599298461, -0.00047794263135507963,
+        -1.1261026000110152e-05, -1.6853219657270368e-07, -1.7031369879571923e-09, -1.1643951919241909e-11,
+        0.0010626598371915757, 0.00013384711461290918, 4.1966710544499187e-06, 8.5441700095129306e-08,
+        1.2368321527406113e-09, 1.2879339654059681e-11, -0.00023517321539266562, -3.6789373828688629e-05,
+        -1.4348402775488245e-06, -3.664333173486573e-08, -6.7710172124697403e-10, -8.8715889245099435e-12,
+        0.67951327837774189, 0.0021739294782181372, -3.2051538060980274e-05, -9.1243521468557294e-08,
+        6.1370661755195813e-10, 5.1112429641016119e-12, -0.073359407364532184, -0.00093455154859522723,
+        3.6257658584675898e-06, 6.0818824330723452e-08, -1.2873987835865501e-11, -3.6491739343010617e-12,
+        0.0052727090925701967, 0.00014268621715685825, 1.0713178508039983e-07, -1.0668008324404866e-08,
+        -4.9216807402861422e-11, 6.3590182190288543e-13, -0.00047885976566029086, -1.9810384163019428e-05,
+        -8.8450927673150691e-08, 1.402659636461031e-09, 1.5532016689247535e-11, -6.3967368207501365e-14,
+        4.8012564507694496e-05, 2.6533103034213047e-06, 2.1294888456560354e-08, -1.386509107453549e-10,
+        -3.2915838938503235e-12, -5.3316375902283717e-15, -5.0533481446173385e-06, -3.4881626147410389e-07,
+        -4.018816912397337e-09, 6.4969308853307321e-12, 5.5961682070807452e-13, 2.5863356498819538e-15,
+        1.0020032916496124, 0.0049932662594692704, 1.5101570118374684e-06, -1.9575967468202996e-08,
+        -6.4117716769478284e-11, 2.2658984132871389e-13, -0.12076285793267107, -0.0024752399166415016,
+        -1.3860857732635326e-05, -4.6223068964685491e-08, -6.3714575547818627e-11, 1.1735282429104827e-13,
+        0.012488210883326962, 0.00049469612918095075, 5.089556877614135e-06, 3.440669424020564e-08,
+        1.6164376636573283e-10, 5.3848197644341257e-13, -0.0016130655394162741, -9.4301452089020791e-05,
+        -1.413411351385896e-06, -1.4145612799851748e-08, -1.0370010879138646e-10, -5.7767439558308516e-13,
+        0.00022946045046477653, 1.7762409244495084e-05, 3.5075747678672754e-07, 4.6488325535804086e-09,
+        4.5969116623349265e-11, 3.2658176299622266e-13, -3.4328908751190605e-05, -3.3047955613502401e-06,
+        -8.0871217087294835e-08, -1.3292130397872482e-09, -1.6350721116114512e-11, -9.3112239330060464e-14,
+        0.82405122692435129, 0.0021469556528593927, -9.1007718498142833e-06, -2.9928810566112374e-08,
+        1.3787002964302661e-11, 4.1059119313413773e-13, -0.06414379871292597, -0.00069295481227872309,
+        -3.5822982196818713e-07, 1.1248158615057012e-08, 3.9012254936455797e-11, -8.4903547126277542e-14,
+        0.0038093095539296373, 8.2968115820557283e-05, 2.8167482058329968e-07, -9.0811537379066198e-10,
+        -1.0527900015740904e-11, -1.3236201091181985e-14, -0.00028414240344603112, -9.237861683761714e-06,
+        -5.6253222392012227e-08, -2.7992138161969462e-11, 1.6174805726720595e-12, 1.3351379036812678e-14,
+        2.3275718987182972e-05, 1.0042173534705207e-06, 8.8054204236473485e-09, 2.639311922366976e-11,
+        -1.4395478335756413e-13, 2.6892446418268817e-14, -2.0048744842731218e-06, -1.077647779057946e-07,
+        -1.2319985112577542e-09, -6.3341426484314646e-12, -4.1117809087046002e-15, -1.2800003531417852e-14,
+        1.0120011494362449, 0.0050043907468421116, 1.2692284410869706e-06, -2.0567667267606989e-08,
+        -5.9911581889904779e-11, 4.6217478853019244e-13, -0.12582599320662458, -0.002588362617523733,
+        -1.4421563860284532e-05, -4.7221592944943947e-08, -6.066668091156833e-11, -2.4404204261168109e-13,
+        0.013519658598893211, 0.00053710885080761306, 5.5182935695072559e-06, 3.7075770759810669e-08,
+        1.7178963779113441e-10, 7.5432204648530739e-13, -0.0018135337593457566, -0.00010631682258473401,
+        -1.5934999956309107e-06, -1.5899588685800346e-08, -1.1565538254856505e-10, -7.5067178407204994e-13,
+        0.00026797716289911024, 2.0804653739333737e-05, 4.1119285122979716e-07, 5.4428389633347184e-09,
+        5.3569019347705226e-11, 3.3795530691140948e-13, -4.1639289760254675e-05, -4.0202737292023496e-06,
+        -9.8504094667644448e-08, -1.6182152041623037e-09, -1.9927715817953534e-11, -8.1925334741325717e-14,
+        0.82827119781752978, 0.0020727172674852869, -9.4583233121001807e-06, -2.9642342526312248e-08,
+        2.2062867150777629e-11, 4.4153197703014656e-13, -0.065532139370168122, -0.00069527030163111755,
+        -2.1958237411425037e-07, 1.185380823457813e-08, 3.6636881434183528e-11, -1.3710828608288311e-13,
+        0.0039774626399799286, 8.5175039510143431e-05, 2.6975745121924682e-07, -1.0787423741532753e-09,
+        -1.0788331759680439e-11, -1.8532129044864233e-14, -0.00030306889572522102, -9.6887762592847833e-06,
+        -5.6427665581458144e-08, -6.9207219822497951e-13, 1.7691606509590374e-12, 1.352457157070618e-14,
+        2.5355565910214432e-05, 1.0758791566925254e-06, 9.1048260045639494e-09, 2.3414808326303429e-11,
+        -1.8255481240284358e-13, -1.2029181521266225e-14, -2.2304991859947872e-06, -1.1792256439543477e-07,
+        -1.3071473582968215e-09, -6.1846443619825697e-12, -1.7318711694296584e-15, 2.8297141812609816e-14,
+        0.68360138063906006, 0.0019133120392213617, -3.3084242309026275e-05, -8.0628569964024303e-08,
+        7.1175842479699783e-10, 4.6719877611091476e-12, -0.075197199384592947, -0.00090263522489248554,
+        4.35191862129805e-06, 6.0020304881335183e-08, -8.735787960391966e-11, -3.7719525018307128e-12,
+        0.0055585244134078258, 0.00014301883289356699, -2.5166163818996664e-08, -1.1346506401142252e-08,
+        -3.5186655336572603e-11, 7.6644361834674529e-13, -0.00051913192714337275, -2.0446544294302416e-05,
+        -7.0174285893975545e-08, 1.6395548348300275e-09, 1.3964433458503602e-11, -1.0138880774241008e-13,
+        5.3483641907036324e-05, 2.8161165454182193e-06, 1.9314240277407724e-08, -1.9144549233752177e-10,
+        -3.2862307792114672e-12, 1.2546978735383007e-14, -5.7827720940020521e-06, -3.8049575728515085e-07,
+        -3.8843839987118848e-09, 1.603895485978701e-11, 6.219571190548452e-13, -2.6720833826563518e-15,
+        0.52595970189710617, 0.0013850515261527143, -9.2155558910332256e-05, -7.1287530532675739e-08,
+        6.3343700448466709e-09, 1.5568952962387494e-11, -0.078930413621337056, -0.00090584856382005272,
+        2.0127520578793579e-05, 1.560079792973105e-07, -2.6354547187181752e-09, -2.9339572922030703e-11,
+        0.006553352584006817, 0.0001743254410425726, -1.9847303883123654e-06, -4.3467856084816754e-08,
+        3.4805837815014829e-10, 9.944818058338883e-12, -0.00067934337858747268, -2.9709417606330077e-05,
+        1.6213145211855204e-07, 8.9526538825649564e-09, -2.1157868787565138e-11, -2.3776145453260145e-12,
+        7.9257303268992943e-05, 4.7542575260608744e-06, -3.7885585399860183e-09, -1.6014145579305529e-09,
+        -4.6921447377905477e-12, 4.7144054890577916e-13, -9.7100131005626745e-06, -7.3439208488827592e-07,
+        -2.5315108247183152e-09, 2.6175620645498917e-10, 2.2372754799506091e-12, -8.3524938262063443e-14,
+        0.93885166589073954, 0.0074795409373014602, -1.0854900956982037e-05, -1.4674229053014114e-07,
+        1.2158757450101121e-11, 1.1357708821559412e-11, -0.19627343759860211, -0.0064466795992901916,
+        -5.0640372660993647e-05, -1.5159200646897916e-07, 6.1249150606193055e-10, 2.5597988116442136e-13,
+        0.033987532899090123, 0.0021748204117878751, 3.3713830010502705e-05, 3.0521974300089102e-07,
+        1.5020540947469075e-09, 3.0740171524230481e-12, -0.0073503388369893915, -0.00069427064649770333,
+        -1.6020634967201396e-05, -2.3068286752271184e-07, -2.1950778128930317e-09, -1.3849038238704319e-11,
+        0.0017583777070511737, 0.0002202783800237904, 6.7972762916440294e-06, 1.3460167835384952e-07,
+        1.8723956433612967e-09, 1.9131697350990043e-11, -0.00043984147504093059, -6.8421113986998227e-05,
+        -2.6309412555612537e-06, -6.5626282166080607e-08, -1.1743047235386968e-09, -1.5838393912908154e-11,
+        0.68716040809862144, 0.0016449684166968306, -3.3980479041338522e-05, -6.852596912965235e-08,
+        7.9899804279183392e-10, 4.0223916013592406e-12, -0.076965394273656201, -0.00086496840747832769,
+        5.0612817193048552e-06, 5.8018178768564643e-08, -1.6278970245822051e-10, -3.7372416287621455e-12,
+        0.0058439236146733634, 0.00014226449721443463, -1.6418036507299101e-07, -1.1781902963977108e-08,
+        -1.8936816235184194e-11, 8.5543199262613283e-13, -0.00056052153190485146, -2.0925603101967646e-05,
+        -4.922987081287229e-08, 1.8454231356956746e-09, 1.1647285448062934e-11, -1.334348736818934e-13,
+        5.9262490276252033e-05, 2.9605582571203398e-06, 1.6706305380332569e-08, -2.4277909581391058e-10,
+        -3.1121501666407857e-12, 1.9225912773383891e-14, -6.5741097966917293e-06, -4.106316144268109e-07,
+        -3.6319512492373221e-09, 2.6083823881079432e-11, 6.3549618336447972e-13, -6.6400173264387536e-15,
+        0.9537183462772717, 0.0073856790204892631, -1.2606951630023651e-05, -1.4466097590149199e-07,
+        2.5436715278638725e-10, 1.3606950414943707e-11, -0.2095775626884136, -0.0068589124629396857,
+        -5.2400771868462551e-05, -1.4185240288340435e-07, 5.9416449559906665e-10, -3.6358964944652492e-12,
+        0.038618773978997996, 0.0024595945236289048, 3.7522573945781802e-05, 3.2972574122251263e-07,
+        1.5644600404030115e-09, 4.4951044642567691e-12, -0.0088762464935913266, -0.00083412663815600409,
+        -1.9008733301357839e-05, -2.6804424197052086e-07, -2.4797349057582263e-09, -1.5595923479325653e-11,
+        0.0022588068203530675, 0.00028165682019751448, 8.6053756282819153e-06, 1.6778439627444423e-07,
+        2.2873226917727243e-09, 2.3035755169809951e-11, -0.00060046723303270157, -9.2963566967721372e-05,
+        -3.5423349977911764e-06, -8.7166539770287472e-08, -1.532333808847595e-09, -2.0317157288651141e-11,
+        0.69017605438181118, 0.0013700585099930618, -3.4723567610167282e-05, -5.5140864486454291e-08,
+        8.7144412416000565e-10, 3.2005461918954851e-12, -0.078652671111144157, -0.00082174318713647493,
+        5.7394329955104381e-06, 5.4824568827319166e-08, -2.3571619825064222e-10, -3.5329740181261933e-12,
+        0.0061266886872655187, 0.00014038169186804329, -3.0680659852347692e-07, -1.194490783272007e-08,
+        -1.2603328882187351e-12, 9.1385123282920118e-13, -0.00060269435229909894, -2.1227903182195705e-05,
+        -2.6058620135926348e-08, 2.0090422740426392e-09, 8.69019203336113e-12, -1.6207589623296548e-13,
+        6.5307449646849394e-05, 3.0817325716329985e-06, 1.3504693678093217e-08, -2.899611294358312e-10,
+        -2.7551358653552222e-12, 1.6878828750345777e-14, -7.4233151170991709e-06, -4.3826202132016446e-07,
+        -3.2579579556438731e-09, 3.6199905533319942e-11, 6.1088989870782249e-13, -1.4913153662070935e-16,
+        0.5279910793025977, 0.00064612543004260721, -9.239585635798844e-05, 3.1552262947960868e-08,
+        6.459494644257176e-09, -3.3832995093059706e-12, -0.080575695095294497, -0.00073809733085652334,
+        2.1729321721340789e-05, 1.0979557993438123e-07, -3.099706707317377e-09, -1.6504229991237838e-11,
+        0.0068845501968494999, 0.00015647022719269884, -2.4667233044737225e-06, -3.6421098692777505e-08,
+        5.2489868347541716e-10, 7.4934141936137938e-12, -0.00073713137896539978, -2.7991963269790952e-05,
+        2.6598698737776774e-07, 8.2422736863298675e-09, -6.6760812058086071e-11, -2.1074930596974831e-12,
+        8.8674236780077572e-05, 4.6465358219933457e-06, -2.3138084492665403e-08, -1.5992176070009879e-09,
+        4.9922584800105831e-12, 4.755893619840122e-13, -1.1188758189614124e-05, -7.4160075064490928e-07,
+        7.6772599205703018e-10, 2.8362228399283455e-10, 4.4511065545023169e-13, -9.6229646734405734e-14,
+        0.36722970238764457, -5.1685847444139267e-05, -0.00022028473244425895, 7.3225866775657179e-07,
+        3.7387957873196504e-08, -2.8321163076858921e-10, -0.077744238460473528, -0.00055341282311426466,
+        6.3890843136354489e-05, 1.1656276740258751e-08, -2.0266574129269929e-08, 6.5461200720892525e-11,
+        0.0073612872876769649, 0.00013301901702057734, -8.1988570278971312e-06, -5.1921317433854905e-08,
+        4.3529771305954532e-09, 1.5347196582822591e-11, -0.00078636475107846278, -2.6897567300247116e-05,
+        1.1260950321468491e-06, 1.8389259236413089e-08, -8.2651364523314083e-10, -9.5283801856812487e-12,
+        9.7793798063781784e-05, 5.2016469247012034e-06, -1.5721745701343708e-07, -4.5333220667468812e-09,
+        1.4171527383542841e-10, 3.0030439283085156e-12, -1.3129456120156821e-05, -9.2965250122636154e-07,
+        2.1158204674512472e-08, 9.4200412637308665e-10, -2.2168579168538137e-11, -7.5977976087506981e-13,
+        1.06215052461113, 0.0049381883014094751, -3.3871345994135294e-05, -3.5874081572351859e-06,
+        0, 0, -0.15478992588870344, -0.003213139048704787,
+        2.9958674724786479e-06, 6.2587324793634369e-06, 0, 0,
+        0.020553862729317293, 0.0013889264040733208, 0.00022170463901179623, 2.5339488360359573e-05,
+        0, 0, 0.0031776772698914996, 0.0098094721674708962,
+        0.0044269479693476201, 0.00087532086038034018, 0, 0,
+        0.00092333958129465457, 0.00055260306999013503, 0.00019286021739988476, 1.7486840399217747e-05,
+        0, 0, -0.01382956007475611, -0.021321427352018155,
+        -0.0094771016875443651, -0.0018762105113070149, 0, 0,
+        0.84673999396230415, 0.0012454574083151713, -0.00024383339373606474, -8.3440250163584049e-05,
+        -1.6666609688780679e-05, -1.2982641386420212e-06, -0.072065065040444951, -4.1139227124370054e-06,
+        0.00038318570714692367, 0.00013558667922012541, 2.6244487940243059e-05, 1.8088777573909157e-06,
+        0.0046478591226919138, -0.00028497191806142416, -0.00020800487619493287, -7.0680717216427464e-05,
+        -1.2202400552935622e-05, -4.7770857873234107e-07, -0.00032948509366028853, 0.00012076883161018875,
+        6.92809799841787e-05, 2.0994714198717056e-05, 2.6484171341826288e-06, -4.945050309293316e-08,
+        2.1381065388072988e-05, -2.4283025842363474e-05, -1.1303906061217589e-05, -2.1992508622648716e-06,
+        0, 0, -1.8477353333676369e-06, 2.0815998728444712e-06,
+        1.6804905436748041e-07, -2.6912025691492888e-07, 0, 0,
+        0.84959942927308651, 0.0015489554419828707, -1.1557965425658796e-05, -2.475939830042664e-08,
+        6.7048810003730211e-11, -7.6933620120079983e-11, -0.072824599452749911, -0.00064952898407518323,
+        9.0780995295969829e-07, 1.3919245491381376e-08, 2.3150125640383914e-11, 1.1974494968250727e-10,
+        0.0044956049835005833, 7.6421717400378407e-05, 5.5674447917253037e-08, -1.8646385250902303e-09,
+        -1.3053810771025221e-11, -5.3109315893985228e-11, -0.00023196465261340321, -5.2390971695509803e-06,
+        -1.0642797393379011e-08, 1.3220839199063818e-10, 2.189645778411633e-12, 1.0530726189402646e-11,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.6926364578134705, 0.0010898647577472177, -3.5299660389321483e-05, -4.073929625985464e-08,
+        9.2553551361774198e-10, 2.1943640932336661e-12, -0.080248207402234928, -0.00077326549695511386,
+        6.3724328929108608e-06, 5.0508131839502192e-08, -3.0256455210932823e-10, -3.1264070348842357e-12,
+        0.0064045443793267981, 0.00013735492082021404, -4.4966685679678362e-07, -1.181959230137642e-08,
+        1.6948425172193977e-11, 9.0662185763324722e-13, -0.00064528078166772613, -2.1337827004858467e-05,
+        -1.226251736114533e-09, 2.1210264591113801e-09, 5.2186171560791133e-12, -1.8853903969204566e-13,
+        7.1567426857640978e-05, 3.175136245521137e-06, 9.7755719703973981e-09, -3.3030326160261682e-10,
+        -2.2549399524432775e-12, 2.7323545752280434e-14, -8.3244099146189215e-06, -4.6242218708664901e-07,
+        -2.7652945057021338e-09, 4.5793684999187197e-11, 5.577091757255641e-13, -7.9397516241617818e-15,
+        0.94105827051571078, 0.004368701463319395, -5.3640791873919398e-05, -3.1889555584825034e-07,
+        1.5563980463960164e-09, 1.1315964324690609e-11, -0.17107390931627814, -0.0030768248817298919,
+        1.0730470921919933e-05, 2.728811496048445e-07, -1.2724923136820684e-10, -5.5547265290984789e-12,
+        0.013741197796891123, 0.00039205537357781786, -3.4128715179846931e-07, -3.8820593927851147e-08,
+        -7.9959015890481986e-11, -1.0555991302221386e-12, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.69453242161084783, 0.00080576668290107875, -3.5698425426206039e-05, -2.5639487663851728e-08,
+        9.5832526188634187e-10, 1.075748177788763e-12, -0.081741900745810128, -0.00071994852790256897,
+        6.9475051170607405e-06, 4.5193745243748113e-08, -3.5991518557503279e-10, -2.5910491452722523e-12,
+        0.0066752118952480609, 0.0001331962195124481, -5.892834861411693e-07, -1.14055191846704e-08,
+        3.4636808520810984e-11, 8.6019305077793553e-13, -0.00068788482955164812, -2.124468884761327e-05,
+        2.4604937811581777e-08, 2.1747352943176253e-09, 1.4710898214905974e-12, -1.8376130687224948e-13,
+        7.7982949285415506e-05, 3.2369183181158246e-06, 5.6153538354403751e-09, -3.6147366822560283e-10,
+        -1.630266799548339e-12, 2.6217454132878995e-14, -9.2695313171494436e-06, -4.8219778667820248e-07,
+        -2.163741074817716e-09, 5.425625017350184e-11, 4.7497413160979328e-13, -7.8892654258274667e-15,
+        0.52854659474911114, -8.9782032705505664e-05, -9.1402825184256731e-05, 1.3328925535651407e-07,
+        6.1942119398870359e-09, -2.3045016921909316e-11, -0.08187449133615772, -0.00055985553604871014,
+        2.2741026244906569e-05, 5.8373900177348058e-08, -3.2785002759170053e-09, -1.1594816907445648e-12,
+        0.0071764804139777339, 0.00013514121514405332, -2.8490318598144669e-06, -2.7009163909384339e-08,
+        6.3976180660148241e-10, 3.8375608568636601e-12, -0.00079068901476814126, -2.5489611629083791e-05,
+        3.5719035181773544e-07, 6.8675707303498509e-09, -1.0295296125563132e-10, -1.4584308071460631e-12,
+        9.7722860301371669e-05, 4.3867358339240991e-06, -4.1543221709708959e-08, -1.4460569639263385e-09,
+        1.386246050912275e-11, 3.9292249732450555e-13, -1.2655049215555905e-05, -7.2186731389127987e-07,
+        4.1516724119431707e-09, 2.7567781968086962e-10, -1.416472375873294e-12, -8.915208627848978e-14,
+        0.84809981196782214, 0.0053306797681935743, -0.00019803128365490598, -1.6356282128100893e-06,
+        2.7902856559507467e-08, 4.8700764793076348e-10, -0.28017869133717738, -0.0080752453182497304,
+        9.9782870322709247e-05, 2.8101456799984005e-06, -2.2694332315024187e-08, -8.7965601533326432e-10,
+        0.062585122547416577, 0.0031979427001014179, -2.0241651083471064e-05, -1.3142682911227354e-06,
+        4.5331637801615711e-09, 4.6938425910215484e-10, -0.013743238843828909, -0.00090841686525390888,
+        2.6560163553212396e-06, 4.1319446663301087e-07, -6.3314853066272395e-11, -1.6245026086724584e-10,
+        0.0022753690687100743, 0.00017317771005185127, -1.0980588993109716e-07, -8.3551957515972802e-08,
+        -1.9462236805205359e-10, 3.4951508747756117e-11, -0.00020232787538874736, -1.676842377878036e-05,
+        -1.6156632833895286e-08, 8.370209188257576e-09, 3.525131759163277e-11, -3.591374747689383e-12,
+        0.52764203515119967, -0.00081296349207243661, -8.9227173981540754e-05, 2.2770984651278264e-07,
+        5.5514216562896696e-09, -4.0694685942040173e-11, -0.082810683146804648, -0.00037601337164753655,
+        2.3128764993882476e-05, 6.5812745612970349e-09, -3.1460673721366519e-09, 1.4181055554272805e-11,
+        0.0074230700063306109, 0.00011123091538077018, -3.1099186468961991e-06, -1.6384213641556725e-08,
+        6.7484375857541933e-10, -3.423770929613424e-13, -0.00083857078336538337, -2.233235946934193e-05,
+        4.2890824277603139e-07, 5.0345269346778124e-09, -1.2327175796412854e-10, -5.5573803282487433e-13,
+        0.00010611205798562944, 3.9892940561920017e-06, -5.733249327916473e-08, -1.1697620784039472e-09,
+        2.0149918932064637e-11, 2.2966492168623618e-13, -1.4055451177669832e-05, -6.759344379164033e-07,
+        7.2689770435345278e-09, 2.400322081378336e-10, -2.9572292296302589e-12, -6.7113162963726556e-14,
+        0.36539872604057771, -0.0017691512646363992, -0.00020813246721233382, 1.2738449516912539e-06,
+        2.970563387267642e-08, -4.7002707584147727e-10, -0.078343272817186324, -4.706470802824148e-05,
+        6.216554560457645e-05, -2.9073953678295372e-07, -1.6898304077648898e-08, 2.613224823936807e-10,
+        0.0075605980538112731, 6.6120169427046676e-05, -8.4054145090429141e-06, 1.6635542536056587e-08,
+        4.0124576602178222e-09, -4.7592856964784765e-11, -0.0008306170244493132, -1.723977984508014e-05,
+        1.263950203880452e-06, 4.5131369577018368e-09, -8.5612892138289416e-10, 6.4414890956562308e-12,
+        0.00010679655321410662, 3.7682237259027781e-06, -1.9663034041433426e-07, -1.9723890465070323e-09,
+        1.6685694500598467e-10, -5.4260493989942766e-13, -1.4788575314137762e-05, -7.2212954910037645e-07,
+        2.994653681011777e-08, 5.0161189615756694e-10, -3.0558607432965454e-11, -4.8828525628265277e-14,
+        0.21976245770399819, -0.0021242109014150685, -0.00043589190132583948, 5.3317806009010282e-06,
+        1.7024923346852098e-07, -4.2441141829911473e-09, -0.066107640369280685, 0.00021326409675886569,
+        0.00017074339019011289, -1.3421711072342755e-06, -9.9954803191699899e-08, 2.472636394534842e-09,
+        0.007958678663276101, 5.8682500367047056e-05, -2.4214627200263099e-05, 1.7684439070929769e-07,
+        2.0384657185372132e-08, -6.2449056702542743e-10, -0.00090437872890769609, -1.2204455981617856e-05,
+        3.2277267072320269e-06, -3.1149061505584384e-08, -4.3431368380485556e-09, 1.2168834950722869e-10,
+        0.00010538271495665627, 2.0447352023665185e-06, -4.8394855233604548e-07, 3.0053329140607259e-09,
+        9.6126169327195399e-10, -1.6882124973100694e-11, -1.3601090198687936e-05, -4.5764330393636372e-07,
+        8.0508385832362034e-08, 3.5702014906156672e-10, -1.9405542071873464e-10, 1.7170878370984396e-12,
+        0.10935362878607378, -0.00073178276492951268, -0.00074516111496722675, -2.4954005639486061e-06,
+        -8.9567798533709352e-06, -2.7380215076470934e-06, -0.044108746349641792, 0.00072547604890081099,
+        0.00042851801278380946, -4.0803654792415312e-05, -2.6959913532614322e-05, -2.5296384137150802e-06,
+        0.0065598036559373213, 0.00012209365629149138, -2.5938308285587258e-07, -1.4977381019009874e-05,
+        -3.0714819227572794e-05, -2.7630116336083664e-06, -0.00095412433451980768, -8.419631692876938e-05,
+        8.5705282183723227e-05, 6.149371943913915e-06, -2.8144772592479044e-05, -6.9953919516811899e-06,
+        0.0001633446244003905, -5.9625773214111654e-05, 3.0173308193424717e-05, 2.8655221159367562e-05,
+        -1.2469132600295136e-05, -1.8655060726391628e-05, -4.9144875680135355e-06, -1.6538502131167615e-05,
+        -1.5513311339509006e-05, 3.1880464537197269e-05, 4.590367212871188e-06, -2.1850389920762327e-05,
+        0.85712055325223702, 0.003676154302362648, -0.00021470629079144352, -1.1258928319103053e-06,
+        3.5025032018600878e-08, 2.3488804277448269e-10, -0.29542929768346921, -0.0071494860969431549,
+        0.00013080532340330585, 2.3247258515116297e-06, -3.7016591398811453e-08, -5.6768232558416246e-10,
+        0.068770443973986947, 0.0029748240521662553, -3.5291675221992846e-05, -1.173922173624928e-06,
+        1.2666941689840195e-08, 3.5665521112611278e-10, -0.015523290139136819, -0.0008675867829452986,
+        7.5075962064192516e-06, 3.8818351368965641e-07, -2.9903521499490432e-09, -1.3872301555910681e-10,
+        0.0026176674870721879, 0.00016828687926922489, -1.1091650408693696e-06, -8.1420288665543509e-08,
+        4.5410833478571935e-10, 3.3517234395846052e-11, -0.00023567271740525353, -1.6491716435340519e-05,
+        8.5354405434651448e-08, 8.3809093423094628e-09, -3.4053625214987647e-11, -4.0827030488889818e-12,
+        0.52531196556568838, -0.0015144078806718193, -8.5991155355055355e-05, 3.0923618734830727e-07,
+        4.5968887119605931e-09, -5.3865584609060769e-11, -0.083378016438467498, -0.00019149664250038263,
+        2.2917502514245514e-05, -4.0744906743807307e-08, -2.7284487800764732e-09, 2.697522598458116e-11,
+        0.0076201582046478396, 8.5746717059197205e-05, -3.2426882687778029e-06, -5.8618382394750957e-09,
+        6.2792884459724126e-10, -4.2437413959268838e-12, -0.00087963693346355964, -1.869346838343713e-05,
+        4.7729200334555426e-07, 3.0256015094453252e-09, -1.2482090275216273e-10, 3.9862163805738585e-13,
+        0.00011359158519822132, 3.4802382952103999e-06, -6.9321401848890306e-08, -8.2200455612994431e-10,
+        2.268939436012846e-11, 2.582833385830568e-14, -1.5340668273583263e-05, -6.0714603769936885e-07,
+        9.8312159537529555e-09, 1.8481544519455486e-10, -3.8228107184486633e-12, -2.4438571652059259e-14,
+        0.86271929579269346, 0.0019142012062923677, -0.00022476872858006794, -5.4813409021044172e-07,
+        3.6273340050976268e-08, -8.3208783788900301e-11, -0.30860102728421074, -0.0060021754227532241,
+        0.00015487542065448676, 1.6710877254406259e-06, -4.3405661086696303e-08, -1.128608840482297e-10,
+        0.074395868474570706, 0.0026400205603015685, -4.7978845627726886e-05, -9.2877971493949666e-07,
+        1.7421594398724711e-08, 1.4608922591412486e-10, -0.01718433748606496, -0.00078987497654506712,
+        1.1806770461928291e-05, 3.235054301780223e-07, -4.9386623808528843e-09, -7.1100827084293476e-11,
+        0.0029423868337448357, 0.00015566780784053894, -2.0259295399476847e-06, -7.0219782754118614e-08,
+        9.2032270523209482e-10, 1.9108092192370871e-11, -0.00026766416882816898, -1.54200923344127e-05,
+        1.8083639795248461e-07, 7.4042891264752059e-09, -8.6397102363061876e-11, -2.4689327519479878e-12,
+        0.52160779816568237, -0.0021863284713265533, -8.187612609955445e-05, 3.7370186514175245e-07,
+        3.4388017051823323e-09, -6.0848727000306817e-11, -0.083579712668084297, -1.081007014880854e-05,
+        2.2186136957233427e-05, -7.9569575818388487e-08, -2.0980800923614278e-09, 3.5214260632236764e-11,
+        0.0077656029924192804, 5.9687077603521536e-05, -3.2561020022962632e-06, 3.3374265194857541e-09,
+        5.1279374802470428e-10, -7.0723036100588052e-12, -0.00091311395333988209, -1.4762971712508602e-05,
+        5.0201827941732609e-07, 1.1351666377394265e-09, -1.0899572084750047e-10, 1.1544800206525798e-12,
+        0.00011997059693792409, 2.8923583482049249e-06, -7.7022070521755542e-08, -4.6475089306439052e-10,
+        2.1383440591175718e-11, -1.475215897181568e-13, -1.6470038671941361e-05, -5.2069012718959585e-07,
+        1.1672116957094905e-08, 1.2175333591238824e-10, -3.9302097480107683e-12, 3.8077057546051929e-15,
+        0.36024897799118311, -0.0033657394260244141, -0.00019032352747864285, 1.6684400363304298e-06,
+        1.9397391676523296e-08, -5.3856005786394266e-10, -0.077954078312181707, 0.00043215288572397576,
+        5.7250373317838803e-05, -5.1230838889936136e-07, -1.0475740262302202e-08, 3.6090711701532177e-10,
+        0.0076269391097537045, 6.7728985405991191e-07, -7.8604278656521263e-06, 7.0690754954676543e-08,
+        2.6212553062592011e-09, -8.5636029714684918e-11, -0.00085496841543179628, -7.1298903435542326e-06,
+        1.2425059329980819e-06, -7.4499267266355511e-09, -6.038025158651068e-10, 1.7374652273959176e-11,
+        0.00011271577156517336, 2.1439129215585857e-06, -2.052091383619161e-07, 4.3780408464400481e-10,
+        1.2547960923369454e-10, -3.2982000717923546e-12, -1.5979955673624747e-05, -4.6661030502155118e-07,
+        3.3126686463652437e-08, 4.3375271143632753e-11, -2.4671599137938205e-11, 5.8355167959277811e-13,
+        0.86473552112012975, 9.9356332791263475e-05, -0.00022797913106596172, 1.3709937008065819e-09,
+        3.1692546448803225e-08, -4.2312290846129069e-10, -0.31931119736359098, -0.0046947446966899998,
+        0.00017078003287172893, 9.8559134595988186e-07, -4.119725927028034e-08, 4.2669551813228132e-10,
+        0.079260211548432949, 0.0022164674421304587, -5.7403883956989013e-05, -6.4059854367876346e-07,
+        1.8100855774846554e-08, -1.448380975167756e-10, -0.018658334834703069, -0.00068130547612588047,
+        1.5185931053913775e-05, 2.3819171069894464e-07, -5.58127150545454e-09, 4.0040245004796165e-11,
+        0.0032350359603406584, 0.0001363590580216986, -2.7722937432869032e-06, -5.3706327198825499e-08,
+        1.1218032751036548e-09, -9.4638151011254559e-12, -0.00029679436125965209, -1.364371182617125e-05,
+        2.6045825927287259e-07, 5.8065118304128365e-09, -1.1265558280103082e-10, 1.4642174948544034e-12,
+        0.51659493166000825, -0.0028225577125919445, -7.7102106049097843e-05, 4.1888871017725387e-07,
+        2.2090222194383761e-09, -6.1023504222023063e-11, -0.083427233932377498, 0.00016234406391211188,
+        2.1053871695896109e-05, -1.0728692567479635e-07, -1.35801779647821e-09, 3.7872427629240292e-11,
+        0.0078591461179487211, 3.3926546684589111e-05, -3.1718071601168838e-06, 1.0316639979497103e-08,
+        3.5523119390818112e-10, -8.4275103226160397e-12, -0.00093860026276376544, -1.0720036566143062e-05,
+        5.0603397195811432e-07, -3.9524873930561835e-10, -8.0851792033202873e-11, 1.6070242414361995e-12,
+        0.0001251253974243102, 2.2594077518525617e-06, -8.0671806415620254e-08, -1.5453397007612635e-10,
+        1.7013005299251667e-11, -2.7419062464447104e-13, -1.7414149245613738e-05, -4.2250610481293547e-07,
+        1.2770437791779114e-08, 6.2766349983973123e-11, -3.3583666162609193e-12, 3.4193347321417028e-14,
+        0.86311612496674373, -0.0017164191144205003, -0.00022519601065812726, 4.4028768686860016e-07,
+        2.2805631768044469e-08, -5.3025253086891601e-10, -0.32730449957073005, -0.0032917844507857749,
+        0.00017892506086320941, 3.9479744761258277e-07, -3.2010231942422831e-08, 6.1417920284971393e-10,
+        0.083212927135351597, 0.0017312257408502126, -6.3436274154454679e-05, -3.7216628195026957e-07,
+        1.5116912160580795e-08, -2.4130807904223083e-10, -0.019891454808990263, -0.00054986610702747617,
+        1.7525130088630636e-05, 1.5324441599862798e-07, -4.9286402443298499e-09, 6.9752250004126001e-11,
+        0.0034837471563936499, 0.00011190309641398892, -3.3112729007526793e-06, -3.6323976036499352e-08,
+        1.0314693107389272e-09, -1.4129707482627612e-11, -0.00032179881816298407, -1.1311541542056594e-05,
+        3.1950691034124225e-07, 4.0459560494514191e-09, -1.0611370027386356e-10, 1.5589964513289243e-12,
+        0.51034928110800581, -0.0034187582598588276, -7.1902857799281331e-05, 4.4472775095334795e-07,
+        1.040764159700945e-09, -5.4863727628482257e-11, -0.08293841480149125, 0.00032531300017613648,
+        1.9660811160053794e-05, -1.2304238624344116e-07, -6.2054881248002217e-10, 3.5049916435214011e-11,
+        0.0079020764951908008, 9.1310230954963248e-06, -3.0195010863446234e-06, 1.4644848802347085e-08,
+        1.8653273062355443e-10, -8.1965172563641054e-12, -0.00095602095991382835, -6.710227532708516e-06,
+        4.9461796914760064e-07, -1.4236941324279689e-09, -4.7453850178665747e-11, 1.6768565302305037e-12,
+        0.00012899594253756156, 1.6108022767198447e-06, -8.1085503419425277e-08, 7.0483495018808491e-11,
+        1.0987052515515204e-11, -3.2097700241685827e-13, -1.8155210372167794e-05, -3.1817137975614739e-07,
+        1.3232737792691486e-08, 1.6801670026679613e-11, -2.3516455997793535e-12, 6.2553127935591654e-14,
+        0.35206150221103255, -0.0048037753681224558, -0.00016879024581389161, 1.8945516182446431e-06,
+        9.0780922360451495e-09, -4.7347734036095054e-10, -0.076652884604001326, 0.00086326774755667599,
+        5.0336488399031227e-05, -6.2205513418472225e-07, -3.3312348172175276e-09, 3.3388453738261835e-10,
+        0.0075685115718186176, -5.8233911240621903e-05, -6.8187427946445155e-06, 9.8485002501405685e-08,
+        8.5739854821159127e-10, -8.4421747110828914e-11, -0.00085966885444435409, 2.3161607420825739e-06,
+        1.1072814501977011e-06, -1.4146605364555953e-08, -2.3052625319170689e-10, 1.8259658430868248e-11,
+        0.00011539907486469517, 5.5194293418501535e-07, -1.9029134796322679e-07, 1.8598411686611223e-09,
+        5.0756154686781959e-11, -3.7672793488621897e-12, -1.6650595788677452e-05, -2.0522673362675205e-07,
+        3.1717949762600352e-08, -2.4237317716450495e-10, -1.0516952448139898e-11, 7.4299125765135146e-13,
+        0.2122578857568205, -0.0053156511019839163, -0.00035840365883597544, 7.3701863274909405e-06,
+        8.5730656992809565e-08, -3.8911792907906227e-09, -0.064382711999921766, 0.001491621451675042,
+        0.00014679684627580785, -2.5128728885187535e-06, -4.6211064460705644e-08, 2.5320641760087924e-09,
+        0.0078922527488581168, -0.00012207927935676757, -2.060916199932757e-05, 3.8582129876164366e-07,
+        5.3225714843971856e-09, -7.5256909547124006e-10, -0.00090483191786140064, 1.1172307557613081e-05,
+        2.539807178982204e-06, -7.465091657818077e-08, -8.6314540656566768e-10, 1.928043517494563e-10,
+        0.00010587429271441882, -1.4596513816109341e-06, -3.7300691347844312e-07, 1.3846722487531497e-08,
+        3.200644052612634e-10, -3.955755712377346e-11, -1.3892400588701933e-05, 1.5635383850652837e-07,
+        6.8742589501290854e-08, -2.0479482746046672e-09, -8.9245886990813306e-11, 7.0202674866184348e-12,
+        0.85790230859427741, -0.0034914375514548505, -0.00021806406084163486, 7.2282694511470605e-07,
+        1.2769932048168239e-08, -5.613187420473825e-10, -0.33244720849523801, -0.0018492266048880253,
+        0.00018098574140345503, -2.1267803375498195e-08, -2.0282235590264397e-08, 7.1983812723431274e-10,
+        0.086156414734562814, 0.0012096292461589106, -6.6604571166538736e-05, -1.6770424846082966e-07,
+        1.0580235455797973e-08, -3.2513129770281526e-10, -0.02084604442427632, -0.00040355228039077684,
+        1.8933159106201629e-05, 8.47041891697627e-08, -3.7065470928112091e-09, 1.0875019704862235e-10,
+        0.0036798690713720893, 8.3932093706428463e-05, -3.6558111161173283e-06, -2.1693059383651407e-08,
+        8.2152377016728158e-10, -2.5003011839779004e-11, -0.00034173138827797239, -8.5885150471707111e-06,
+        3.5856639340992218e-07, 2.5175664150675454e-09, -8.9134969088196852e-11, 2.9939520222198897e-12,
+        0.50295358841328586, -0.0039724310231323149, -6.6500672502079174e-05, 4.5315188321975159e-07,
+        4.8130045807414576e-11, -4.3746187072289698e-11, -0.082135263305848916, 0.00047657577570403006,
+        1.8146767575199414e-05, -1.2771025745129852e-07, 1.3533269747452446e-11, 2.776474029999556e-11,
+        0.007896766909305835, -1.4283321580594924e-05, -2.8310449691088213e-06, 1.6388747629511866e-08,
+        3.6569287441790462e-11, -6.6121667011267943e-12, -0.00096554604612773538, -2.83204899946072e-06,
+        4.7404989855508381e-07, -1.9258290641865622e-09, -1.6173142725000906e-11, 1.3991300984669397e-12,
+        0.00013157333830069882, 9.6801608592093964e-07, -7.9390060814760255e-08, 1.9689885169580614e-10,
+        4.9346849870107071e-12, -2.7790132097975133e-13, -1.8685448203893902e-05, -2.12057627288779e-07,
+        1.3245445282417325e-08, -1.1933583841872813e-11, -1.2514704953514427e-12, 5.9691674325540174e-14,
+        0.84920432828572068, -0.0051985517023738093, -0.00020849179031919501, 8.509406900636507e-07,
+        4.0436718025760945e-09, -6.7848246027848877e-10, -0.33470182724549757, -0.00040689983093390877,
+        0.00017919778975964773, -2.4992888967304561e-07, -9.4127177162939648e-09, 1.0141447072406959e-09,
+        0.088038206691596538, 0.00067118808822739183, -6.7783235433366526e-05, -4.0019728026994844e-08,
+        5.9603312640432651e-09, -5.6953803856301164e-10, -0.021499082840063181, -0.00024888945774974584,
+        1.965196034161337e-05, 3.8444581575420378e-08, -2.312205338502675e-09, 2.403361015048118e-10,
+        0.0038177993427964039, 5.3836905675368683e-05, -3.8499012731856934e-06, -1.1300990513628591e-08,
+        5.4530875589966685e-10, -6.9237502071159586e-11, -0.00035595889754480657, -5.6197983025701853e-06,
+        3.8165929481001827e-07, 1.3926532834802868e-09, -6.1737524177721283e-11, 1.0317136537486851e-11,
+        0.49449390915291186, -0.0044827337651928735, -6.108472201709764e-05, 4.4766319830213065e-07,
+        -6.8862522055617477e-10, -2.9614897443426489e-11, -0.081041762295033612, 0.00061566235075655943,
+        1.6632185191810298e-05, -1.2357621180055778e-07, 4.7053773624656734e-10, 1.7631330410136737e-11,
+        0.0078461755828979178, -3.6144316174445943e-05, -2.6348269571954135e-06, 1.6043080085995436e-08,
+        -7.172406569875573e-11, -4.1092199465215445e-12, -0.00096749272239503097, 8.6548977619489824e-07,
+        4.50235187503392e-07, -1.9849081312649458e-09, 7.1396452163775172e-12, 8.9494242860380894e-13,
+        0.00013288241791356117, 3.4329329895022268e-07, -7.6723406418963084e-08, 2.3573312685769244e-10,
+        2.2250295103215083e-13, -1.7625047709017416e-13, -1.9004244505096528e-05, -1.0693291956135443e-07,
+        1.3014078534200322e-08, -2.4384799754100807e-11, -3.470124021377947e-13, 3.3497822545858655e-14,
+        0.34117692181954923, -0.0060613602332893471, -0.00014547185499429855, 1.9718630321502055e-06,
+        1.1029442342676392e-09, -3.1391211471989422e-10, -0.074547622795702748, 0.001235666568587463,
+        4.2754210384998713e-05, -6.2772257944803373e-07, 2.2234068110818786e-09, 2.1085164042867241e-10,
+        0.00740132188790593, -0.00010794269452468159, -5.6057506301036349e-06, 1.0016700803903631e-07,
+        -5.4157967186198344e-10, -5.1975379631798767e-11, -0.0008467430696000492, 1.0458421101783052e-05,
+        9.2641577137278329e-07, -1.5246389144716421e-08, 6.8220972348420627e-11, 1.0641410710112202e-11,
+        0.00011505751730054157, -8.7264565898654059e-07, -1.6538524642802201e-07, 2.1356166823999064e-09,
+        -1.1013483287923062e-11, -2.1564848381466849e-12, -1.6817829119144389e-05, 3.5089335459796855e-08,
+        2.8257261077017e-08, -3.0298488386850576e-10, 1.9456233377523562e-12, 4.4229475662391163e-13,
+        0.83717206377778997, -0.0068250490944215319, -0.00019810455370739927, 8.6803105252448394e-07,
+        -1.136896557859025e-09, -2.0329956444277446e-11, -0.33409290677014664, 0.0010127878197212822,
+        0.00017557028947642739, -3.3929190541692867e-07, -2.7631751978604354e-09, -3.1962970949773627e-11,
+        0.088837736009695759, 0.00012831691776730539, -6.7817338399094599e-05, 2.7644970893638746e-08,
+        2.945781857802781e-09, 5.6755648447266743e-11, -0.021838560034025289, -9.0354551274852342e-05,
+        1.993325342902569e-05, 1.0485722939348895e-08, -1.3279190422747739e-09, -3.9840410669484903e-11,
+        0.0038943333550327582, 2.2620100137831665e-05, -3.9425867818180953e-06, -4.5504103328285572e-09,
+        3.3069111476877782e-10, 1.5446025609071679e-11, -0.00036410223605472535, -2.5136480613511004e-06,
+        3.9355462098602375e-07, 6.2883094981792192e-10, -3.7567801797352134e-11, -2.787155284894718e-12,
+        0.48505661648553594, -0.0049501507415562179, -5.5795777394670464e-05, 4.3272320621350996e-07,
+        -1.1304215508534405e-09, -1.4588408664068328e-11, -0.079681970447179507, 0.00074293906876453885,
+        1.5204135092659729e-05, -1.1382813934225963e-07, 7.1212479726367102e-10, 6.5255488778273267e-12,
+        0.0077534007092079091, -5.6477624523368555e-05, -2.4514104993801641e-06, 1.4392066998293423e-08,
+        -1.2539613630863486e-10, -1.2411554600708476e-12, -0.00096223315879457054, 4.3751783107131233e-06,
+        4.2758303063967563e-07, -1.7612187770954086e-09, 1.8803414287643378e-11, 2.6753843400152446e-13,
+        0.00013296405920665307, -2.5935689452320698e-07, -7.397402955960584e-08, 2.1631130022245464e-10,
+        -2.2279702722977326e-12, -7.2983224560392937e-14, -1.9114960977068076e-05, -4.0399812868512817e-09,
+        1.2707318433007886e-08, -2.5511117901689219e-11, 1.2640400252170847e-13, 1.8709784302030583e-14,
+        0.82196983587036376, -0.0083686175378326986, -0.00018783170013572886, 8.4379564230558444e-07,
+        -1.1270403300703688e-09, -1.2601496348105799e-10, -0.33067613082906472, 0.0024004023674308785,
+        0.00017126801777991632, -3.7792240760725632e-07, -3.073136923279994e-09, 2.5689300072970265e-10,
+        0.088553425716872872, -0.00041212494065940734, -6.7215049422472678e-05, 7.2831470749199434e-08,
+        3.1468600080678242e-09, -2.0549225798021493e-10, -0.021859655959161624, 6.9258902243906275e-05,
+        1.9933794288079415e-05, -1.0442928225375611e-08, -1.4262523824205314e-09, 1.1133275124406927e-10,
+        0.0039079237496349754, -9.0485971290042802e-06, -3.9653202743093301e-06, 7.8116053474174845e-10,
+        3.6393966798157029e-10, -3.8111200794886415e-11, -0.00036596461113468185, 6.5446138477233008e-07,
+        3.9739052083076152e-07, 6.6042652302313052e-12, -4.3139892133042581e-11, 6.4597535064836713e-12,
+        0.47472616381840144, -0.0053760707974054014, -5.0718708658805199e-05, 4.1308331550306139e-07,
+        -1.2796350467274804e-09, -6.5358112898506738e-13, -0.078078643828503963, 0.00085930821155448945,
+        1.3908974899690921e-05, -1.0197189093818288e-07, 7.3658532459766638e-10, -3.8108879599749393e-12,
+        0.0076213563850037434, -7.5433083848043506e-05, -2.2910653555308023e-06, 1.2340038550555773e-08,
+        -1.2233871273861588e-10, 1.4882131020257933e-12, -0.00095012532550803547, 7.7166034686500362e-06,
+        4.0831942206864415e-07, -1.4516904226755579e-09, 1.7910783492125938e-11, -3.4562613505638801e-13,
+        0.00013186131066349709, -8.4142238434167858e-07, -7.161073025125609e-08, 1.7777242949265665e-10,
+        -2.1696497033533995e-12, 6.862470018573556e-14, -1.9022318673977491e-05, 9.6441358117055306e-08,
+        1.2418194056709719e-08, -2.2656261693456361e-11, 1.4969151720358247e-13, -2.1152641884480977e-14,
+        0.32796529597222895, -0.0071305969565245465, -0.0001218779216324781, 1.9494471977026379e-06,
+        -3.304811726131299e-09, -1.2847921552117977e-10, -0.071757505286495271, 0.0015484407649397562,
+        3.5547130449690021e-05, -5.6677565024272914e-07, 4.8974445872439132e-09, 5.7268425446768051e-11,
+        0.0071442501434816038, -0.00014819211172272984, -4.4826047950904731e-06, 8.5487073479944382e-08,
+        -1.157014247840675e-09, -9.9341800430279103e-12, -0.0008189728024047923, 1.7168997257981136e-05,
+        7.5520535963071846e-07, -1.3017481326414371e-08, 1.7687602017451969e-10, 3.2229282291165718e-13,
+        0.00011206654134987496, -2.098665997537786e-06, -1.418254023707465e-07, 1.7424474914130188e-09,
+        -3.0454891115156674e-11, 2.0277647102761574e-13, -1.6532394136643682e-05, 2.476383725211135e-07,
+        2.5016185828484365e-08, -2.2723400128389591e-10, 5.9261097226880721e-12, -4.4939400552785289e-14,
+        0.1990522988063235, -0.0078112034937135311, -0.00026404545962646338, 8.1991790214090155e-06,
+        2.302447372296606e-08, -2.3273396562467855e-09, -0.060327209133251507, 0.002536193868910022,
+        0.00011364146190483429, -2.9224655559585758e-06, -1.0217775954088454e-08, 9.4068467530610805e-10,
+        0.0074982353601427843, -0.00026799245161805317, -1.5894786480449763e-05, 3.7340970956712102e-07,
+        -5.1572622609507856e-09, -2.2975997853055826e-10, -0.00086499311306640725, 2.7941633493604639e-05,
+        1.6757618629674696e-06, -6.1840679443827243e-08, 2.1074025975086916e-09, 8.4536658697512112e-11,
+        0.00010052100453363387, -3.7487549082476414e-06, -2.0041902499376819e-07, 1.3268871408601461e-08,
+        -3.3215552599374133e-10, -2.1589812248270039e-11, -1.3118115267690206e-05, 5.9367344241910612e-07,
+        3.9850008110043343e-08, -2.485790838740529e-09, 2.2052426262133361e-11, 3.3524584153883733e-12,
+        0.10250115267664141, -0.0058670736559593949, -0.00047410160972437363, 2.6734072933767107e-05,
+        8.503345686041897e-08, -3.082567514182087e-08, -0.0401807517410364, 0.0031001873986339118,
+        0.00025124758365195209, -1.4090854320838286e-05, -2.2973116070123055e-07, 2.0542071459505566e-08,
+        0.0062363497035410513, -0.00046050972232334101, -5.4030192544131636e-05, 2.3183486922874715e-06,
+        8.6693237113644088e-08, -3.7662460398047527e-09, -0.00093206477130846938, 5.3434767538529218e-05,
+        9.8021183909680432e-06, -2.8992990609173375e-07, -1.6131177970956634e-08, 3.869558994577658e-10,
+        0.00013352190120585736, -5.3870902079988121e-06, -1.4459347919772548e-06, 2.8922551625402319e-08,
+        9.6016557646870513e-10, -2.9351223269911653e-11, -1.7981690955204977e-05, 5.056723827833012e-07,
+        1.6753671790622221e-07, -3.2272479984242761e-09, 3.8653369873124525e-10, 1.6994532296491862e-11,
+        0.041782740616636622, -0.00099529772266598046, -0.00082854584891551306, 4.6062310219400421e-05,
+        2.2534773262050428e-06, 6.8879884535134082e-06, -0.022617168795292832, 0.0017742949424015668,
+        0.00045453221126590479, 5.7339478662599011e-06, 5.8553477508528549e-06, -2.3566447947888666e-05,
+        0.0038127122534495172, -0.00044242077741783709, -8.6196169684379746e-05, -5.2082099681503273e-05,
+        1.4531106118505021e-05, 2.143206063662763e-05, -0.00062920427075931131, 1.2997902401159715e-05,
+        5.1546741423221141e-05, 4.4413378329776568e-05, -3.508302422202257e-05, -1.3768333121533605e-05,
+        0.00010271607937858491, 1.6363816868875167e-05, -6.8971295270231009e-05, 1.7675170480249507e-06,
+        4.3338741431100391e-05, -8.7204489012641894e-06, -1.2470776845521402e-05, 3.1632393094019688e-05,
+        3.5932213929749696e-05, -4.1976349140451609e-05, -2.6083984675456587e-05, 2.6643064049479644e-05,
+        0.0099491579825590256, 0.00225307073744203, -0.00018752827146011191, -2.3259165970460041e-05,
+        -1.1038380178863866e-06, -6.7436368297946586e-08, -0.0076535618379688858, -0.0016859170968105807,
+        0.00014977084132874923, 8.5707988564269921e-06, -2.2480174188012142e-06, -1.4706751075635196e-07,
+        0.00018251977991180763, -1.2298192056076639e-05, -2.5190621620033067e-05, -3.8618519560155211e-06,
+        -5.6282338284019765e-07, -3.8346177564571572e-08, -0.00027445627504238336, -7.4710273096662358e-05,
+        1.5516976419870836e-06, -1.0176990541344749e-06, -5.0642118086372034e-07, -4.9379408111622868e-08,
+        -7.7215474519176866e-05, -2.5903756307240582e-05, -2.416258104536468e-06, -1.0728617052968853e-06,
+        -3.1112266609247353e-07, -3.4813402675029571e-08, -4.1910789788335484e-05, -1.3154466124126224e-05,
+        -8.3697945945712348e-07, -6.1031287728798943e-07, -2.0882341810293742e-07, -2.6435037715268022e-08,
+        0.00023601539507863041, 2.1755288834133383e-05, 2.7044256160795047e-06, 1.6123142592931608e-06,
+        -1.1813005209862752e-06, -5.5542520634120326e-07, -0.00044893809328647676, -4.2605760704837713e-05,
+        -4.8249237642740977e-06, -2.9003464263603563e-06, 2.1324343770505418e-06, 1.001400602388769e-06,
+        0.00041684525242606329, 5.0554115988815941e-05, 1.6537307388328831e-06, 1.2188479551926452e-06,
+        -9.6350793580877994e-07, -4.41747981354981e-07, -0.00034524517995869963, -5.2906421650193905e-05,
+        1.4700145906981272e-06, 4.7165415039179952e-07, -2.2315283562203884e-07, -1.2449065462531857e-07,
+        0.00027675944220099887, 5.7866811686886484e-05, -5.1381398883894851e-06, -2.4435294199076179e-06,
+        1.6037675594132483e-06, 7.8370310126335783e-07, -0.00018415668948864461, -5.0751155894074135e-05,
+        6.5405385640140997e-06, 3.2542809423969967e-06, -2.1913253142027422e-06, -1.0607559334608757e-06,
+        0.0004207604723450865, 1.8611648041026767e-05, -1.2837660775695845e-06, -1.2880812058481231e-07,
+        -6.6281924163454148e-09, -1.6119971090993173e-10, -0.00078815289407686167, -3.494232339910439e-05,
+        2.3897342305916534e-06, 2.393054946597447e-07, 1.2289835744830996e-08, 2.9644781188826165e-10,
+        0.0006188987388846272, 2.8222340785254401e-05, -1.7291139931057545e-06, -1.6851184290270536e-07,
+        -8.4239280655461673e-09, -1.8062010351223985e-10, -0.00039946247643988831, -1.9142292742112802e-05,
+        9.417918728030752e-07, 8.5829694718817501e-08, 3.9865555252933097e-09, 5.4802946146065932e-11,
+        0.00016043708804742627, 9.38104717736448e-06, -5.9784807225307935e-08, 7.4337485616875548e-09,
+        1.0452319023785077e-09, 9.0118911003629028e-11, 2.1107805567690279e-05, -1.4823653040224996e-06,
+        -5.1897573597447318e-07, -6.6265938195969959e-08, -4.1051943333732612e-09, -1.6738867782976846e-10,
+        0.00064795201491804849, -1.4842599836994622e-05, -1.9716029059058683e-07, 3.5890450049288526e-06,
+        9.1266751399291061e-07, -1.1178427900719035e-06, -0.0011169243014559308, 5.1070437896525024e-06,
+        1.1109418523207187e-06, -2.5943936719185044e-06, -6.6861524587232987e-07, 8.2013718191205996e-07,
+        0.00065475222560222384, 3.1513852068816452e-05, -1.8237306247307761e-06, -4.3566291078874768e-06,
+        -1.0891258623081788e-06, 1.3314961109774777e-06, -0.00018161423913042119, -4.3799946042980417e-05,
+        1.5355336220868892e-06, 6.9564910208599462e-06, 1.7518866842955333e-06, -2.1436164119827984e-06,
+        -0.00011978787866825591, 7.3073409434307504e-06, 4.1036690458935365e-07, -7.0834055463850318e-07,
+        -1.8434550981515168e-07, 2.2673508715195069e-07, 0.00015789482475418606, 3.0023276239223357e-05,
+        -1.7769614257301774e-06, -5.667656864669927e-06, -1.4214226799825299e-06, 1.7379726952530912e-06,
+        0.00063181798659513188, -5.8256567480694332e-06, -1.6824711723793727e-06, -6.962153648628913e-08,
+        -2.6019989397564414e-09, -1.3951315286275512e-10, -0.0011072269243989263, 8.4018406714955291e-06,
+        2.7846816413131193e-06, 1.1243975134042528e-07, 4.0060485781904925e-09, 2.0620021780406209e-10,
+        0.00068162226859085572, -2.5466352309622437e-07, -1.2727951317736294e-06, -4.3962521259212276e-08,
+        -1.0464134854908107e-09, -3.077385798257836e-11, -0.00022473246378115476, -7.1102686522936118e-06,
+        -2.2606331677108727e-07, -2.2422469313359562e-08, -1.7283722295822001e-09, -1.3019866358272034e-10,
+        -0.00010402511791751514, 9.6560311098286621e-06, 1.0516684704031682e-06, 5.4965692816759366e-08,
+        2.8088238852498115e-09, 1.8103242587473116e-10, 0.00017632018760276659, -5.6701390342060349e-06,
+        -8.202186482373941e-07, -3.7843136328684637e-08, -1.6296660140928241e-09, -9.3723333204802584e-11,
+        0.012805167529615693, 0.00066855301708082385, -0.00013424360863122377, 2.6955177493753787e-05,
+        6.8735338894433776e-06, -9.6631340227653237e-06, -0.0092193099486189874, 0.00032275250890554996,
+        0.00037271859663442699, 2.0421614019141738e-05, -4.0338845734662911e-06, -1.2525885053320313e-05,
+        0.00019215882030225134, 0.00015056437581190262, 0.0001173765574074497, 1.9656224375266769e-05,
+        -7.4712404187274764e-06, -1.034791758330889e-05, -0.00027036645012771474, 0.00014480255121053333,
+        6.9231399968231876e-05, -3.6617404574086119e-07, -1.0380263389444275e-05, -7.6859481277824011e-06,
+        -7.8682477298513867e-05, 5.5559618976671894e-05, 2.2576997711434308e-05, -1.0283619325447985e-05,
+        -9.7962563533228526e-06, -4.2987372526385418e-06, -3.7092741238236307e-05, 3.2061764194300705e-05,
+        6.2974522976523013e-06, -1.0389698988915092e-05, -5.7101466870208881e-06, -9.1949860674381983e-07,
+        0.00092358479799285482, -1.6641802047826315e-05, -1.1499933701433062e-06, -3.7158155088044609e-08,
+        -1.8210174160512526e-09, -1.287605674375178e-10, -0.0013240429529920686, 1.4019287305561143e-05,
+        1.0955921033922218e-06, 2.4458928595926693e-08, 7.0136121280702206e-10, 3.5490625980285014e-11,
+        0.00034058930692249873, 1.479353340801869e-05, 7.3836477055060635e-07, 4.5815585232898493e-08,
+        3.2267235685667373e-09, 2.553027241733652e-10, 0.00020522894716831379, -1.5091211916880965e-05,
+        -8.2819839667721838e-07, -3.2921939254666602e-08, -1.7975368703506564e-09, -1.2802139575562251e-10,
+        -9.5275801140091832e-05, -6.5029168982006377e-06, -4.2045708419557049e-07, -3.0034751655217361e-08,
+        -2.319597364523316e-09, -1.9236472475788941e-10, -9.5827552396949244e-05, 1.1386173183358558e-05,
+        6.6686310891364989e-07, 3.2486270690833829e-08, 2.0719527588120511e-09, 1.5889313471978053e-10,
+        0.00089046625343988954, -9.1927611308181869e-06, 9.1610381034430125e-06, 3.0702027242338755e-06,
+        -1.0202243878997367e-06, -1.2424041451942686e-06, -0.0012970272890166408, 5.7226483448154794e-06,
+        -9.1323098245222846e-06, -2.966608211679621e-06, 1.0086890192417541e-06, 1.2055585560232e-06,
+        0.00037178600206135508, 1.2383942999476506e-05, -5.0878750572236536e-06, -1.8920680603459757e-06,
+        5.8297048438595156e-07, 7.5540675551661931e-07, 0.00017477479146689502, -1.0247839727371575e-05,
+        6.4459368507146155e-06, 2.2050870610495314e-06, -7.2078303592969746e-07, -8.890809098588502e-07,
+        -0.00010963673779468683, -5.7667066431037334e-06, 2.6488002930830084e-06, 1.0380720616639136e-06,
+        -3.0953956390251854e-07, -4.1282830849836441e-07, -7.2268532128303111e-05, 8.2969943042687212e-06,
+        -4.887702669857964e-06, -1.7322437160927316e-06, 5.5281186239607109e-07, 6.9580289698279951e-07,
+        0.00062697247274988508, 2.647367076422056e-05, -5.801988887079069e-07, 8.1752630332239302e-08,
+        -7.643453610778284e-10, 7.6477860611213574e-11, -0.0011039091257982274, -4.4621461635759552e-05,
+        9.5983542102520109e-07, -1.3285748942773119e-07, 1.021336389257868e-09, -1.1089290580842906e-10,
+        0.00069358226936876459, 2.2690917515496615e-05, -4.4250595196711399e-07, 5.4145308285421925e-08,
+        1.5821245503821331e-10, 1.1064014568356105e-11, -0.00024915757167643391, -4.9224249843952712e-07,
+        -7.0903271023158516e-08, 2.2560221291256732e-08, -1.200103561643272e-09, 7.9790070599136978e-11,
+        -7.8575821496754247e-05, -1.2744544896454699e-05, 3.4816573830451975e-07, -6.1328429734924563e-08,
+        1.3997534088386319e-09, -1.0516120282440644e-10, 0.0001636790654865789, 1.1186050593068471e-05,
+        -2.6416002567207833e-07, 4.3486209991769643e-08, -6.2205396261664669e-10, 5.1007994680443417e-11,
+        0.0010000197398413802, 2.0416256028311151e-05, 4.4699058428563732e-08, 1.6480262595045979e-08,
+        -8.7279567798523209e-11, 1.4706229625832085e-12, -0.0014268498048770339, -2.3842862264337303e-05,
+        -4.6228923042111059e-08, -1.7175715907158277e-08, 1.2088824403320702e-11, 1.6175400094067983e-13,
+        0.00035433700028253499, -4.0397822110013279e-06, -2.524225030492643e-08, -7.6509354877245167e-09,
+        1.9962820673331717e-10, -4.0210610841823184e-12, 0.00023020423535698409, 1.0938341831415073e-05,
+        4.8418314662392978e-08, 1.113571862767864e-08, -1.0887325138608263e-10, 1.60666629822906e-12,
+        -9.7690862792442791e-05, 2.2896966375422691e-06, -1.0056198956117062e-08, 3.6716782452419911e-09,
+        -1.3263345924598961e-10, 3.2395246154007251e-12, -0.00011035609466594233, -7.4302017534712675e-06,
+        -2.0669213111814119e-08, -8.008550192489021e-09, 1.2313721652223939e-10, -2.3698494673634962e-12,
+        0.001041820122704089, 2.1542310299401027e-05, 2.3452152846965727e-07, 1.5160287921702816e-08,
+        -8.5214723731040733e-11, -8.8863684493577465e-13, -0.0014755551906773447, -2.5033017231978643e-05,
+        -2.5078517560105633e-07, -1.6870026365981671e-08, 3.0661490847784216e-11, 1.5768671001046033e-12,
+        0.00034580008484506034, -4.5591649957939431e-06, -9.9756721289311996e-08, -4.8684361095702723e-09,
+        1.5821942680684527e-10, -8.3755057194161634e-13, 0.00025287148559472979, 1.1832015492954285e-05,
+        1.7215832062639891e-07, 9.5030694432578135e-09, -1.0199337372021487e-10, -5.3104403621535209e-13,
+        -9.3075317764451022e-05, 2.353227587335168e-06, 2.2870047317176196e-08, 1.9093832755066011e-09,
+        -9.4365494463711922e-11, 1.1023341142966007e-12, -0.00012566422695620036, -7.9489986647351829e-06,
+        -1.059895230011251e-07, -6.2622640050775356e-09, 1.0201380814555996e-10, -1.9701347065220932e-13,
+        0.0010921982932388878, 3.2906473043760528e-05, 6.5326069893854455e-06, 3.080931628830434e-06,
+        4.3905864057331325e-07, -8.2418273251982478e-07, -0.0015272669518176954, -2.604084075307228e-05,
+        8.0390954392864811e-07, 6.1139233488699185e-07, 8.9909979875349622e-08, -1.6859672614704489e-07,
+        0.00032545030666136148, -2.4132816976307086e-05, -1.3100292692390026e-05, -6.4909774643187942e-06,
+        -9.2886201411735808e-07, 1.7434489530974138e-06, 0.00027355618442454735, 5.1431446399053916e-06,
+        -5.645786237682829e-06, -2.9577211894221902e-06, -4.2470506225720714e-07, 7.9681028592253225e-07,
+        -8.003284945158242e-05, 1.7245060661074191e-05, 1.0245461149027943e-05, 5.112557134276661e-06,
+        7.3184473831553608e-07, -1.3735769175197649e-06, -0.00013640435004590761, 2.1842483147008307e-06,
+        7.6750653884157786e-06, 3.9247003180703482e-06, 5.6269182878505155e-07, -1.0557974676053318e-06,
+        0.0011817788169115879, 4.670878118431188e-05, -8.6341351334919374e-07, 3.5750426447792291e-07,
+        -9.4580387036067634e-08, 2.8463265991834917e-08, -0.0015794420502112361, -2.8352491755046926e-05,
+        -9.2457438934812584e-07, 5.6213571137375584e-08, -1.9198711663771734e-08, 5.8253641756626874e-09,
+        0.00023363573893432358, -4.6347422472000351e-05, 2.849772522254726e-06, -7.3201492705388959e-07,
+        1.9989886389993679e-07, -6.0214704203272752e-08, 0.0002669713207162781, -1.9041068548030541e-06,
+        1.7320130274643833e-06, -3.2874423530625088e-07, 9.1167479917126818e-08, -2.7519865723183443e-08,
+        -1.1881227042209527e-05, 3.4088107158847845e-05, -2.3330211571840814e-06, 5.7606626586162955e-07,
+        -1.5744253088581486e-07, 4.7440429330497163e-08, -0.00010792465156749857, 1.332990484360788e-05,
+        -2.0390868899454928e-06, 4.4017791419063082e-07, -1.2087608370539298e-07, 3.6463627105143091e-08,
+        0.0021330144496857742, 3.5712225370780936e-05, 3.7136010183814308e-07, 2.7663042075963147e-08,
+        2.1663588107236812e-08, 1.5756848045461113e-08, -0.0007977445133166924, 1.2346430049660898e-05,
+        1.2534833960017422e-07, 4.7694871410041384e-08, 4.1161765221912332e-08, 2.9922930826564462e-08,
+        -7.4468735817109289e-05, 3.8965611610528575e-06, 3.3793877719338802e-08, 4.7013559204870934e-08,
+        4.0317831819759942e-08, 2.923624497408951e-08, -1.463702021657533e-05, 1.3204181547815796e-06,
+        2.9224085427866568e-08, 4.1460498984959645e-08, 3.5311475667246022e-08, 2.5552170744431506e-08,
+        -3.587354033551306e-06, 4.9112160448161675e-07, 3.3259900246810971e-08, 3.7894328649106375e-08,
+        3.2117657538545351e-08, 2.3126612651759435e-08, -9.6893388108834377e-07, 1.9429665541731778e-07,
+        2.99290236967571e-08, 3.013668933486724e-08, 2.5438530011008556e-08, 1.8198639245343415e-08,
+        -0.55501227522522267, -0.94430203391788115, -0.57225308971110389, -0.23566448520065209,
+        -0.05935693448934766, -0.0069470759558008695, -0.94771561653494363, -1.6083791250281487,
+        -0.97008130150633032, -0.39583520597481092, -0.098103517597420128, -0.011173090585708745,
+        -0.5778530333580113, -0.97706864742598887, -0.57990282691930484, -0.22903257839835806,
+        -0.053466321637357428, -0.0054530187361545041, -0.2397466757140958, -0.40077664340026303,
+        -0.22961151711133837, -0.08400526878881745, -0.016711705552208422, -0.0011472652555299247,
+        -0.060093823191479781, -0.098462677380131897, -0.052304645938290199, -0.015776168436506019,
+        -0.0016961071969492361, 0.00015795052775150622, -0.0067367490908510083, -0.01073718401292033,
+        -0.0047728201427084775, -0.00062235009072433042, 0.0002888576175787104, 7.3862946397349721e-05,
+        0.0023955376254419613, 0.0003696799472749721, 0.00022551820669357699, 0.00011298243776941216,
+        3.6014686257566457e-05, 5.1386529783260415e-06, -0.00043946293696663931, 0.00059818193019261741,
+        0.00039746037288236624, 0.00019897202759875242, 6.308537338078275e-05, 8.879428800593712e-06,
+        0.00015811897586224605, 0.00039796316150747323, 0.00026632465183861202, 0.00013234885276669888,
+        4.1131389940507086e-05, 5.4910923958966033e-06, 9.539370461520902e-05, 0.0001883524644381713,
+        0.00012501100081581959, 6.1023299133863413e-05, 1.79850783449095e-05, 2.0330370177129546e-06,
+        2.8713903484136305e-05, 5.3990260445052904e-05, 3.4831305781375697e-05, 1.6284245340101305e-05,
+        4.0749921148072486e-06, 1.7731953838951768e-07, 3.4945308075989376e-06, 6.5750191327645668e-06,
+        3.871868260718077e-06, 1.6069954514103789e-06, 1.3280477854137009e-07, -1.077132732048959e-07,
+        1.052442783983252, -0.0050195144301148327, 9.3801181849857474e-06, 1.1256932512366249e-07,
+        -5.6472765986488756e-08, 1.3235296288855545e-08, -0.049221176621563327, 0.00075553384045488631,
+        -3.411147094301314e-06, -2.3831111077381391e-07, 1.0651338213554157e-07, -2.4948147554832107e-08,
+        0.0022447386482319855, -6.0561705492097025e-05, 2.2914027039087098e-08, 2.6847279738255687e-07,
+        -1.1329734398657059e-07, 2.652315712264806e-08, -0.00012385701282802822, 4.273209003702484e-06,
+        3.9582728369177081e-07, -2.5505666319472787e-07, 1.0655299938481636e-07, -2.4942051229043674e-08,
+        7.1451203550136599e-06, 2.7942342893763651e-07, -4.7398671677761539e-07, 2.7148355552767238e-07,
+        -1.1323026502670515e-07, 2.6504035625712577e-08, -1.2740128241494784e-07, -5.992694621212174e-07,
+        4.5105738969169644e-07, -2.5567156776040851e-07, 1.0661190581430117e-07, -2.4953395655588475e-08,
+        1.0987432001674862, -0.012112485714945135, 6.7896922962395098e-05, -5.5074815565697078e-07,
+        4.5566016610203506e-09, 3.8039911022483169e-10, -0.11703904255633535, 0.0042794746892269551,
+        -5.6158489109603296e-05, 6.7306640690656239e-07, -6.1295661751288396e-09, -6.8514509693662371e-10,
+        0.012092046348212447, -0.0007706345980248631, 1.5219408567341449e-05, -2.3794179596108101e-07,
+        2.1486782324564103e-09, 4.808959715540328e-10, -0.0014184302599279715, 0.00012470430340587402,
+        -3.1579341244472054e-06, 5.8258683361319474e-08, -3.6348478506284281e-10, -2.4811067055259601e-10,
+        0.00014924155921706587, -1.5925292390628254e-05, 4.7072437000709379e-07, -9.4364736555388582e-09,
+        -1.4813628116185529e-11, 8.5096262988922853e-11, -9.7782101418222632e-06, 1.1692995777990437e-06,
+        -3.7997852534206726e-08, 7.615241782267882e-10, 1.5137090029477327e-11, -1.5249544279914098e-11,
+        1.223368004718387, -0.036170414671954088, 0.00061664689091673003, -1.2483238931867624e-05,
+        2.5723145048922273e-07, -2.6085558811835079e-09, -0.29991473245342437, 0.024880255867675314,
+        -0.00070136539461232222, 1.673579357234967e-05, -3.6487871320558618e-07, 3.5427912701056963e-09,
+        0.04870689548624655, -0.0057803769796562566, 0.00020284982466702115, -5.5062207218020826e-06,
+        1.2998401026250267e-07, -1.0425111536470744e-09, -0.004626127559740051, 0.00064972367279407127,
+        -2.5770041722285304e-05, 7.6374820537102388e-07, -1.931397148329602e-08, 8.2819622040532657e-11,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1555302545225539, -0.03177413226190838, 0.00048833685851929637, -9.1013477867089809e-06,
+        1.7557655627026406e-07, -2.7073782993687178e-09, -0.25519174672527523, 0.019984610823991215,
+        -0.00053088530338086344, 1.1966460025252256e-05, -2.4648581756927411e-07, 3.8543134505799661e-09,
+        0.038581805534910474, -0.0043907830328627426, 0.00014748330855349478, -3.8282487217544879e-06,
+        8.6035029393945457e-08, -1.3598784695600558e-09, -0.0035070649827677772, 0.00047565631112675638,
+        -1.8176495304601133e-05, 5.1818816580976987e-07, -1.2517774696611346e-08, 1.9398674273523244e-10,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.1094250663425116, -0.030745147894256454, 0.00051725094532434736, -1.1256596468594187e-05,
+        2.496065424793356e-07, -7.5247256561241382e-09, -0.24169621524736637, 0.020311248773722354,
+        -0.00060953619195743447, 1.6047408774909539e-05, -3.7769516266589948e-07, 1.1982470431834033e-08,
+        0.04291198687583711, -0.005536841606473406, 0.00021609238114837846, -6.616285042424191e-06,
+        1.6853343042043445e-07, -6.059464391657971e-09, -0.0065133840685732683, 0.001038848553728846,
+        -4.7082614109054639e-05, 1.5991811579370685e-06, -4.3202183003701866e-08, 1.8605070994417175e-09,
+        0.00055413945068448738, -9.936492324485541e-05, 4.9328723592704255e-06, -1.7979071006029149e-07,
+        5.0162281164431569e-09, -2.7814868082928339e-10, 0, 0,
+        0, 0, 0, 0,
+        1.4175725330219195, -0.13037691454370706, 0.0068619087258490153, -0.00036462047077698181,
+        1.7469420582867332e-05, -5.7758889786630458e-07, -0.70903815712151042, 0.14004086839690388,
+        -0.0094240067078608433, 0.00053325875640157191, -2.6048821852414532e-05, 8.6508830514197566e-07,
+        0.17459599929649994, -0.04411719913553791, 0.0033834638993786512, -0.00020487436114546072,
+        1.0349706964349496e-05, -3.4650953766988195e-07, -0.021894049945037429, 0.0062601732443054846,
+        -0.00052206087036238608, 3.3378548095488826e-05, -1.7407411208903737e-06, 5.8623078381210242e-08,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.2846282297079263, -0.11829846037477652, 0.0066541383023926834, -0.00038101605751742038,
+        2.0329883561740684e-05, -1.0594218052138993e-06, -0.62743045866608782, 0.13285699041294236,
+        -0.0097118286437262273, 0.00059326407755591983, -3.2342844059403131e-05, 1.7049584964643722e-06,
+        0.18446961449783203, -0.051426357389473862, 0.0043243017954863513, -0.00028380969095395268,
+        1.6094169882190365e-05, -8.7202759503523129e-07, -0.038570145677825636, 0.012345569628546901,
+        -0.001136797090769733, 7.9175822038413224e-05, -4.6727284724577528e-06, 2.6188100427783396e-07,
+        0.0040441127580378407, -0.0014060368702944203, 0.000137805357354562, -1.0053835675524594e-05,
+        6.1454274107585629e-07, -3.5664815076471199e-08, 0, 0,
+        0, 0, 0, 0,
+        0.84662253497272899, -0.0039614808345687898, 7.5125741219587916e-06, -1.6964596383013221e-08,
+        1.9665169509215194e-12, 2.9088426597975475e-11, -0.026330691951866925, 0.00037095174172168657,
+        -1.752355837548174e-06, 7.198996096268714e-09, 4.7855477607840545e-12, -2.1437737058397812e-11,
+        0.00075742002680752524, -1.8611229141033996e-05, 1.3863421983589814e-07, -8.9052016189838006e-10,
+        5.8540149937222932e-11, -3.5231102838810404e-11, -2.6124530910147123e-05, 9.203864618259482e-07,
+        -9.4822212414369324e-09, 1.8008701665613838e-10, -8.8292596804041772e-11, 5.6887276850321967e-11,
+        9.7882157674802154e-07, -4.5064536939815975e-08, 5.9440667929218539e-10, -1.7107863237318522e-11,
+        9.2739953782115344e-12, -5.8776821082311689e-12, -3.8448563721547086e-08, 2.0834759225178993e-09,
+        6.733171310727787e-11, -8.6695812877037329e-11, 7.0897371074946812e-11, -4.6195623657425573e-11,
+        0.79918392410623706, -0.0033403985321584675, 4.8459462306803138e-06, -7.1521723129009086e-09,
+        1.2264602184413365e-11, -4.4728923394506749e-13, -0.02130687347220411, 0.00025660578525912956,
+        -9.7452381681862086e-07, 3.0530970456564812e-09, -8.9817118066376417e-12, -2.4217821453504325e-13,
+        0.0005177250083644101, -1.079105867098613e-05, 6.5560399998552574e-08, -3.0715296026136449e-10,
+        1.3793514360746422e-12, -9.2418588149993811e-14, -1.506581871660759e-05, 4.4833692910255185e-07,
+        -3.7463713432150189e-09, 2.3102596486717763e-11, 3.5459877212179177e-14, -8.4902331492434303e-14,
+        4.7537550626217582e-07, -1.8445203217518424e-08, 1.9628032774523225e-10, -1.3337527289922992e-12,
+        3.2258341725653162e-14, 6.7824383430828566e-14, -1.57342421213659e-08, 7.5353521905764852e-10,
+        -9.7790116816360529e-12, 5.4622465208232202e-14, 1.096908133832153e-13, 2.251044384400834e-14,
+        0.79254162525396865, -0.0033019708404661173, 4.761322480578575e-06, -6.9543584755229927e-09,
+        1.2200953815682626e-11, -6.0156299807337006e-13, -0.020801343741875065, 0.00024895378251481765,
+        -9.3871763954997229e-07, 2.9155072395857485e-09, -8.4687975237577805e-12, -2.0592733778893513e-13,
+        0.00049665593804701597, -1.0280985136908777e-05, 6.1991656711770917e-08, -2.8785403910403234e-10,
+        8.728691659378205e-13, -2.7106328310370604e-14, -1.4198254980734709e-05, 4.1945053818435165e-07,
+        -3.4785005629027678e-09, 2.1607954915661284e-11, -2.8891494639635702e-13, -7.5281085270533116e-14,
+        4.3999999263011908e-07, -1.6944991522287733e-08, 1.7906980523021705e-10, -1.3536955195685168e-12,
+        2.1187227688862932e-13, 4.6169765310032728e-14, -1.4301176149937198e-08, 6.7984339831205498e-10,
+        -8.4789765620135866e-12, -2.2682577818245467e-14, 3.5180286098510409e-13, 2.439802936198685e-13,
+        0.78597551220284478, -0.0032642107959238481, 4.6790204291038292e-06, -6.7649357894230614e-09,
+        1.1970240324253784e-11, -4.7887703835355889e-13, -0.02031083669697006, 0.00024158176350351116,
+        -9.0451470913279176e-07, 2.7856987461394182e-09, -8.0246772482291716e-12, -2.9451591670707882e-13,
+        0.00047657917600982567, -9.7985661884328858e-06, 5.8644042629990058e-08, -2.7022401558831626e-10,
+        7.4978912770928275e-13, 1.5072314381032409e-13, -1.3386385444367845e-05, 3.9262516913113678e-07,
+        -3.2310938864963611e-09, 1.9928525748802145e-11, -7.7449968999856415e-14, 1.0570255475048378e-13,
+        4.0749168434560583e-07, -1.5576715839519626e-08, 1.6346062191086e-10, -1.3146754342592162e-12,
+        2.386790444075062e-13, -1.5814204489100209e-13, -1.3008236035579775e-08, 6.1391873423624122e-10,
+        -7.4769425609938189e-12, -2.6771229375423529e-14, 3.3410349048765718e-13, -2.2176199342432547e-13,
+        0.77948426792274927, -0.0032271002161289217, 4.5989426301746539e-06, -6.5837044814707851e-09,
+        1.144004754637074e-11, -4.0402823324745709e-13, -0.019834804922464297, 0.00023447724808016001,
+        -8.7182933741840534e-07, 2.6625871822450177e-09, -7.3461349904290445e-12, -3.4071850965103552e-13,
+        0.00045744113123510514, -9.3420967720683992e-06, 5.5502450128263024e-08, -2.5365558024111611e-10,
+        1.194796491682364e-12, -1.2220090237204596e-13, -1.2626251388891602e-05, 3.6769858855171417e-07,
+        -3.0028364587249059e-09, 1.8045621562865569e-11, 2.4344856657654005e-13, -8.1993469075848988e-14,
+        3.7759863089156576e-07, -1.4328110337675191e-08, 1.4899159040663206e-10, -9.7270237072271917e-13,
+        2.0028848104167441e-13, -3.1659138637891583e-13, -1.1840629106207957e-08, 5.5446044492902851e-10,
+        -6.7390031715964592e-12, 1.2025871072725332e-13, 4.5938409059612584e-14, -1.5215112483012276e-13,
+        0.77306661098321783, -0.0031906216788776375, 4.5209964600861685e-06, -6.4099121823400886e-09,
+        1.0669500828071031e-11, -9.1817427745269347e-13, -0.019372725288777547, 0.00022762842583155956,
+        -8.4057998352158814e-07, 2.5465491926157481e-09, -6.7727722753333293e-12, 2.1671966305101676e-13,
+        0.00043919150408302214, -8.909988858197309e-06, 5.2551716451046568e-08, -2.3835403727013029e-10,
+        8.5573177229179658e-13, -1.9723541834187819e-13, -1.1914204236498625e-05, 3.4452300840957788e-07,
+        -2.7932943064015471e-09, 1.6138788234733498e-11, -2.176901477438549e-13, -6.4927220067443753e-13,
+        3.5009305281178456e-07, -1.3188406937948447e-08, 1.3660553841642503e-10, -1.133479554344368e-12,
+        4.2352525314578125e-13, -2.1099768414856621e-13, -1.0785441195314462e-08, 5.0125918953340478e-10,
+        -6.3531341766909034e-12, -2.9047154971417393e-14, 1.8027536160841687e-13, 1.4626629031998777e-14,
+        0.76672129407587042, -0.0031547584799547527, 4.445094906893812e-06, -6.2427286817539553e-09,
+        9.9889647749747098e-12, -7.0989664127240304e-13, -0.018924097659658148, 0.00022102410975628401,
+        -8.106917071358659e-07, 2.4357291543516801e-09, -6.752256610207684e-12, -3.7250198125127471e-13,
+        0.00042178306032976436, -8.5007654894528954e-06, 4.9779336290442211e-08, -2.2420299496657323e-10,
+        9.6120000888764672e-13, -9.2026472787741219e-14, -1.1246877778095884e-05, 3.2296468691924762e-07,
+        -2.5991187855875492e-09, 1.5717983309969295e-11, 1.7317951857211015e-13, 4.7304698720349257e-13,
+        3.2476794999085458e-07, -1.214636992769929e-08, 1.2421282110770408e-10, -9.6610064658909153e-13,
+        -4.2363238987742765e-13, -1.3751051481762508e-13, -9.8312025047762853e-09, 4.5351462251058696e-10,
+        -6.2203997485159131e-12, 7.5688670874719217e-14, -5.761112140800893e-13, -1.615044724781247e-13,
+        0.76044710261729243, -0.0031194945952949275, 4.3711561152704787e-06, -6.0826557199829242e-09,
+        9.7704940145930668e-12, -7.2545280886786004e-13, -0.018488443677301878, 0.0002146537035610323,
+        -7.8209258770188104e-07, 2.3310532060976838e-09, -5.9202709926250042e-12, -2.6823241182579054e-13,
+        0.00040517141816734441, -8.1130483773214191e-06, 4.717325780445063e-08, -2.1043036411162326e-10,
+        1.028538093143476e-12, 1.5970091374858825e-13, -1.0621165130683743e-05, 3.0289740562933108e-07,
+        -2.4197155256268691e-09, 1.4621631763466107e-11, -5.9430871312440409e-14, 2.8575710067747367e-13,
+        3.0143716080620432e-07, -1.1193796395535518e-08, 1.1407320851504742e-10, -9.703110596838696e-13,
+        2.6415934428336896e-13, -9.2075000441712454e-14, -8.9669607704242392e-09, 4.1087227885219319e-10,
+        -4.993663288259531e-12, 8.6530955868671399e-14, 7.6701818494959344e-14, 8.5907774130021361e-14,
+        0.75424285342683284, -0.0030848146414746923, 4.2991014098121424e-06, -5.9284959157019993e-09,
+        9.4569206780462582e-12, -2.1981642473124816e-13, -0.018065305626478092, 0.00020850715976550692,
+        -7.5471649567675451e-07, 2.2319231492610126e-09, -5.6361445723078818e-12, -2.4336599930237954e-14,
+        0.00038931485583230317, -7.7455568294079777e-06, 4.4721980216498573e-08, -1.9846775060881643e-10,
+        1.0746696875904253e-12, -4.3772988901025527e-13, -1.0034197207692319e-05, 2.8420839303993614e-07,
+        -2.2538832864044573e-09, 1.299975844218566e-11, 2.4601415912934408e-13, -1.9871114706274397e-13,
+        2.7992940245720138e-07, -1.0322049268002378e-08, 1.0416658900947745e-10, -1.1918311158870219e-12,
+        -3.1763037527406777e-14, -3.3865813604058882e-13, -8.1840397982705557e-09, 3.7229834230851493e-10,
+        -4.2481012364560661e-12, 2.4890963197114503e-14, 3.8978999355601362e-13, -5.959648775465615e-14,
+        1.4500452801566293, -0.28999367314559493, 0.02748303840135145, -0.0023392183885431409,
+        0.00016442951882700315, -6.0089718198854246e-06, -0.99756571491805313, 0.34464845789138321,
+        -0.038477157909709014, 0.0034249870415887819, -0.00024423946672268122, 8.8727359489852731e-06,
+        0.27340638784345772, -0.11338531525730497, 0.013960327649989014, -0.0013099215779214647,
+        9.5766136563496599e-05, -3.404725429323858e-06, -0.035532606161881565, 0.016245582565093383,
+        -0.0021416938809095468, 0.00021027883143804457, -1.5738878652301976e-05, 5.3690385964594978e-07,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        1.0256724198484442, -0.14816950957556574, 0.010704296228161882, -0.00075482959493693819,
+        4.9311320094001424e-05, -3.0006147845597549e-06, -0.52250552545711471, 0.15041754520139697,
+        -0.014126054967803659, 0.0010779973063314971, -7.2469036245967165e-05, 4.4666575187782236e-06,
+        0.12285982443805471, -0.044688338582831319, 0.0047911171975776974, -0.00039472586131586381,
+        2.7762020173932189e-05, -1.7589497316199626e-06, -0.014536254671928288, 0.0059391760802328403,
+        -0.0006927935171800383, 6.0619044637842891e-05, -4.4493201758261332e-06, 2.9054638976670796e-07,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.85029376662930378, -0.11756735709966656, 0.0090167363817709109, -0.00069123743640982639,
+        4.0233762274750726e-05, 1.6456237751356034e-08, -0.39711134349134558, 0.12157648909040115,
+        -0.01267063275997328, 0.0010558872862352696, -6.2707162659377701e-05, -1.6179001054725177e-07,
+        0.11030316732100111, -0.044812161801775524, 0.0054316697115495737, -0.00048898735173907382,
+        2.9643162476810002e-05, 2.6939564175030399e-07, -0.022246907754864792, 0.010379015162434335,
+        -0.0013820305973127791, 0.00013172551440483867, -8.0251491922641491e-06, -1.5944759697005109e-07,
+        0.0022739869136904805, -0.0011507317526911289, 0.00016305611610039285, -1.6169932050100955e-05,
+        9.728721382871109e-07, 3.3907248583411988e-08, 0, 0,
+        0, 0, 0, 0,
+        1.0003435057135719, -0.31869780281262899, 0.045711879313566746, -0.0061143152926147549,
+        0.00083082626023650878, -0.00014022727366929964, -0.71006286081809267, 0.37089203265631565,
+        -0.063311961803632688, 0.0089167155197887489, -0.0012383847490391731, 0.00021169174660369086,
+        0.1941838548156779, -0.12099376649162218, 0.022766294611496887, -0.0033992236948420847,
+        0.00049162788454322351, -8.6464625787655193e-05, -0.025285590525475632, 0.017240297544655565,
+        -0.0034694825815059882, 0.0005452143410684089, -8.2357272737179112e-05, 1.500725810606763e-05,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.65283829706278762, -0.17253815347879534, 0.022363163201697702, -0.0025734855549006215,
+        0.00016595727732477938, 1.5568472220442458e-05, -0.37792168117203284, 0.19059542918887301,
+        -0.031985200451914018, 0.003926598619877179, -0.00025206135989704639, -2.6793101776371882e-05,
+        0.11506652010215553, -0.073907675067256332, 0.014006482325112856, -0.001811088487918829,
+        0.00011086492415901407, 1.6115912377202632e-05, -0.02469259813056477, 0.017754598334505337,
+        -0.0036199122431145262, 0.00048292468614581863, -2.6437261385533743e-05, -5.8684216582731537e-06,
+        0.0026315017202632228, -0.002018566003179715, 0.00043120873802874043, -5.8263734447213408e-05,
+        2.6115769579708796e-06, 9.6097481443062573e-07, 0, 0,
+        0, 0, 0, 0,
+        1.5062281126398596, -1.5930726793201979, 0.51797844383782565, -0.08080274174083904,
+        -0.018696583611230371, 0.015262418068582402, -1.8066088129893618, 2.1525404667864825,
+        -0.73521537098679146, 0.11205592533580697, 0.030932951601693182, -0.023745978760179753,
+        0.61445333766159815, -0.76983187820998245, 0.26696379608810639, -0.03586298525673224,
+        -0.01559433814652029, 0.010495931577589794, -0.090439541788979477, 0.11590688147395742,
+        -0.039602745247815541, 0.0039380112414041865, 0.0034311474183574774, -0.0020237314916847614,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.21259541794267758, -0.1301094672347527, 0.0086012638346166567, 0.011232514902017805,
+        -0.004981315656648385, 0.00029622268279590164, -0.15350996238720868, 0.1215912766410935,
+        0.0025086141404938715, -0.02157959602735646, 0.0087755436459130403, -0.00050426500026355464,
+        0.044484872810048488, -0.0301935681087694, -0.013637579084826051, 0.015759597141555216,
+        -0.0057752150087808521, 0.00030167520607235807, -0.0069736930513212307, -0.00044307575228677933,
+        0.010279750971541345, -0.0078200365910096135, 0.002637080114652334, -0.00010999381183625034,
+        -0.00018206993394684925, 0.0026507739544293927, -0.0037086650902991578, 0.0023493359113140131,
+        -0.00074146547237785294, 1.8064687117158122e-05, 0.00019934337634671889, -0.0005694227541436273,
+        0.00056655489783843254, -0.00032512461053745489, 9.6902309022988163e-05, 0,
+        0.088989860239002821, -0.080749818612936272, 0.01795474776723938, 0.0035029191550180402,
+        -0.0040227296957778035, 0.00069421608706886058, -0.069221770469903784, 0.082031595256474479,
+        -0.015412391639034326, -0.01002649420997577, 0.0077810805633712621, -0.0012806459086142905,
+        0.022956247493150683, -0.025261689608064766, -0.0021077024842479728, 0.010279056526287958,
+        -0.0058373322321291212, 0.00085455215782984778, -0.0045486375531068914, 0.0025568494704995451,
+        0.0054318753612891922, -0.0061520394405717377, 0.0029378708293086447, -0.00034522676079234629,
+        0.00026418620021642647, 0.00097869551086929014, -0.0024832148079305554, 0.0020519852985819462,
+        -0.00088360355855058106, 6.6580244307976589e-05, 4.2733866531005762e-05, -0.00028367488438609168,
+        0.00042781460187892077, -0.00030171021107741012, 0.00012372375333036481, -2.0548632856415912e-06,
+        0.048891836060950121, -0.049270994012756267, 0.028023521781772594, -0.011593052250405307,
+        0.0029870326024042325, -0.00036117134462535216, -0.04520572687873569, 0.075097066674470705,
+        -0.045349037229416495, 0.018875865129913381, -0.0048721995538675775, 0.00058944544569400261,
+        0.02332128377508547, -0.03954803809416492, 0.02401449407791258, -0.010021325733201662,
+        0.002588003428946255, -0.00031280828763739446, -0.0073429886565640522, 0.012470797162116104,
+        -0.0075872822580700123, 0.0031678962231647522, -0.00081734931489738625, 9.8600761256899719e-05,
+        0.0010565128996133236, -0.0017947077749634805, 0.0010920365269706128, -0.00045568270657352777,
+        0.00011739925121678277, -1.4128747427441283e-05, -3.1638103860163452e-07, 2.4970584191357001e-07,
+        0, 0, 0, 0,
+        0.012814737966618779, -0.0005175656410929849, -0.00023512972090498078, 0.00010704418425794928,
+        -2.8516024928815461e-05, 3.5836589822149708e-06, 0.00015881577549331849, -0.00064359095558103735,
+        0.00040858970984435756, -0.00017501363445726956, 4.665822232584192e-05, -5.8606851758334717e-06,
+        -0.00020469082313250518, 0.00035024916382753906, -0.0002172047209286554, 9.3225536268337384e-05,
+        -2.4815095531435534e-05, 3.1111072977814839e-06, 6.4433626931592616e-05, -0.00011038786990766606,
+        6.8733839495154999e-05, -2.9497447176266027e-05, 7.8388349062516531e-06, -9.8116498244322169e-07,
+        -9.1499082644317079e-06, 1.5755093832497511e-05, -9.8592294685986093e-06, 4.2440286749439792e-06,
+        -1.1264466441266834e-06, 1.4074435542956847e-07, -3.3396294172465058e-08, 4.4412980122408863e-08,
+        -1.183568102326852e-08, 0, 0, 0,
+        0.01502115509932064, -0.0041660011796140943, 0.00034850230522612746, -4.3576808506603895e-05,
+        1.1369910283351428e-05, -2.3318243672773803e-06, -0.0011851567897795891, 0.00050612081043465416,
+        -8.9246690780608217e-05, 4.5408565295245418e-05, -1.8489938896636052e-05, 2.3908200772222512e-06,
+        3.5863969578756277e-05, -2.6272026443467562e-05, 3.3805669179765093e-05, -2.3153315051160649e-05,
+        3.8845043955089666e-06, 6.1658676141738141e-07, -3.2582046358434957e-06, 1.0572893701770528e-05,
+        -1.3073901741246806e-05, 3.6489722790261268e-06, -1.2709746689141759e-07, 5.0949622910118627e-07,
+        1.3245875025132769e-06, -4.1173182856649332e-06, 2.5310893769514181e-06, -9.7037953111482551e-07,
+        8.6609185004074719e-07, -1.6068218687635264e-07, -4.1919067489830967e-07, 9.3637097032791344e-07,
+        -5.3934658944430614e-07, 4.9630072726385776e-07, -1.291021023740725e-07, -8.080119596114237e-08,
+        0.016563661581735105, -0.0083709800074370424, 0.0012896956001488226, -0.00022397181519524906,
+        5.3503442648080007e-05, -1.351281642051844e-05, -0.0029620092600724027, 0.0024193809280892314,
+        -0.00071528329460681555, 0.00020992243991682771, -6.9882323233345708e-05, 2.0923967729544393e-05,
+        0.00034384095588891131, -0.00042863596763138151, 0.00019327132906990082, -8.243535428541194e-05,
+        3.7063281132518958e-05, -1.1614973778258657e-05, -5.8684636302557657e-05, 8.9459381077283782e-05,
+        -5.762969542582405e-05, 3.5002970082188049e-05, -1.6201441762791912e-05, 2.3490408992465883e-06,
+        9.0020069541676812e-06, -2.2125509926808951e-05, 1.9147461303728979e-05, -1.1915164772194556e-05,
+        2.9682746374252133e-06, 2.9406178968838788e-06, -4.1047392852532967e-06, 8.3019292976142301e-06,
+        -3.7929904084984843e-06, 4.6597302782681136e-07, 1.6356203223422863e-06, -1.7641183358796364e-06,
+        -0.025060898883159936, 0.043177032058056258, -0.025647121735790299, 0.01024575504357072,
+        -0.0024828909130451566, 0.00027659688975293685, 0.04246187557225467, -0.071654377520678006,
+        0.042486940089193473, -0.016926376219469168, 0.0040841614523780484, -0.00045206350918267681,
+        -0.023875023523099753, 0.040222842623208764, -0.023727122374579544, 0.0093646535598757383,
+        -0.0022262344810982039, 0.00024088408364582276, 0.0085777033450579673, -0.014400866813800711,
+        0.0084020019893208363, -0.003249117232074771, 0.00074676630823569234, -7.648759668814536e-05,
+        -0.0017156720030665157, 0.0028592895765061966, -0.0016290048598449898, 0.00060137318747370203,
+        -0.00012705716494924252, 1.1071263880374094e-05, 0.00013120376842794867, -0.00021443935032597049,
+        0.00011427064431929513, -3.6288724929229956e-05, 5.2547939819814877e-06, -1.13147387176291e-09,
+        0.0005892694859243496, -7.7677035754055243e-05, -1.5914553455814051e-06, -1.0415110204124772e-07,
+        -9.6152800070169685e-09, -9.2058728325099373e-10, 1.1639049064349864e-06, 2.8155116173539952e-08,
+        7.4284689721272116e-08, -2.5095076391268015e-08, 6.4964455208888016e-09, -6.9640271826183236e-10,
+        -5.8924158729194494e-08, 8.8524073834915829e-08, -5.3899718616984942e-08, 2.2303808343542062e-08,
+        -5.7230115539836395e-09, 6.9127445704128294e-10, 2.5936913478848575e-08, -4.39772035662618e-08,
+        2.6515280517096266e-08, -1.0870316504986434e-08, 2.7322954265541685e-09, -3.1937660136631961e-10,
+        -6.5976783265244924e-09, 1.1086378306236709e-08, -6.4771238849033414e-09, 2.4938842827636445e-09,
+        -5.586203822493262e-10, 5.2162228473052518e-11, 5.9446008308575755e-10, -9.7153444508373374e-10,
+        5.1533728893470027e-10, -1.5868689399600511e-10, 1.9083807000361401e-11, 1.3370263129030045e-12,
+        -0.0028016034023993562, 0.006316476681034822, -0.0042851871094827911, 0.0016340970696200755,
+        -0.00036540795839300655, 2.5473863563641933e-05, 0.0093021777091870459, -0.015748648765713739,
+        0.0094406616937768965, -0.0038103180923861075, 0.00092807668784084809, -0.00010189377394156132,
+        -0.0079215812678003344, 0.013464255485114911, -0.008164316727942475, 0.0033760518923853285,
+        -0.00085957410908324753, 0.00010219371847791379, 0.0041995882901543916, -0.0071312077673386289,
+        0.004306397842138503, -0.0017671858474427049, 0.00044361159041332034, -5.1551954329588175e-05,
+        -0.0011367367354977224, 0.0019132556001586231, -0.0011225825235333439, 0.00043482869886511785,
+        -9.8021690569797447e-05, 9.2126292125515542e-06, 0.00010833005583910806, -0.00017764292988197824,
+        9.5185822114451159e-05, -2.9826388376413578e-05, 3.7264519454260714e-06, 2.3093922040683941e-07,
+        6.9208945986662612e-05, -0.00012789518906031015, 0.0001008795306741072, -6.6110983369039615e-05,
+        3.4373889919042474e-05, -1.1405915292517846e-05, -9.1705390263081773e-06, 1.382774682790456e-05,
+        -3.2799430046439689e-06, -6.0574596281789074e-06, 8.7991893539531748e-06, -4.3828780379136655e-06,
+        2.1469020164695188e-05, -3.9984857141091701e-05, 3.225000320754897e-05, -2.2215041936455586e-05,
+        1.2327500508402839e-05, -3.8984982489253823e-06, 6.1094359351524308e-05, -0.00011285179483640772,
+        8.7669118847104755e-05, -5.5477637836017013e-05, 2.549089894688413e-05, -5.2721534262022896e-06,
+        -9.9644567908146802e-05, 0.00018523493825249371, -0.00014964664913866385, 0.00010174348985566629,
+        -5.6612800689901012e-05, 2.1791814715630854e-05, 4.2335135717128027e-05, -7.8580055491519918e-05,
+        6.4058049234045405e-05, -4.4194582437995664e-05, 2.6299776376646122e-05, -1.2389318036931583e-05,
+        0.0025314018499465333, 0.0042364554253619914, 0.0033332614422479333, 0.0017161365556494737,
+        0.00079665463967884271, 0.0001694391891165707, 0.0043418552217418084, 0.0078071766910886688,
+        0.0056573831133418413, 0.0031788477575491838, 0.0012923805457842367, 0.00030694406763964309,
+        0.0030420526034038581, 0.0054675876377594844, 0.0039202149945223507, 0.0021695294717457439,
+        0.0008518939465479064, 0.00018470598073640107, 0.0016557041150604503, 0.0029642963711144069,
+        0.0021030709186530255, 0.0011386595405813778, 0.00042936670880453268, 8.6471243312463716e-05,
+        0.00063523204560092051, 0.0011308884122249901, 0.00078731902051087585, 0.00041023112037943943,
+        0.00014299943893465161, 2.3843485004283177e-05, 0.00012751832746374822, 0.00022416621343612206,
+        0.00014887619548146802, 6.9517856255526381e-05, 1.7516170861018388e-05, -6.8257503253916484e-07,
+        0.055320734407649945, -0.091443783156638356, 0.05567239455723192, -0.024689801835867862,
+        0.0072239569429863046, -0.0010376536662996135, -0.083915136998642781, 0.14516428832381653,
+        -0.091756105146990424, 0.041688151534573163, -0.012009141135386604, 0.0018185897597838444,
+        0.05064621469642925, -0.086920716841810436, 0.055376052955721337, -0.024451119383202675,
+        0.0070288978197812274, -0.00092436675728017664, -0.02054782663366405, 0.035475515490479115,
+        -0.021864062739054495, 0.0094623524008487867, -0.0024394279684370784, 0.0002930484415538033,
+        0.0049817458409693793, -0.0083588309952737742, 0.0050469574937214842, -0.0019557190866068661,
+        0.00044122604520687125, -3.2960026646670604e-05, -0.00051519804617568407, 0.00087068242969712132,
+        -0.00047021881290827341, 0.00015787358727992608, -2.1492835637156785e-05, 1.336319720501979e-06,
+        0.048256308770722095, 0.069282612335122756, 0.0458641527214236, 0.018260853011622596,
+        0.0047311098723935088, 0.00054212420052961077, 0.074797272889494351, 0.12996271761656106,
+        0.077555315402816946, 0.032466778840850009, 0.0083303306465194425, 0.0010557968334635557,
+        0.045221804439376179, 0.076315604610245738, 0.045924192845977464, 0.018658768481592342,
+        0.004701716942343395, 0.00053840750131818171, 0.01971102353184101, 0.03341204888616179,
+        0.020049224944003911, 0.008273626009307403, 0.0021381570851104013, 0.00027654804504866277,
+        0.0052931352027067741, 0.0089213250701118303, 0.0053289135974282694, 0.0021708882097139079,
+        0.00055282147549933478, 6.249224134022501e-05, 0.00065860594463737422, 0.0011065437465782929,
+        0.00064864481727651901, 0.00026272870842195212, 6.2461907315266305e-05, 8.0100466565855262e-06,
+        -0.10505973450236021, -0.17783929383977767, -0.10515883434172073, -0.041107023969614812,
+        -0.0088243469252162043, -0.00060424658077892464, -0.22513109639501794, -0.38388215958391514,
+        -0.23470807411323566, -0.098044888393734153, -0.02505640162288866, -0.002942017174563466,
+        -0.1799173993256519, -0.30811878746017018, -0.19095503901416394, -0.081860689302739112,
+        -0.021859375719356863, -0.0027470030577465324, -0.10105508750059627, -0.17359184437204289,
+        -0.10861797088549557, -0.047403337698139196, -0.01303806987644739, -0.0017168430998151562,
+        -0.032889512189384518, -0.056511065204072501, -0.035385587136964353, -0.015462954348994947,
+        -0.0042613259029304152, -0.00056269593419330083, -0.0044019973412470683, -0.0075302122774823224,
+        -0.0046487115695594229, -0.0019769660612167753, -0.00051962296766336618, -6.3082925842140438e-05,
+        0.7883178171859353, -0.026102121625088227, -0.00099293584840126148, 1.301380433301082e-05,
+        2.6962923811847985e-07, 3.0161182204056622e-08, -0.31776720258094382, 0.011288758605121131,
+        0.00094298318343028192, -8.6193480098226568e-06, -5.2204956879078314e-07, -4.0250547250764275e-08,
+        0.085282792223835391, -0.0031697178556288627, -0.00037546319014891157, 3.1585473280797097e-06,
+        2.9039446178334764e-07, 1.7589290371766433e-08, -0.021068961767763125, 0.00081420305794244034,
+        0.00011181302713554284, -9.7647199900701921e-07, -1.0497069702806227e-07, -5.4082347287568429e-09,
+        0.0037666470838301192, -0.00015071054102148011, -2.2263237928987679e-05, 2.0607935421392655e-07,
+        2.3684122534487036e-08, 1.087660976111117e-09, -0.00035266117318796429, 1.4502056231409399e-05,
+        2.2312009378866853e-06, -2.1716494921164622e-08, -2.581145258348277e-09, -1.0896307583833533e-10,
+        0.4550392806629337, -0.014514692808855778, -0.00024877531279754363, 5.3775447812156837e-06,
+        -3.3217426144673686e-08, 1.3202097271834262e-09, -0.074776825289312593, 0.0025000335221951899,
+        7.0101056713551632e-05, -1.2159250276701413e-06, 1.2697418032437724e-08, -1.2756980273202898e-09,
+        0.0073021635489410892, -0.00025368130690529237, -1.2053331757336049e-05, 1.4633360206507958e-07,
+        -3.7176373586334914e-10, 3.6966008715596464e-10, -0.0009126163215582401, 3.163116008928243e-05,
+        2.2277855218268973e-06, -1.8036127665933522e-08, -2.5964963106810455e-10, -8.4210310172949298e-11,
+        0.00012701410346596754, -4.334719190173594e-06, -3.9789427093552042e-07, 2.558262462550989e-09,
+        9.975318541147805e-11, 1.6920808189087403e-11, -1.834923091560002e-05, 6.3419123959261663e-07,
+        6.9534728502998207e-08, -4.3038677854484442e-10, -2.7747254989603099e-11, -3.1957535214391434e-12,
+        0.7287465537807748, -0.033301982446292032, -0.00079132331413776368, 2.1906027952917274e-05,
+        7.7892595072046862e-07, 1.103258982876373e-08, -0.28811304757473066, 0.018217308818343467,
+        0.00076399802000922301, -2.2861104583507982e-05, -1.1566072739751034e-06, -9.3839386644584431e-09,
+        0.076132280325832094, -0.0059174216357730132, -0.00029889959374956556, 1.0266757965853413e-05,
+        5.4427289671136427e-07, 1.2358349917976293e-09, -0.018608373531621352, 0.0016256649573236845,
+        8.6802795806895547e-05, -3.379319926505187e-06, -1.759744384068383e-07, 4.7632045086737022e-10,
+        0.0033004954177828496, -0.00031098407613800881, -1.6887733583711693e-05, 7.2450331347389721e-07,
+        3.6706767119622685e-08, -2.4731380719882912e-10, -0.00030722644438032232, 3.0459813263336768e-05,
+        1.6612529132799987e-06, -7.6496190950934402e-08, -3.7811574271441897e-09, 3.7450763160015794e-11,
+        0.42421918249134655, -0.016253491469516674, -0.00018641503959444973, 5.0982366162845374e-06,
+        -8.5451445725994995e-10, 1.5876989643013861e-09, -0.069261096386535312, 0.0030038356436410192,
+        5.5815331402007575e-05, -1.2350387226298483e-06, -1.4788969255242724e-08, -1.1890100836059129e-09,
+        0.0067042538563287539, -0.00034259279457476261, -1.0075797227332587e-05, 2.0245363520345471e-07,
+        7.1544556052274013e-09, 2.9903062702189344e-10, -0.00083235509658889412, 4.8383376159341788e-05,
+        1.9284630675437649e-06, -3.6116901407632664e-08, -1.9287883579685309e-09, -6.2289961510024181e-11,
+        0.00011529544564605286, -7.3413140588174582e-06, -3.4610102891153851e-07, 6.9064939280709095e-09,
+        4.245293752168686e-10, 1.1017329711927958e-11, -1.6549528761816904e-05, 1.1573017783734858e-06,
+        5.9566994142819408e-08, -1.381781676094951e-09, -8.6366964998822696e-11, -1.7179490231784011e-12,
+        0.30068533068803871, -0.020540706991212375, -0.00048517572853963364, 2.5969238217219312e-05,
+        -1.1997829437164134e-07, 5.9623729772114633e-09, -0.065605239989994901, 0.0047233088433676768,
+        0.00014810814382868717, -6.2367676483771792e-06, 1.1613711136730738e-07, -8.835100072957717e-09,
+        0.0065316661482820006, -0.00047866086410683047, -1.7819711709254607e-05, 8.2300227861636068e-07,
+        -2.2321901730557706e-08, 2.2574461208157212e-09, -0.00074214709764000965, 6.2140491713945194e-05,
+        3.0819313317849966e-06, -1.4365799879355501e-07, -5.6244491652692503e-11, -6.1410667381730692e-10,
+        0.00010131463809209968, -9.1820175130305387e-06, -6.4807720563274525e-07, 2.1354705808879814e-08,
+        7.0393211951112975e-10, 1.6471560242224394e-10, -1.503261172195624e-05, 1.3538377407346302e-06,
+        1.2385625536546292e-07, -2.7736469505550139e-09, -1.7772748854351506e-10, -3.6244491268901745e-11,
+        0.65679397896031488, -0.03837003475674839, -0.00045520279453282959, 3.340157153320147e-05,
+        4.96862194638177e-07, -3.7710274968008422e-08, -0.24665041503061316, 0.022928890111798658,
+        0.00038533015105516965, -3.8883950821385114e-05, -6.1651701201401366e-07, 6.0014962658262728e-08,
+        0.062394238453697043, -0.0076784079261861251, -0.00012887539930675371, 1.7252398088374697e-05,
+        2.2139569048121998e-07, -3.1200363642752471e-08, -0.014821705058008838, 0.0021149310872564252,
+        3.1759004435108773e-05, -5.4792817502524932e-06, -5.1703236780724315e-08, 1.0968706239799932e-08,
+        0.0025771899920456541, -0.0004026005273833581, -5.2800685081600335e-06, 1.135767075247782e-06,
+        7.4429215431490692e-09, -2.4347760254788786e-09, -0.00023655260754704203, 3.9200899725223826e-05,
+        4.5193655075957175e-07, -1.1671458366858116e-07, -4.99709600935898e-10, 2.6270656100441326e-10,
+        0.39041582314074902, -0.017498261292499623, -0.00012444736822295934, 5.2812977199772715e-06,
+        1.9507333879854042e-08, 2.9798216815768058e-10, -0.062857611864075666, 0.0033856505139026934,
+        3.8995501638082597e-05, -1.5965072493289537e-06, -2.5891045128949227e-08, 1.8543208972105229e-10,
+        0.0059477438720229427, -0.00041121577610554825, -6.8304948558535015e-06, 3.4309002530032572e-07,
+        8.9670357410536421e-09, -1.4592588676316784e-10, -0.00072194435276182753, 6.1492407160081272e-05,
+        1.2861030631841884e-06, -7.1466434324761484e-08, -2.1277655142740046e-09, 4.8055549977140337e-11,
+        9.8194084243359307e-05, -9.6542371747713652e-06, -2.1915629045120304e-07, 1.4214073695677431e-08,
+        4.0817323545138402e-10, -1.3531981109295472e-11, -1.3828139635053508e-05, 1.5430999930107963e-06,
+        3.4412425761919653e-08, -2.7711364478736434e-09, -7.0406676039583603e-11, 3.4134673265999835e-12,
+        0.61457297308525483, -0.0097164843256500009, -1.3149209828286606e-05, 4.7362897590669978e-07,
+        5.2219050249515907e-11, -1.5193338309229149e-10, -0.061246994433381531, 0.0017724438368502248,
+        8.1308512154970429e-07, -1.9488288685465272e-07, 5.5086726187326462e-10, 2.0360692785425858e-10,
+        0.0044588151745618065, -0.00018977801186688357, 2.9250473420447553e-07, 2.7673799628861879e-08,
+        -1.8591635126978279e-10, -8.6143435911432019e-11, -0.00025513850885809777, 1.3198273325076156e-05,
+        -4.352733299650094e-08, -2.1405478440245955e-09, 2.2803028614181028e-11, 1.7510450402620629e-11,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0.7931569048620748, -0.019534945674633271, 4.9502026533074506e-05, 2.859994245066935e-05,
+        -2.0197418919128367e-05, 1.374573528349537e-05, -0.15605763701149739, 0.0097779713825871962,
+        -6.9425146589033575e-05, -4.9937536292940232e-05, 3.6393404028857566e-05, -2.4777015730418335e-05,
+        0.027553740750323182, -0.0029107122592513953, 4.1784188163428996e-05, 2.1165888733965759e-05,
+        -1.5966186308869319e-05, 1.0879206431692875e-05, -0.0058552969110067703, 0.00088946784061453849,
+        -4.4298250030977525e-05, 7.4096013646707083e-06, -4.6767011735790651e-06, 3.1732910142879831e-06,
+        0.0013770714191546503, -0.0003172250371383541, 7.9508239024305745e-05, -4.0874222286285436e-05,
+        2.8708056610381784e-05, -1.9534916339373436e-05, -0.00035388168178798155, 0.00014842967146242413,
+        -9.4418346052571638e-05, 5.4834569752926435e-05, -3.8781159517008462e-05, 2.6394996042848201e-05,
+        0.59575479785717356, -0.0098528277496125125, -6.8592117915481798e-06, 4.4449140730951701e-07,
+        1.9110247179163846e-08, -9.6296051318744229e-09, -0.05886670100321062, 0.001859279711103688,
+        -2.4257750125521576e-06, -2.0352355761474917e-07, 1.0444611208287071e-08, -7.2036618085586542e-09,
+        0.0047353247349217718, -0.00023696907860689482, 1.1260286329138312e-06, 6.5410006880821088e-08,
+        -2.0199367197313293e-08, 6.4413013081955943e-09, -0.00046420797111260684, 3.1785958512800233e-05,
+        -4.2695637648331291e-07, 9.3831976032130906e-08, -5.9702674373250849e-08, 2.5749670489039127e-08,
+        4.9071326599709549e-05, -4.2381066252727632e-06, 4.4030976681536518e-08, 1.5106883958169735e-08,
+        -1.5712576881033512e-08, 1.3750518911480818e-08, -5.2397492745583936e-06, 2.4964804482600378e-07,
+        2.5347167735604125e-07, -1.8519816936603506e-07, 1.0222566174459455e-07, -3.1966876753289175e-08,
+        0.48288194021477321, -0.013365151512187461, -3.2954345739636109e-05, 1.5685742682880051e-06,
+        3.619994214798734e-09, -2.6240866413922006e-10, -0.060330255076326146, 0.0025573433818316797,
+        7.6832388778916875e-06, -7.0470007486498428e-07, -1.2154498233460912e-09, 2.3069461751814328e-10,
+        0.005442134293703855, -0.00034281348013810161, -5.04151416783817e-07, 1.4838720638557461e-07,
+        -3.0724233798969427e-10, -6.1061904788118282e-11, -0.00061585610118206611, 5.077982003601296e-05,
+        -8.5163071843213251e-08, -2.7473370949093048e-08, 2.1150004063752318e-10, 1.2776571791678639e-11,
+        7.5480372783575997e-05, -7.6828470991747279e-06, 4.4914933074644505e-08, 4.7116814099750988e-09,
+        -6.8966596303472399e-11, -2.3147974096175416e-12, -9.598990309848247e-06, 1.1668503856365369e-06,
+        -1.2176076558352797e-08, -7.5760879995609456e-10, 1.7317640127798868e-11, 3.6692000769176694e-13,
+        0.82831110559786403, -0.011356015114929443, 3.6686497315120075e-05, -2.0297618946563016e-08,
+        -4.1985251373583681e-10, 1.2089057541043542e-12, -0.095561794184061979, 0.0035643382772020124,
+        -3.564575252232271e-05, 2.3547918111470727e-07, -1.0485747932091674e-09, 2.6198984096982687e-12,
+        0.010063231579974831, -0.00064342696911701852, 1.0862867292641861e-05, -1.2600853260859121e-07,
+        1.1017570139281153e-09, -7.5057070873178626e-12, -0.001273367846411675, 0.00011584006074322622,
+        -2.7579361712506116e-06, 4.5194282407281153e-08, -5.6612000651444386e-10, 5.6969864562032115e-12,
+        0.0001754133655565113, -2.0790585337438993e-05, 6.4070045858204285e-07, -1.3564718029423108e-08,
+        2.2021712497225011e-10, -2.8620488183709681e-12, -2.5306474499132865e-05, 3.6968684497602023e-06,
+        -1.3967924272830341e-07, 3.6141613478680957e-09, -7.1728530342546282e-11, 1.1094008780148593e-12,
+        0.68867742555098621, -0.0070439748146077152, 4.3346108589694523e-06, 1.041993656582668e-07,
+        -4.4099379112164422e-10, -1.0866977852408786e-12, -0.049664500027934641, 0.0011591993563176038,
+        -4.2803722832578589e-06, -2.0789117542154207e-08, 2.8040946561420467e-10, -6.9013580981046831e-13,
+        0.0030965616394405841, -0.00011957821951351557, 8.8452967490331366e-07, -3.3383571457625129e-10,
+        -4.6590810768871352e-11, 2.0627907836450873e-13, -0.0002324886668723491, 1.2532651974606382e-05,
+        -1.4125581938606061e-07, 5.6795715574550698e-10, 4.7623559331472948e-12, -8.6720696973455123e-14,
+        1.8867909319824805e-05, -1.3113163874508694e-06, 1.9955483614732541e-08, -1.4357825192258348e-10,
+        -1.2926170856251817e-13, -1.4305171044858348e-14, -1.6012186045285083e-06, 1.3646236137537478e-07,
+        -2.6174443368349918e-09, 2.6633629660379655e-11, -5.3407265960650763e-14, -1.580348569094731e-15,
+        0.80589171679414473, -0.011063609546781268, 3.6403521418521963e-05, -2.6796341362581506e-08,
+        -3.9227714533526511e-10, 9.9510627549611819e-13, -0.088709534157955308, 0.0032901940076088573,
+        -3.2918941309436294e-05, 2.1912207486463405e-07, -9.9576289979066228e-10, 3.4461513658876106e-12,
+        0.0088586964479904547, -0.00056228388799473158, 9.4517269432282318e-06, -1.0953439207088345e-07,
+        9.6052174069371523e-10, -7.2754316540874726e-12, -0.0010621370255016564, 9.5800237121668178e-05,
+        -2.2663656425649952e-06, 3.6992599356540917e-08, -4.6215373589967756e-10, 5.1467823424841087e-12,
+        0.00013848187069185643, -1.6260348779148361e-05, 4.9727491449488042e-07, -1.0466933154829201e-08,
+        1.6873032403371188e-10, -2.4537518218095227e-12, -1.8905510136616224e-05, 2.7350583740644514e-06,
+        -1.0248588054038255e-07, 2.6338018448905971e-09, -5.1362881008113466e-11, 8.1080463774546412e-13,
+        0.67462802681778555, -0.0070044176625846284, 5.5420875315332983e-06, 9.7006720467920832e-08,
+        -4.5699345260301094e-10, -6.0361118097339044e-13, -0.047381081171383718, 0.0011240336622735715,
+        -4.503407519626445e-06, -1.6421889729924115e-08, 2.6503927515169047e-10, -8.4533979319818106e-13,
+        0.0028644601428437317, -0.00011253016804202922, 8.7627370051546039e-07, -1.0249065364533922e-09,
+        -3.9806404844932304e-11, 3.0880742827360312e-13, -0.00020853099182175177, 1.1431042676694114e-05,
+        -1.3403502685159566e-07, 6.3174107531119875e-10, 3.2233899965830603e-12, -2.5446502545268278e-14,
+        1.63994552066461e-05, -1.158575926860773e-06, 1.8230063828025891e-08, -1.4344226280083555e-10,
+        1.4963774775431568e-13, 5.1646839878855856e-14, -1.3482409519857516e-06, 1.1677358711561159e-07,
+        -2.3075645264322145e-09, 2.4991365268708503e-11, -1.408039834565766e-13, 2.7079958100322566e-14,
+        0.57601188543177828, -0.009885434404830272, -1.2943114468245155e-06, 4.5748094057334301e-07,
+        -1.427163461108367e-09, -2.95355580523851e-11, -0.055174725803818166, 0.0018308598965922956,
+        -4.6327158949012244e-06, -1.717514038647615e-07, 1.4952870623696763e-09, 1.2070563113089591e-11,
+        0.0042717672008404104, -0.00022629353256451771, 1.496040170162517e-06, 2.3274602994904912e-08,
+        -4.2547611371819754e-10, -3.9466533377004169e-13, -0.00040333317080169741, 2.9134376878986477e-05,
+        -3.2763515523516635e-07, -2.1544057173463688e-09, 8.8643665276529199e-11, -4.3239189690598744e-13,
+        4.1054572463348837e-05, -3.7706222146998706e-06, 6.0846042533119448e-08, 3.5265977177410527e-11,
+        -1.5235735984576805e-11, 1.4650943204984874e-13, -4.3542578295634736e-06, 4.8627927566875792e-07,
+        -1.0260442254517594e-08, 4.3648190236913498e-11, 2.2542519083876973e-12, 1.4460817430476439e-14,
+        0.71799176303252865, -0.018013689705098833, 9.7961183501835844e-05, 3.3444781810487225e-09,
+        -4.4000403171162596e-09, 1.0737892672452727e-11, -0.12127154341904768, 0.0076352519561262927,
+        -0.00012312134446265601, 1.1803533524280396e-06, -5.6086653529436215e-09, -1.0302824670402033e-11,
+        0.017997061367489683, -0.00190929306055796, 5.1729391242863613e-05, -9.1833783054585447e-07,
+        1.1453948399866532e-08, -9.9479520214855107e-11, -0.0032065794563276039, 0.00047843364548372464,
+        -1.8257581888084461e-05, 4.6555623020862626e-07, -8.7310755379791407e-09, 1.2525264292497773e-10,
+        0.00062130677450002853, -0.00012007914346554093, 5.9390601863361414e-06, -1.9774697302881499e-07,
+        4.9265105439846602e-09, -9.6856901523292579e-11, -0.0001255238759561763, 2.974898712964831e-05,
+        -1.8026759462657605e-06, 7.3644925678610188e-08, -2.2623260320546834e-09, 5.5325382459151629e-11,
+        0.55624774396533161, -0.0098742610345753847, 4.0398904597299479e-06, 4.3021103795271565e-07,
+        -1.9634780877729393e-09, -2.3903024037720402e-11, -0.051556296367112037, 0.0017859771593356855,
+        -6.5432172765387391e-06, -1.4620250154860759e-07, 1.6805186843363172e-09, 6.4718983533082961e-12,
+        0.0038319511658564823, -0.00021332378875881896, 1.7345107334030555e-06, 1.6488902401312929e-08,
+        -4.1826783316949797e-10, 1.0134485837903352e-12, -0.00034775083900979396, 2.6433243285622573e-05,
+        -3.453106200041811e-07, -8.1948584231959126e-10, 7.7467512604934957e-11, -6.9657429641570755e-13,
+        3.3998690174380668e-05, -3.2860339784239889e-06, 5.9924247245438765e-08, -1.7999484147410964e-10,
+        -1.1621094630499213e-11, 2.395526232524639e-13, -3.4617369694411106e-06, 4.06834981973282e-07,
+        -9.549852264385577e-09, 7.268421489066828e-11, 1.4057821052332665e-12, -7.9495766353277189e-14,
+        0.45594802970318177, -0.013552925685122896, -1.3965214128300245e-05, 1.5821744033467811e-06,
+        -2.000554025325329e-09, -2.8750528741545792e-10, -0.05518088139449509, 0.0025850064872992729,
+        -7.3645472617099567e-07, -6.8703028903685686e-07, 3.3867742457946444e-09, 2.1930859175604914e-10,
+        0.0047579943551875666, -0.00033989775988623632, 1.2081245907804597e-06, 1.3418003157934786e-07,
+        -1.4273677893530352e-09, -4.8357736248421848e-11, -0.00051596922485189385, 4.8855333179614099e-05,
+        -3.8682447357280523e-07, -2.2275051707876805e-08, 4.2201258019071651e-10, 7.7846117224467585e-12,
+        6.0637781373503554e-05, -7.1191669812942787e-06, 9.354519630731048e-08, 3.3120285932765723e-09,
+        -1.0140617138526969e-10, -8.8822335538459494e-13, -7.3878766682470716e-06, 1.0382148419640069e-06,
+        -1.9426799785107313e-08, -4.4127676240559073e-10, 2.1165867440862223e-11, 4.6728308420867436e-14,
+        0.35462810562343899, -0.018235133000786132, -5.9277457292727795e-05, 5.5571078481274084e-06,
+        1.0406345650220383e-08, -1.1002410449313497e-09, -0.055839473939879217, 0.0036147371218446947,
+        1.7729013529235857e-05, -1.9040159354623985e-06, -8.6163721165919051e-09, 1.3877557335876266e-09,
+        0.0050851819731011277, -0.00044733129035242497, -2.0263478214334701e-06, 4.3989516486869353e-07,
+        1.9860732389207964e-09, -4.9665206248932376e-10, -0.00059172391999014889, 6.7881333193881824e-05,
+        2.7373482694642145e-07, -9.2512628666689855e-08, -2.572880193949495e-10, 1.2307325097085208e-10,
+        7.7732736262405312e-05, -1.064196659670446e-05, -2.1853447472628484e-08, 1.7541949605108161e-08,
+        -3.5309198930305363e-11, -2.6663565870643329e-11, -1.0581215781326849e-05, 1.6727225619984321e-06,
+        -2.7173769859446213e-09, -3.1687716748992826e-09, 2.7130710888519942e-11, 5.3538716499078811e-12,
+        0.25669302241982711, -0.023198058217915537, -0.00018069955357696626, 2.5063400725871137e-05,
+        -1.3624684506766763e-08, 1.2924685262031795e-10, -0.055197867602434052, 0.0056261378361615339,
+        7.8259767439419872e-05, -5.8404008913723353e-06, -5.2775654797126518e-08, -5.0945937040541055e-09,
+        0.0054608032690506465, -0.00058474149204352718, -8.8141220265241195e-06, 7.4613695814346024e-07,
+        3.871761271511433e-09, -2.3205694631841003e-10, -0.00059914502516317779, 7.9195792620828011e-05,
+        1.0765046624592796e-06, -1.9879800104851729e-07, -3.0264356642732132e-09, 4.8854870612075327e-10,
+        7.8837391679688673e-05, -1.2964978396945769e-05, -2.5001672079837733e-07, 4.7215803809482432e-08,
+        1.5021105100720287e-09, -1.3500018655492279e-10, -1.1501653450441806e-05, 2.1215262362700437e-06,
+        5.6701052229585021e-08, -8.9804464864261432e-09, -3.8215717341879838e-10, 2.672534827873259e-11,
+        0.16714351956151807, -0.024515650344881162, -0.00056016218022286138, 0.00011280778852029742,
+        -1.0504771407935172e-06, -1.2311118992329542e-07, -0.049265774473695109, 0.0087596422462220113,
+        0.0003012505773207391, -4.4229572920826957e-05, -3.9021749120316203e-07, -1.7934812602557485e-08,
+        0.0062222439814803437, -0.0010520977788083525, -5.5540407442000569e-05, 4.1383172478346225e-06,
+        9.0101468053599501e-08, 3.7098749170308232e-08, -0.00073270777222787971, 0.0001091407262839331,
+        6.2725301935775666e-06, -1.035334648389478e-07, 2.7337417993329641e-08, -1.0098641712433239e-08,
+        8.4426871665441671e-05, -1.2559217602042828e-05, -3.7611328521352467e-07, 1.0778660157749109e-08,
+        -1.3493684263950465e-08, 1.045493134578164e-09, -1.0522006747976264e-05, 1.9967656761142178e-06,
+        1.4008457748478514e-08, -1.5496556258015256e-08, 2.2963800909638971e-09, 8.1964464001539796e-11,
+        0.60309997687069161, -0.027743826009790216, 0.00026211585890140952, 3.936269897816179e-08,
+        -3.7778343486745481e-08, 1.2729747036992749e-10, -0.14239410615093506, 0.014868873732684706,
+        -0.00038558912202430238, 5.3112735461688753e-06, -1.5148634632023101e-08, -6.2617043937061752e-10,
+        0.028026280317360083, -0.0048469407186197038, 0.00020768216808767444, -5.5231957149863701e-06,
+        9.3332876600489932e-08, -8.5889363606509335e-10, -0.0066639922277232748, 0.0015951879559346789,
+        -9.5540592047517237e-05, 3.6980665281748106e-06, -1.0010750187136165e-07, 1.9088159195398808e-09,
+        0.0017250905937300921, -0.00052984564639209342, 4.1083052173751491e-05, -2.0977217789578205e-06,
+        7.7782234157825283e-08, -2.1827380309992858e-09, -0.00046298310178839535, 0.00017285497048736715,
+        -1.6369046371620931e-05, 1.0279298015461126e-06, -4.7486341263877059e-08, 1.6955175307509401e-09,
+        0.42878991257972165, -0.013589675276539152, 4.6437484757794515e-06, 1.5057485921073859e-06,
+        -7.4113630501099622e-09, -2.4395983215048153e-10, -0.050042008489923739, 0.0025473739125585013,
+        -8.5201101400699479e-06, -6.0068295099849568e-07, 7.200189820736566e-09, 1.5559792149765199e-10,
+        0.0040926450027913355, -0.00032424616559712622, 2.6532155022492013e-06, 1.0481895152916382e-07,
+        -2.1653836537156893e-09, -2.44730041022566e-11, -0.00042211221252588566, 4.48158781038233e-05,
+        -6.0961164733011559e-07, -1.4629515041778719e-08, 5.1266799976901129e-10, 1.2894427366311616e-12,
+        4.7253653936727125e-05, -6.240209493070316e-06, 1.232412244130323e-07, 1.6306294440587465e-09,
+        -1.0418585648457254e-10, 5.3978165908891324e-13, -5.4796127960408298e-06, 8.6730093381839004e-07,
+        -2.2729143525358461e-08, -1.1518088541860898e-10, 1.8771184364894121e-11, -2.1907665339460322e-13,
+        0.54970369025548915, -0.025654983385204506, 0.00025909893717540833, -5.2866230699389933e-07,
+        -3.2425444423651473e-08, 3.770062860660994e-10, -0.1155427665214916, 0.012034050468307694,
+        -0.0003237100529031711, 4.9727587087714715e-06, -2.6748223943492828e-08, -5.0048354500006533e-10,
+        0.019801044862891092, -0.0034264987855382486, 0.00014980514112204182, -4.1648660386383676e-06,
+        7.6570438484577786e-08, -8.2155443898456823e-10, -0.0041148472482860458, 0.00098384476504726967,
+        -5.9612545226746704e-05, 2.3716814857613748e-06, -6.7376300461887434e-08, 1.3841718849121691e-09,
+        0.00092732638015679094, -0.00028367012369243685, 2.2116283330116302e-05, -1.1479996021260365e-06,
+        4.3819337584149273e-08, -1.2831724083589004e-09, -0.00021680904653405956, 8.0545876156946686e-05,
+        -7.6501864995553956e-06, 4.8614425527830698e-07, -2.2953140146944158e-08, 8.4674439681466485e-10,
+        0.401703280444414, -0.013482608324670714, 2.1854203513033301e-05, 1.3525285794734461e-06,
+        -1.1455617973268271e-08, -1.5575953616058999e-10, -0.045036727840458951, 0.0024525454896351085,
+        -1.4949281994170294e-05, -4.6521604996930172e-07, 9.4495620802375894e-09, 6.7949549892527196e-11,
+        0.0034689269670039407, -0.00029860622298115885, 3.6915442488775597e-06, 6.7651778113366855e-08,
+        -2.4000816647926611e-09, 4.145382557369624e-13, -0.00033781484891510783, 3.9376108727368638e-05,
+        -7.3612378846270851e-07, -6.5334402870979886e-09, 4.8230382294980272e-10, -3.993186146609413e-12,
+        3.5801916780318719e-05, -5.2031314526104994e-06, 1.3335711121465461e-07, 1.0789574914311892e-10,
+        -8.3360800199591903e-11, 1.4187752101980959e-12, -3.927898574522988e-06, 6.8461591101955427e-07,
+        -2.2497967005838314e-08, 1.3815004290403067e-10, 1.2585332559388602e-11, -3.4736127499696484e-13,
+        0.31789552325564213, -0.01844170851129984, 7.5577877577470376e-06, 5.5123183550316836e-06,
+        -1.714775933105913e-08, -1.4588458624518156e-09, -0.048540706479092185, 0.0036650620847978113,
+        -4.9758871941101321e-06, -1.8061964646451342e-06, 2.0542892264041322e-08, 1.3002844508203478e-09,
+        0.004190895255004802, -0.0004426614810636941, 3.107153467636729e-06, 3.9073332181965232e-07,
+        -7.8651399827228055e-09, -4.1677028791210669e-10, -0.00045721373303747663, 6.5746168711410934e-05,
+        -7.8106531426010814e-07, -7.7550583218780537e-08, 2.0071453183400068e-09, 8.6778263597467356e-11,
+        5.6908418455431721e-05, -1.0022720408005292e-05, 1.6884683064799915e-07, 1.3130139307209493e-08,
+        -4.7373920794410561e-10, -1.3841744787118922e-11, -7.3678618385298014e-06, 1.5135743086569583e-06,
+        -3.5034796455494744e-08, -2.021508044732615e-09, 1.0443600719395695e-10, 1.7854848572350941e-12,
+        0.42581884006810106, -0.037292307181350806, 0.00067905920755199879, -4.5750565267890998e-06,
+        -1.7839788457487227e-07, 7.752601773732134e-09, -0.11908486582470543, 0.020227529776853912,
+        -0.00090144893398180564, 2.3339153675833785e-05, -1.3766170108151552e-07, -1.0821317436037586e-08,
+        0.024524512816406243, -0.006863095814583658, 0.00048769578509213877, -2.1361264890045002e-05,
+        5.7183482059376138e-07, -6.419550724682438e-09, -0.0062763564973528736, 0.0023957081933592144,
+        -0.00023050228892062451, 1.4267415665649122e-05, -6.0815710322072142e-07, 1.7224615001637507e-08,
+        0.0017580054043939215, -0.0008441257901981126, 0.00010341468200996987, -8.3382076628923841e-06,
+        4.8407984199193285e-07, -2.0754044160049062e-08, -0.00050813231374886489, 0.00029173497582074868,
+        -4.3171007738108918e-05, 4.2434114463651018e-06, -3.0537513438504644e-07, 1.675359098107161e-08,
+        0.28127736377019247, -0.018123406010054608, 7.1164052376986508e-05, 5.0267143691354147e-06,
+        -4.1824199697166506e-08, -9.3821152837304368e-10, -0.041313979100824766, 0.0035458002525164886,
+        -2.3982827319012026e-05, -1.3212087785280844e-06, 3.6581363733371497e-08, 2.326092955733201e-10,
+        0.0033434221588341043, -0.00040170630883754407, 6.8241602586163404e-06, 2.1660026470866612e-07,
+        -1.2701614853984636e-08, -4.9969023515208593e-11, -0.00033446382892704898, 5.6422337703990717e-05,
+        -1.4771236537564196e-06, -3.6351330464166576e-08, 2.850039149874508e-09, -2.6757421622020143e-12,
+        3.8612562800234898e-05, -8.184144643278991e-06, 2.7550631045720416e-07, 4.4768119277976863e-09,
+        -5.4350177039398629e-10, 5.8313041026584332e-12, -4.6770008505621696e-06, 1.1657476846609854e-06,
+        -4.8898581248377703e-08, -3.1074211084519438e-10, 9.6551175611566465e-11, -2.1461248516773301e-12,
+        0.20979730248064754, -0.023450365008985476, 0.00011572081871527999, 2.3903759897516532e-05,
+        -1.8690657888201257e-07, -1.6813185941349585e-08, -0.04355463649681697, 0.0059530259280029356,
+        1.3527522982215679e-06, -7.0123855812339048e-06, -6.7903885964903038e-08, 2.9985486147044925e-09,
+        0.0042492968567718076, -0.00061931953793922313, 9.2673196416980273e-08, 7.035949193563795e-07,
+        -8.1873536028695286e-09, 4.858223292216191e-12, -0.00043963047319984621, 7.8428014695668797e-05,
+        -1.1656353988535276e-06, -1.4062989228585945e-07, 9.8563338498259699e-09, 3.5726045982084736e-10,
+        5.2802363829198953e-05, -1.2576980182914446e-05, 3.3330120300745667e-07, 3.9256281154772478e-08,
+        -2.5890659483957386e-09, -1.6187009241860734e-10, -7.1815389514717755e-06, 2.0984220768626575e-06,
+        -6.176047775543028e-08, -8.528355435153134e-09, 4.7137721916347545e-10, 3.682645062727757e-11,
+        0.35646746210872776, -0.032115176492579826, 0.00061153224385216657, -6.4963466568189587e-06,
+        3.6174419102743695e-07, 3.6479425425207759e-08, -0.084990432514881448, 0.014084516835909862,
+        -0.00064056861260426787, 1.979387726837725e-05, -2.9686348461269282e-07, -1.0711523031435893e-08,
+        0.013990828843732509, -0.0038421191267321254, 0.00028160574907449312, -1.3351644092183812e-05,
+        3.8949271639620446e-07, -1.0061808983253935e-08, -0.0028876447241660591, 0.0010951507380556429,
+        -0.00010738655024380388, 6.9576458884331224e-06, -3.2192056681660207e-07, 1.1288442513294298e-08,
+        0.00065542285168751957, -0.00031208141418703495, 3.8517699184568529e-05, -3.1925938389409448e-06,
+        1.9565887172596626e-07, -9.2629967774179054e-09, -0.00015380895171096117, 8.7424143426488915e-05,
+        -1.2976581974671548e-05, 1.3009455460503027e-06, -9.7463639698864378e-08, 5.7281056260447947e-09,
+        0.24578246276100521, -0.017325082550403166, 0.00012660537648214723, 4.1108476784911741e-06,
+        1.4844628599075337e-07, 6.3508485317502117e-09, -0.034457906787809835, 0.0032999959980522585,
+        -3.6116711657322927e-05, -6.2506073704980261e-07, -1.2642003078699794e-07, -1.5767145759125997e-08,
+        0.0026004061518708874, -0.00034013500191574467, 8.248347109487625e-06, 2.9991915150475731e-08,
+        -1.8961628400732272e-08, -8.5291969581587215e-11, -0.00023428620280268819, 4.3608600475377409e-05,
+        -1.6559630366006008e-06, 4.1858117799938418e-09, 3.2789964152423832e-09, 2.1327432730593223e-11,
+        2.4522417763812168e-05, -5.9001424811847242e-06, 2.8304103921223055e-07, -2.6379573743259539e-09,
+        -3.9104854268393672e-10, 7.664572749343313e-12, -2.732480176263914e-06, 7.8206688277553969e-07,
+        -4.5056064808416143e-08, 8.1106285868038203e-10, 4.4319844335634597e-11, -2.5548357287921372e-12,
+        0.29689736373266096, -0.027515441365021143, 0.00053898293156708999, -5.7635579252007171e-06,
+        7.047401709177943e-08, 3.0239769653068225e-09, -0.061252741998476398, 0.0098264169161026843,
+        -0.00043272494253426504, 1.4789095214791338e-05, -3.2016815841573111e-07, 4.1051552760279355e-10,
+        0.0081239875989119765, -0.0021288582322216065, 0.00015636441237915156, -7.8618269451802838e-06,
+        2.7270414506414258e-07, -6.5283471016067061e-09, -0.0013445381802385335, 0.00049654129972916442,
+        -4.8765071284766377e-05, 3.2259530296828113e-06, -1.5793976579778533e-07, 5.9769572888365417e-09,
+        0.00024798592644896349, -0.00011549453932596838, 1.4119864499402504e-05, -1.1751643415209752e-06,
+        7.3964064835790895e-08, -3.6864815906892959e-09, -4.7500859181022832e-05, 2.6375819754681708e-05,
+        -3.8584954730767551e-06, 3.8601044411142181e-07, -2.934152554797159e-08, 1.782597882471288e-09,
+        0.21229703288655297, -0.016122228552198702, 0.00017228581101668309, 3.2820977347726841e-06,
+        -6.4203040590578551e-08, -5.2075711222969152e-10, -0.028171435758587129, 0.0029807387120051056,
+        -4.2978743284324647e-05, -3.8392601957215247e-07, 1.5468773068441719e-08, -7.2759458370323766e-10,
+        0.0019852767223433, -0.00027544279455978286, 7.7242326276163795e-06, -9.3351533286311563e-08,
+        -4.2068847705854216e-09, 3.1729276402096165e-10, -0.00015976871732723975, 3.1099608318517847e-05,
+        -1.429954008519864e-06, 2.8995364706374877e-08, 8.3865975261189795e-10, -6.4188759392875572e-11,
+        1.4833844464009001e-05, -3.8349877763017896e-06, 2.2766478467026779e-07, -5.9094813155204955e-09,
+        -8.4780676162818658e-11, 1.0129773196257515e-11, -1.4923620352503911e-06, 4.6825153631246065e-07,
+        -3.2900033100760846e-08, 1.1037278479349668e-09, -1.2835558040310703e-12, -1.4521909928073765e-12,
+        0.16467485206724494, -0.021457525774943576, 0.00037257242807132085, 1.7589471412724002e-05,
+        -8.5308049861986932e-07, 2.5390865378624246e-07, -0.031913133371091307, 0.0056160124593288537,
+        -8.5213439259908285e-05, -7.3811625065501012e-06, -1.5500865218934563e-07, 2.9925392109152844e-07,
+        0.0030370519532158381, -0.00058629144536316265, 8.078671161682657e-06, 6.716693299251804e-07,
+        1.168031703772511e-08, -6.0590428672972568e-09, -0.00029550986762522948, 6.5071389129428672e-05,
+        -1.9237442107863155e-06, -8.9145102957458276e-11, 4.7093458038617303e-09, -2.0255596154586826e-09,
+        3.1227264793473055e-05, -8.8484758779853811e-06, 5.1386011924695143e-07, -8.3138681598154271e-09,
+        -2.3629559848004552e-09, 4.40943533814754e-10, -3.6897437013105168e-06, 1.356319537286848e-06,
+        -1.0611808890453702e-07, 1.3177606998580904e-09, 5.561099530013338e-10, -5.3784770507623185e-11,
+        0.117559666945321, -0.02410662772576512, 0.00058713693167440335, 7.0440232050601373e-05,
+        -3.8575924280614406e-06, -4.9799023420123468e-07, -0.031056913206816708, 0.0089984290799034229,
+        -0.00023516087212404677, -3.9126881949799966e-05, 2.0349991721181212e-06, 5.6682909191764699e-08,
+        0.0038725717725668234, -0.0012378486093407091, 1.6002758132742108e-05, 7.5876225301405263e-06,
+        -1.9432274273791882e-08, -4.8707518262460392e-08, -0.00047291765185484858, 0.00014679745724613025,
+        1.4121047163094207e-06, -1.0027140505761557e-06, -7.3018845605251264e-08, 8.0144599635618247e-09,
+        5.5726316456649136e-05, -1.6257037266133329e-05, -4.4251149656166383e-07, 6.9563237789386517e-08,
+        1.8975907332705619e-08, 9.0970771991886589e-11, -6.5833644967450488e-06, 1.9496104968393642e-06,
+        1.457606480322725e-08, 4.3349993326223227e-09, -2.0338287577148011e-09, -3.8277646102417848e-10,
+        0.075806858861683701, -0.020623895930327731, 2.5531220916430711e-05, 0.00025072357894411938,
+        -1.8496104125358306e-05, 6.5966458683864868e-07, -0.026379458470195762, 0.010445459504248768,
+        -0.00018725791594143695, -0.00015627255052203236, 1.3773979128481325e-05, 1.4810513193124925e-06,
+        0.0038880282538546018, -0.0018532134671000423, 2.1790825903232628e-05, 3.6847883305308571e-05,
+        -2.4230422763123451e-06, -4.4134287184814287e-07, -0.00058608654557064767, 0.00029284760944563837,
+        2.4283553391577533e-06, -7.2590513085616765e-06, 2.3043462393486565e-07, 1.2085784730946358e-07,
+        8.6954240896782294e-05, -4.2515660308368681e-05, -1.6110217435440517e-06, 1.1946953306157493e-06,
+        3.2487516005310643e-08, -2.4637779965096487e-08, -1.2296140560504532e-05, 5.5967558064710726e-06,
+        4.5032449834754237e-07, -1.5582627540654678e-07, -2.2044278887795546e-08, 3.4624522221415856e-09,
+        0.19871123694076961, -0.036260975531881685, 0.0014307544174008019, -1.6560636269683344e-05,
+        4.0020865893278657e-07, -5.910601024366615e-08, -0.057669377390322872, 0.016226071745581449,
+        -0.0010278846171673304, 4.9727553229349328e-05, -3.043828361955273e-06, 8.7188881579654033e-08,
+        0.0094912825947276111, -0.0037258232514063364, 0.00040114092582471032, -3.519680173553852e-05,
+        2.3761057124160638e-06, -8.1334809575481426e-08, -0.0018024098486056498, 0.00098019435365466457,
+        -0.0001528667896038738, 1.7155761755844537e-05, -1.3618392304006386e-06, 7.4962693729843801e-08,
+        0.00039241181532442728, -0.00027543622934008593, 5.3927825376048155e-05, -7.2206245543982815e-06,
+        7.0896406082652255e-07, -5.4846066241763447e-08, -9.1737693732815936e-05, 7.6582548699067471e-05,
+        -1.7572693910239677e-05, 2.7518045664095496e-06, -3.2572586315039183e-07, 3.1042400144945028e-08,
+        0.1252773891389761, -0.017819926156380866, 0.00051604821559842514, 5.7150792272779232e-06,
+        -8.2905052731484652e-07, 1.7941012126382345e-09, -0.021611760180180951, 0.0046261412669793694,
+        -0.00015589608613331292, -3.8301908625307418e-06, 3.2727819436178272e-07, 8.437091648682604e-09,
+        0.0019550998583304472, -0.00048886932252166732, 1.6170020581712291e-05, 5.996042771493318e-07,
+        -2.4298581934433175e-08, -2.6390854870768523e-09, -0.0001806362827263219, 4.9808680050908254e-05,
+        -1.9276921012584516e-06, -1.5927791170295393e-08, -2.294646880315695e-09, 2.4692198494993455e-10,
+        1.710154949762861e-05, -5.4356970154442334e-06, 3.2981147079322984e-07, -1.4454157300530218e-08,
+        8.8587835193969784e-10, 4.4567903024640275e-11, -1.7081327625053382e-06, 6.6310609678834567e-07,
+        -6.20888756011312e-08, 4.279799905521496e-09, -1.3109397276897458e-10, -2.0366846534150134e-11,
+        0.13701740002339782, -0.025600201661936474, 0.0012276257197440595, -2.0270813060989111e-05,
+        -7.2643708189720492e-07, -1.9104588133097677e-08, -0.032023433603603949, 0.0097324318601998971,
+        -0.0006479825037429811, 1.9812999157513578e-05, -6.4908643800598089e-07, 1.0126599043888416e-07,
+        0.0042863677625024068, -0.0016828359605923502, 0.00015361191763853089, -9.9998055160407834e-06,
+        8.1522321212559113e-07, -6.6228217068199317e-08, -0.00061364011529750823, 0.00030180185242735291,
+        -3.9201707276253338e-05, 4.1349047553285476e-06, -4.0666193321401387e-07, 2.9628677552197232e-08,
+        9.4275670955149392e-05, -5.8241643592064313e-05, 1.0257443982186612e-05, -1.4000567596826864e-06,
+        1.5195947884171528e-07, -1.1970871439956302e-08, -1.5520474897313735e-05, 1.1729224225535636e-05,
+        -2.5619465760080264e-06, 4.0702680933558755e-07, -4.8883677602449599e-08, 4.4868729649524931e-09,
+        0.093832499070204897, -0.013629253027767192, 0.00051152053504304839, -5.6689417531675289e-06,
+        -5.1677560882931757e-07, 2.5087931720053018e-08, -0.013685488600315942, 0.0032896687252244863,
+        -0.00016853213918784372, 1.6186007339207456e-06, 2.870150254425089e-07, -1.141420131574915e-08,
+        0.0011226433600669979, -0.00034062256337509078, 1.9679383415800868e-05, -7.6586532704161285e-08,
+        -4.7828217369921751e-08, 9.4715837152250951e-10, -9.7127265084170347e-05, 3.3545961342398189e-05,
+        -2.0984389216485004e-06, 5.955232629415679e-09, 4.5256910189815594e-09, 1.2750739456753083e-10,
+        8.4826372028642387e-06, -3.2632285486348391e-06, 2.3187545036221947e-07, -4.277252719945732e-09,
+        5.247813122755852e-11, -5.8703673944826461e-11, -7.506569821522496e-07, 3.2246921308486974e-07,
+        -2.8294254606407086e-08, 1.4369968603374076e-09, -1.1652593969722865e-10, 1.1699045390261359e-11,
+        0.075734171331662353, -0.01742159231841452, 0.00094793030314543197, -6.00842788962186e-06,
+        -3.5101228506414743e-06, 2.2841133121953228e-07, -0.015963538561379737, 0.0059068143899099358,
+        -0.00045906185616199658, 3.8868554245231192e-06, 2.3616937539004175e-06, -1.5403519092997679e-07,
+        0.001758462155328606, -0.00082781933274350737, 7.2830473568605628e-05, 2.4911909993875577e-07,
+        -5.8463608169682256e-07, 2.9562958920570751e-08, -0.00020807951527633124, 0.0001084814655128859,
+        -9.6211824149140132e-06, -2.8691505375927057e-07, 1.1773038561432564e-07, -2.7923434804443135e-09,
+        2.4508156886505347e-05, -1.3569403961988092e-05, 1.1367016636706708e-06, 8.0606318053879821e-08,
+        -1.9059871488693424e-08, -3.7324876895910268e-10, -2.8532144378909095e-06, 1.6522923944728817e-06,
+        -1.2807458119016022e-07, -1.435739723686336e-08, 2.2806204125975505e-09, 2.3761941806917098e-10,
+        0.07279180367757733, -0.022921011385912037, 0.0023189895940950978, -0.00016103462868941585,
+        3.4504940923685521e-06, 7.8363208259836654e-07, -0.019728533375024754, 0.010997277535465247,
+        -0.0016647929686793978, 0.00014963410641542297, -4.298685435152769e-06, -8.2370094744699241e-07,
+        0.0033264895094631043, -0.0024657281935460819, 0.00046664216386471864, -5.0708813164498759e-05,
+        2.0445746910533204e-06, 2.1684829031336736e-07, -0.00062005455987718323, 0.00054123356456440555,
+        -0.00012038961694455153, 1.5509747838549557e-05, -9.8070837841491305e-07, 1.6035602514905576e-08,
+        0.00011956075166757489, -0.00011798459508893741, 3.0129346571715478e-05, -4.6553206116204546e-06,
+        4.71720773031639e-07, -5.3393038133218886e-08, -2.3460581591249104e-05, 2.5459484492796974e-05,
+        -7.3728697078971075e-06, 1.3785517195886651e-06, -2.031373371223087e-07, 3.4199194730846433e-08,
+        0.047795652901754547, -0.010743912220974504, 0.00068278554273125977, -2.8813022715004618e-05,
+        1.5482556170191827e-07, 9.1305500464367175e-08, -0.0073825827266895613, 0.0028194461600576028,
+        -0.00029001244470048518, 1.7430689058191237e-05, -2.8559505331480399e-07, -5.6986719660501409e-08,
+        0.00062022406294312451, -0.00033525881114218012, 4.4379602877999269e-05, -3.2514361668668014e-06,
+        7.0770859188289082e-08, 1.3667178518665701e-08, -6.275048727968811e-05, 4.0003795105444636e-05,
+        -6.114922397439674e-06, 5.1428277597243012e-07, -1.1878120590829658e-08, -3.0239289967718272e-09,
+        6.5658261869862392e-06, -4.6872824907460224e-06, 8.0753507014598576e-07, -7.5309060535569386e-08,
+        1.5694700810297893e-09, 6.2007503878442927e-10, -6.8402459091898255e-07, 5.4257063321482088e-07,
+        -1.0375201996114686e-07, 1.0482411030723633e-08, -1.7244744118478535e-10, -1.1412827681781477e-10,
+        0.040277761262532408, -0.014024583751060004, 0.0011191873472767145, -2.7219077819754494e-05,
+        -7.2105640719609054e-06, 1.2014868421013295e-06, -0.010107784034242333, 0.005409438638228359,
+        -0.00070958314900960778, 4.0602013542692258e-05, 3.7285543831981265e-06, -9.6625319174221081e-07,
+        0.0011110011736893369, -0.00082419312440518806, 0.00014600421999129263, -1.0526380430764953e-05,
+        -8.170884283414892e-07, 2.7052528575304064e-07, -0.00014318909017825023, 0.00012715221157625039,
+        -2.549748446795622e-05, 2.1197086189328077e-06, 1.6817907622233273e-07, -6.4820635165487905e-08,
+        2.0263167309146625e-05, -1.9258942722852982e-05, 4.1890528995328928e-06, -3.6935897484091033e-07,
+        -3.6390982163479998e-08, 1.4482224203110097e-08, -2.8714433264308264e-06, 2.8530168194730105e-06,
+        -6.5234905775123337e-07, 5.7417519514371895e-08, 8.2374185697341387e-09, -3.093912320534224e-09,
+        0.025975829924221622, -0.015891196834108067, -0.0025907888247290122, -0.0013377052753332224,
+        -0.00074079136201044959, -0.00013832957079746493, -0.015975068132567414, 0.00083389481518111701,
+        -0.0057341697552864713, -0.0030442379097301753, -0.0011614555628889597, -0.0002696151724480835,
+        -0.00094592178959351585, -0.0061716454134885211, -0.0033414170098173351, -0.0020157638716283327,
+        -0.00083214639540689437, -0.00019016007829527102, -0.0016305905400975775, -0.002208061934988759,
+        -0.0018645492813122793, -0.0010365299341097366, -0.00039330670438092306, -8.6275244344342811e-05,
+        -0.00042683045020260534, -0.00088203466150703889, -0.00060438116652743342, -0.00033504111247736548,
+        -0.00011526162810119546, -1.3961541772905251e-05, -8.1764864716955455e-05, -0.00014636883367964544,
+        -9.6264168344879702e-05, -5.7340295495769519e-05, -8.2676467116174184e-06, 2.1219626865665059e-06,
+        0.018924571020529878, -0.014350157739606214, 0.0036437950912806176, -0.00040201949270075589,
+        0.00023575697678218186, -1.0691575649419626e-05, -0.0068036365217643852, 0.0087594524363650492,
+        -0.0019887534339225093, 0.0012616098402251454, -2.0321840586245369e-05, 8.3998552187117379e-05,
+        0.0018209472715133633, -0.0012628941739968003, 0.001535955097179866, -5.9973784082804365e-06,
+        0.00026350398620961538, 1.0423543654365224e-06, -0.00017990596020949783, 0.0010060352702640854,
+        -3.3162197146570402e-05, 0.0003475712595263696, 1.9942715924002485e-05, 2.7046536223291706e-05,
+        0.00018738016816009968, -8.3413554397270925e-05, 0.00023351316269341663, -1.4315427949535533e-06,
+        4.138673418323336e-05, -6.0647559843242429e-06, -3.0824014050838091e-05, 8.6987105790798945e-05,
+        -2.8336189060847894e-05, 3.0545269195471849e-05, -8.5523716009777826e-06, 4.6518150270609174e-06,
+        0.017682732377340051, -0.0027727799084129312, 9.6539188617956749e-05, -1.293714595032862e-06,
+        -3.0011782450950882e-09, 5.8565270452733234e-09, -0.001384849508761454, 0.00035115236460398305,
+        -1.5229945953967831e-05, 6.7640921439267819e-07, 6.6162459770289414e-09, 3.6517921952335687e-09,
+        4.3486878072324767e-05, -9.8492914470438059e-06, 1.103932352829929e-06, -2.6526441715816291e-08,
+        1.4077056061084902e-08, 2.2215291834045525e-09, -8.9230403277345271e-07, 5.13189088928225e-07,
+        -2.8046455584667061e-08, 2.1845082747928657e-08, 7.5755392364598415e-09, 1.4568106013585576e-09,
+        3.928381590268558e-08, -6.4304007420191942e-09, 1.5603684761421786e-08, 8.1500404351982075e-09,
+        3.1196915506934839e-09, 4.4723386089834652e-10, -1.5211518290883824e-10, 3.8526409915404358e-09,
+        2.5999137312775327e-09, 1.3741716410361619e-09, 3.6521378391382162e-10, -2.6526229765445896e-11,
+        0.049759717268572992, 0.056121037066708963, 0.035694544492569112, 0.015493045851004712,
+        0.0041894346119490476, 0.00054042781663345314, 0.054072121507338852, 0.10029334083068293,
+        0.0616875012590248, 0.02637855770563256, 0.007049166423101526, 0.00089241620485743694,
+        0.036449816681428479, 0.062192203055686249, 0.038565926848840269, 0.016543245393330686,
+        0.0044429106769551547, 0.00056844408784164735, 0.014790345569338365, 0.025294038183253244,
+        0.015603199449771777, 0.0066582603154676703, 0.0017753709921833278, 0.00022442952764921116,
+        0.0038159270061477045, 0.0065034514489573482, 0.0039940046417420326, 0.0017014580165047287,
+        0.00045642546355995853, 5.9021008019739925e-05, 0.00034259878871478375, 0.00057248689600750938,
+        0.00032498676353098625, 0.0001164931140831398, 2.0679735991001901e-05, 0,
+        0.012314548853026323, -5.36122935357231e-05, -4.0404061782375289e-06, -4.3786136396137347e-08,
+        -6.572228270248048e-09, -3.3126752079970689e-10, -0.00051007942320249289, 6.3329605572210097e-06,
+        -1.5648758687036112e-08, -2.0990071244872974e-08, -2.1712919545862922e-09, -2.4298777727925287e-10,
+        1.925133204531701e-06, 2.5453796046823474e-07, 2.5918125584290506e-09, -4.6894932546462246e-09,
+        -1.3095905616626951e-09, -1.6735229552042436e-10, -2.7747624023522804e-08, 2.2022016190149543e-09,
+        -4.6374981276566344e-09, -2.2634204185299944e-09, -6.1595543821548849e-10, -7.9129489652964884e-11,
+        -2.4216890372846279e-09, -2.5536198150421571e-09, -1.5456493797562012e-09, -6.5718231500265615e-10,
+        -1.745701942806503e-10, -2.1956601252040563e-11, -1.9858534511603985e-10, -3.2981395740489917e-10,
+        -2.0052870698488753e-10, -8.3337101437483128e-11, -2.1464718528932683e-11, -2.5744305002618385e-12,
+        0.011714088329248232, -8.3052367894928013e-06, -2.3724273395667894e-07, -3.9561090380136896e-10,
+        -1.7773570326820627e-11, -2.4467018151348915e-13, -0.00012667460612149771, 4.7502585526366281e-07,
+        2.1075083383030149e-09, -4.7742727993085642e-11, -1.4396908134206778e-12, -1.4287950731001985e-13,
+        9.2000211805368761e-08, 4.6239690841516172e-09, 6.0899376427103057e-11, -2.6647733788583639e-12,
+        -7.8592045733460898e-13, -9.7983855336949146e-14, -6.3016459195279879e-10, 2.7898662250355103e-11,
+        -2.6461923264260353e-12, -1.3330884478590038e-12, -3.4819713169385311e-13, -4.2948959481260001e-14,
+        -4.5823870571195865e-12, -1.3546337349702478e-12, -7.9900629230932474e-13, -3.2258549946157446e-13,
+        -7.896937957111844e-14, -8.7664249265925517e-15, -7.9427634395170712e-14, -1.2459805253262055e-13,
+        -6.966171011294341e-14, -2.3949062943677319e-14, -3.9645698483631985e-15, 0,
+        0.01156167524209903, -1.74989128933125e-06, -1.4537862905871894e-08, -2.4028821583320045e-12,
+        1.8662849220895723e-12, 4.1315623788097057e-13, -3.164959936807156e-05, 3.0676494457699588e-08,
+        3.5660594018468129e-11, 2.9965204333015019e-12, 2.820315809538745e-12, 6.5250003117656855e-13,
+        5.2017475530500281e-09, 4.3961245167682335e-11, -1.2329545567313059e-11, -1.7457303395800523e-12,
+        8.1405816962428479e-13, 2.9340222554799404e-13, -2.407595607809484e-11, -2.1257513516522108e-11,
+        -1.0725887604305437e-11, -2.8822660675288871e-12, -1.7304872019174753e-13, 6.6245994496519767e-14,
+        -5.2061982095653057e-12, -8.4686459963110228e-12, -4.4861634850846386e-12, -1.4092006439731864e-12,
+        -2.004484361094353e-13, 0, -8.0367481464701594e-13, -1.3119012798071749e-12,
+        -6.9665084897802578e-13, -2.2022142622528679e-13, -3.1811480671007709e-14, 0,
+        0.0071210194389864446, -0.00084372641448191672, 2.4099613246643934e-05, -1.5131930087492623e-07,
+        3.7883990076814388e-08, 3.2525427561379077e-09, -0.00021714548245627428, 3.8118048595128393e-05,
+        -6.3241615761104039e-07, 1.8432188221559447e-07, 4.2627805120104187e-08, 5.7819684548953483e-09,
+        2.6237343923693074e-06, 8.8268947784445578e-08, 2.650699844913334e-07, 1.0474076622789126e-07,
+        2.9112551863563311e-08, 3.6614588986109391e-09, 1.6450291976760815e-07, 1.7244563531481105e-07,
+        1.072656731950493e-07, 4.7817707719327604e-08, 1.2777513439144078e-08, 1.5321284623207438e-09,
+        2.9385721883003978e-08, 4.8106412939760853e-08, 3.0435857510302437e-08, 1.3031619067232482e-08,
+        3.2612823705503875e-09, 3.4761945270966979e-10, 3.2249356686504199e-09, 6.1030972790480558e-09,
+        3.8445434756313542e-09, 1.5392576014692454e-09, 3.3747194176384053e-10, 2.9381766663919314e-11,
+        0.007700102424657118, -2.8015260018751409e-05, 2.1021372439074483e-08, -1.0480525524039909e-09,
+        -2.2893691518006184e-10, -2.2688650287765625e-11, -7.5963048157914953e-06, 3.1259868260214564e-08,
+        -4.4962834057132972e-09, -1.6543930437364944e-09, -3.6023337908977564e-10, -3.5091797598348245e-11,
+        6.2626650993286169e-10, -4.0203621947614811e-09, -2.2452533351513264e-09, -8.0929413198116643e-10,
+        -1.6845248975306906e-10, -1.5327539128131141e-11, -7.2598135454078701e-10, -1.1934708474823816e-09,
+        -6.4576330773630312e-10, -2.1752701566349776e-10, -4.0090854832663194e-11, -2.93327718491494e-12,
+        -1.0859884519782025e-10, -1.7396116382339504e-10, -8.6885193995620468e-11, -2.4422729641652244e-11,
+        -2.8882894935588788e-12, 0, -6.0973123462286418e-12, -9.3951867485435141e-12,
+        -4.0533157620257863e-12, -7.5996140032518015e-13, 0, 0
+    };
+
+}    // namespace KSteam::impl::TransportData
+
+#endif    // KSTEAM_TRANSPORTDATA_HPP
@@ -0,0 +1,146 @@
+/*
+KKKKKKKKK    KKKKKKK   SSSSSSSSSSSSSSS      tttt
+K:::::::K    K:::::K SS:::::::::::::::S  ttt:::t
+K:::::::K    K:::::KS:::::SSSSSS::::::S  t:::::t
+K:::::::K   K::::::KS:::::S     SSSSSSS  t:::::t
+KK::::::K  K:::::KKKS:::::S        ttttttt:::::ttttttt        eeeeeeeeeeee    aaaaaaaaaaaaa      mmmmmmm    mmmmmmm
+  K:::::K K:::::K   S:::::S        t:::::::::::::::::t      ee::::::::::::ee  a::::::::::::a   mm:::::::m  m:::::::mm
+  K::::::K:::::K     S::::SSSS     t:::::::::::::::::t     e::::::eeeee:::::eeaaaaaaaaa:::::a m::::::::::mm::::::::::m
+  K:::::::::::K       SS::::::SSSSStttttt:::::::tttttt    e::::::e     e:::::e         a::::a m::::::::::::::::::::::m
+  K:::::::::::K         SSS::::::::SS    t:::::t          e:::::::eeeee::::::e  aaaaaaa:::::a m:::::mmm::::::mmm:::::m
+  K::::::K:::::K           SSSSSS::::S   t:::::t          e:::::::::::::::::e aa::::::::::::a m::::m   m::::m   m::::m
+  K:::::K K:::::K               S:::::S  t:::::t          e::::::eeeeeeeeeee a::::aaaa::::::a m::::m   m::::m   m::::m
+KK::::::K  K:::::KKK            S:::::S  t:::::t    tttttte:::::::e         a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K   K::::::KSSSSSSS     S:::::S  t::::::tttt:::::te::::::::e        a::::a    a:::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS::::::SSSSSS:::::S  tt::::::::::::::t e::::::::eeeeeeeea:::::aaaa::::::a m::::m   m::::m   m::::m
+K:::::::K    K:::::KS:::::::::::::::SS     tt:::::::::::tt  ee:::::::::::::e a::::::::::aa:::am::::m   m::::m   m::::m
+KKKKKKKKK    KKKKKKK SSSSSSSSSSSSSSS         ttttttttttt      eeeeeeeeeeeeee  aaaaaaaaaa  aaaammmmmm   mmmmmm   mmmmmm
+
+MIT License
+
+Copyright (c) 2023 Kenneth Troldal Balslev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef KSTEAM_UNCERTAINTY_HPP
+#define KSTEAM_UNCERTAINTY_HPP
+
+#include "Common.hpp"
+#include "Config.hpp"
+#include "Error.hpp"
+#include "Sensitivity.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <vector>
+
+namespace KSteam
+{
+
+    /**
+     * @brief The order of the Taylor expansion used for uncertainty propagation.
+     *
+     * First order propagation uses the gradients of the properties only. Second order propagation also uses the
+     * Hessians, which corrects the mean for curvature and adds the second order contribution to the covariance.
+     */
+    enum class PropagationOrder { First, Second };
+
+    /**
+     * @brief Propagates the uncertainty of a batch of specifications to a set of properties.
+     *
+     * For each point, the flash is solved once, and the sensitivities of the properties with respect to the
+     * specifications are found from the converged state using the implicit function theorem. The uncertainties of
+     * the two specifications are assumed to be independent.
+     *
+     * The results are stored point by point: means[i * n + k] and stdDevs[i * n + k] hold the result for point i and
+     * property k, where n is the number of properties. If covariances is not empty, the full covariance matrix of each
+     * point is stored in covariances[i * n * n + k * n + l].
+     *
+     * @param spec1 The first specified property (e.g. Pressure).
+     * @param spec2 The second specified property (e.g. Enthalpy).
+     * @param values1 The values of the first specification.
+     * @param values2 The values of the second specification.
+     * @param stdDevs1 The standard deviations of the first specification.
+     * @param stdDevs2 The standard deviations of the second specification.
+     * @param properties The properties to calculate.
+     * @param means Output; the property values (first order) or the corrected mean values (second order).
+     * @param stdDevs Output; the standard deviations of the properties.
+     * @param covariances Output (optional); the covariances between the properties.
+     * @param order The order of the propagation (default: first order).
+     * @throws KSteamError If the sizes of the inputs do not match, or a flash calculation fails.
+     */
+    inline void propagateUncertainty(Property                  spec1,
+                                     Property                  spec2,
+                                     std::span<const FLOAT>    values1,
+                                     std::span<const FLOAT>    values2,
+                                     std::span<const FLOAT>    stdDevs1,
+                                     std::span<const FLOAT>    stdDevs2,
+                                     std::span<const Property> properties,
+                                     std::span<FLOAT>          means,
+                                     std::span<FLOAT>          stdDevs,
+                                     std::span<FLOAT>          covariances = {},
+                                     PropagationOrder          order       = PropagationOrder::First)
+    {
+        auto count = values1.size();
+        auto n     = properties.size();
+
+        // Check that the sizes of the inputs and outputs match
+        if (values2.size() != count || stdDevs1.size() != count || stdDevs2.size() != count)
+            throw KSteamError("Input size mismatch", "propagateUncertainty", { { "Points", static_cast<double>(count) } });
+        if (means.size() != count * n || stdDevs.size() != count * n || (!covariances.empty() && covariances.size() != count * n * n))
+            throw KSteamError("Output size mismatch", "propagateUncertainty", { { "Points", static_cast<double>(count) } });
+
+        std::vector<FLOAT> cov(n * n);
+        for (size_t i = 0; i < count; ++i) {
+            // Solve the flash once, and compute the sensitivities from the converged state
+            auto state     = impl::flash(spec1, values1[i], spec2, values2[i]);
+            auto gradients = impl::specificationGradients(state, spec1, spec2, properties);
+            auto var1      = stdDevs1[i] * stdDevs1[i];
+            auto var2      = stdDevs2[i] * stdDevs2[i];
+
+            // First order: cov = g_k * Sigma * g_l^T
+            for (size_t k = 0; k < n; ++k) {
+                means[i * n + k] = state.property(properties[k]);
+                for (size_t l = 0; l < n; ++l)
+                    cov[k * n + l] = gradients[k * 2] * gradients[l * 2] * var1 + gradients[k * 2 + 1] * gradients[l * 2 + 1] * var2;
+            }
+
+            // Second order: mean += 0.5 * tr(H_k * Sigma), cov += 0.5 * tr(H_k * Sigma * H_l * Sigma)
+            if (order == PropagationOrder::Second) {
+                auto hessians = impl::specificationHessians(state, spec1, spec2, properties);
+                for (size_t k = 0; k < n; ++k) {
+                    const auto* hk = &hessians[k * 3];
+                    means[i * n + k] += 0.5 * (hk[0] * var1 + hk[2] * var2);
+                    for (size_t l = 0; l < n; ++l) {
+                        const auto* hl = &hessians[l * 3];
+                        cov[k * n + l] += 0.5 * (hk[0] * hl[0] * var1 * var1 + 2.0 * hk[1] * hl[1] * var1 * var2 + hk[2] * hl[2] * var2 * var2);
+                    }
+                }
+            }
+
+            for (size_t k = 0; k < n; ++k) stdDevs[i * n + k] = std::sqrt(cov[k * n + k]);
+            if (!covariances.empty()) std::copy(cov.begin(), cov.end(), covariances.begin() + static_cast<std::ptrdiff_t>(i * n * n));
+        }
+    }
+
+}    // namespace KSteam
+
+#endif    // KSTEAM_UNCERTAINTY_HPP
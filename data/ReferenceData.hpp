@@ -0,0 +1,91 @@
+//
+// Reader for the bundled IAPWS-IF97 reference data.
+//
+// Each file starts with an 8 byte magic string ("KSTEAMRD"), followed by the number of fields per state and the number
+// of states, both as 32 bit unsigned integers. Then follows the states, each stored as FieldCount 64 bit IEEE doubles
+// in the order of the State struct. All values are little endian and in SI units. Values that are not given in the
+// source are stored as NaN.
+//
+// The files are generated by tools/GenerateReferenceData.cpp.
+//
+
+#ifndef KSTEAM_REFERENCEDATA_HPP
+#define KSTEAM_REFERENCEDATA_HPP
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace ReferenceData
+{
+    inline constexpr char          Magic[8]   = { 'K', 'S', 'T', 'E', 'A', 'M', 'R', 'D' };
+    inline constexpr std::uint32_t FieldCount = 9;
+
+    // A reference state. Single phase states have X = NaN, and are defined by pressure and temperature. Saturated
+    // states are defined by pressure and vapor quality.
+    struct State
+    {
+        double P;  /*< Pressure [Pa] */
+        double T;  /*< Temperature [K] */
+        double X;  /*< Vapor quality [-] */
+        double V;  /*< Specific volume [m³/kg] */
+        double H;  /*< Specific enthalpy [J/kg] */
+        double S;  /*< Specific entropy [J/(kg·K)] */
+        double U;  /*< Specific internal energy [J/kg] */
+        double Cp; /*< Isobaric heat capacity [J/(kg·K)] */
+        double W;  /*< Speed of sound [m/s] */
+
+        [[nodiscard]] bool isSaturated() const { return !std::isnan(X); }
+    };
+
+    static_assert(sizeof(State) == FieldCount * sizeof(double));
+
+    // The directory holding the bundled reference data files.
+    inline std::filesystem::path directory()
+    {
+#ifdef KSTEAM_REFERENCE_DATA_DIR
+        return KSTEAM_REFERENCE_DATA_DIR;
+#else
+        return std::filesystem::path(__FILE__).parent_path();
+#endif
+    }
+
+    // Reads the states in a reference data file. Throws std::runtime_error if the file cannot be read.
+    inline std::vector<State> read(const std::filesystem::path& path)
+    {
+        static_assert(std::endian::native == std::endian::little, "The reference data is stored in little endian format.");
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file) throw std::runtime_error("Unable to open reference data file " + path.string());
+
+        char          magic[sizeof(Magic)] {};
+        std::uint32_t fields {};
+        std::uint32_t count {};
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char*>(&fields), sizeof(fields));
+        file.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!file || std::memcmp(magic, Magic, sizeof(Magic)) != 0 || fields != FieldCount)
+            throw std::runtime_error("Invalid reference data file " + path.string());
+
+        std::vector<State> states(count);
+        file.read(reinterpret_cast<char*>(states.data()), static_cast<std::streamsize>(count * sizeof(State)));
+        if (!file) throw std::runtime_error("Truncated reference data file " + path.string());
+
+        return states;
+    }
+
+    // The IAPWS-IF97 verification values.
+    inline std::vector<State> verification() { return read(directory() / "IF97Verification.bin"); }
+
+    // The generated reference set. In regions 1, 2 and 5, and for saturated states, it is a snapshot of the IF97.h output
+    // that KSteam itself uses; region 3 states are evaluated from the basic equation in (T, rho). See
+    // tools/GenerateReferenceData.cpp.
+    inline std::vector<State> reference() { return read(directory() / "IF97Reference.bin"); }
+}    // namespace ReferenceData
+
+#endif    // KSTEAM_REFERENCEDATA_HPP
@@ -5,39 +5,35 @@
 #include "_external.hpp"
 
 #include <KSteam.hpp>
+#include <ReferenceData.hpp>
 #include <array>
 
 #include <functional>
 #include <iostream>
+#include <span>
 
 
 
-auto computeProps(const std::function<double(double, double, const char*)>& func, double arg1, double arg2)
+// The properties to compute, in the order used by printProps.
+const std::array<KSteam::Property, 8> PropertyList { KSteam::Property("P"), KSteam::Property("T"),  KSteam::Property("V"),
+                                                     KSteam::Property("H"), KSteam::Property("S"),  KSteam::Property("Cp"),
+                                                     KSteam::Property("U"), KSteam::Property("X") };
+
+using MultiFunc      = std::function<void(double, double, std::span<const KSteam::Property>, std::span<double>)>;
+using MultiFuncGuess = std::function<void(double, double, std::span<const KSteam::Property>, std::span<double>, double)>;
+
+auto computeProps(const MultiFunc& func, double arg1, double arg2)
 {
     std::array<double, 8> props {};
-    props[0] = func(arg1, arg2, "P");
-    props[1] = func(arg1, arg2, "T");
-    props[2] = KSteam::calcPropertyPT(props[0], props[1], "V");
-    props[3] = KSteam::calcPropertyPT(props[0], props[1], "H");
-    props[4] = KSteam::calcPropertyPT(props[0], props[1], "S");
-    props[5] = KSteam::calcPropertyPT(props[0], props[1], "Cp");
-    props[6] = KSteam::calcPropertyPT(props[0], props[1], "U");
-    props[7] = KSteam::calcPropertyPT(props[0], props[1], "X");
+    func(arg1, arg2, PropertyList, props);
 
     return props;
 }
 
-auto computeProps(const std::function<double(double, double, const char*, double)>& func, double arg1, double arg2, double guess)
+auto computeProps(const MultiFuncGuess& func, double arg1, double arg2, double guess)
 {
     std::array<double, 8> props {};
-    props[0] = func(arg1, arg2, "P", guess);
-    props[1] = func(arg1, arg2, "T", guess);
-    props[2] = KSteam::calcPropertyPT(props[0], props[1], "V");
-    props[3] = KSteam::calcPropertyPT(props[0], props[1], "H");
-    props[4] = KSteam::calcPropertyPT(props[0], props[1], "S");
-    props[5] = KSteam::calcPropertyPT(props[0], props[1], "Cp");
-    props[6] = KSteam::calcPropertyPT(props[0], props[1], "U");
-    props[7] = KSteam::calcPropertyPT(props[0], props[1], "X");
+    func(arg1, arg2, PropertyList, props, guess);
 
     return props;
 }
@@ -81,24 +77,26 @@ void printProps(const std::array<double, 8>& props, const std::string& spec)
 
 int main()
 {
-    // auto funcBase = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyPX(arg1, arg2, arg3); };
-    auto funcBase = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyPT(arg1, arg2, arg3); };
-    auto funcPH   = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyPH(arg1, arg2, arg3); };
-    auto funcPS   = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyPS(arg1, arg2, arg3); };
-    auto funcPU   = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyPU(arg1, arg2, arg3); };
-    auto funcPD   = [](double arg1, double arg2, const char* arg3, double tg) { return KSteam::calcPropertyPRHO(arg1, arg2, arg3, tg); };
-    auto funcPV   = [](double arg1, double arg2, const char* arg3, double tg) { return KSteam::calcPropertyPV(arg1, arg2, arg3, tg); };
-    auto funcTD   = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyTRHO(arg1, arg2, arg3); };
-    auto funcTV   = [](double arg1, double arg2, const char* arg3) { return KSteam::calcPropertyTV(arg1, arg2, arg3); };
-    auto funcTH   = [](double arg1, double arg2, const char* arg3, double g) { return KSteam::calcPropertyTH(arg1, arg2, arg3, g); };
-    auto funcTS   = [](double arg1, double arg2, const char* arg3, double g) { return KSteam::calcPropertyTS(arg1, arg2, arg3, g); };
-    auto funcTU   = [](double arg1, double arg2, const char* arg3, double g) { return KSteam::calcPropertyTU(arg1, arg2, arg3, g); };
-
-    io::CSVReader<7, io::trim_chars<' ', '\t'>, io::no_quote_escape<';'>> in("C:/Users/kenne/Desktop/Table04.csv");
-    in.read_header(io::ignore_extra_column, "P", "t", "v", "h", "s", "cp", "w");
-    double P, t, v, h, s, cp, w;
-    while (in.read_row(P, t, v, h, s, cp, w)) {
-
+    // auto funcBase = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesPX(arg1, arg2, props, res); };
+    auto funcBase = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesPT(arg1, arg2, props, res); };
+    auto funcPH   = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesPH(arg1, arg2, props, res); };
+    auto funcPS   = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesPS(arg1, arg2, props, res); };
+    auto funcPU   = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesPU(arg1, arg2, props, res); };
+    auto funcPD   = [](double arg1, double arg2, auto props, auto res, double tg) { KSteam::calcPropertiesPRHO(arg1, arg2, props, res, tg); };
+    auto funcPV   = [](double arg1, double arg2, auto props, auto res, double tg) { KSteam::calcPropertiesPV(arg1, arg2, props, res, tg); };
+    auto funcTD   = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesTRHO(arg1, arg2, props, res); };
+    auto funcTV   = [](double arg1, double arg2, auto props, auto res) { KSteam::calcPropertiesTV(arg1, arg2, props, res); };
+    auto funcTH   = [](double arg1, double arg2, auto props, auto res, double g) { KSteam::calcPropertiesTH(arg1, arg2, props, res, g); };
+    auto funcTS   = [](double arg1, double arg2, auto props, auto res, double g) { KSteam::calcPropertiesTS(arg1, arg2, props, res, g); };
+    auto funcTU   = [](double arg1, double arg2, auto props, auto res, double g) { KSteam::calcPropertiesTU(arg1, arg2, props, res, g); };
+
+    for (const auto& state : ReferenceData::reference()) {
+
+        // Pressure in bar and temperature in degrees Celsius, as in the steam tables
+        double P = state.P / 100000;
+        double t = state.T - 273.15;
+
+        if (state.isSaturated()) continue;
         if (P < 0.01) continue;
         if (t < 800) continue;
 
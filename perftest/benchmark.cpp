@@ -156,4 +156,31 @@ static void BM_FlashPU_T(benchmark::State& state) {
 // Register the function as a benchmark
 BENCHMARK(BM_FlashPU_T)->Unit(benchmark::kMillisecond);
 
+static void BM_ConductivityPT(benchmark::State& state) {
+
+    std::random_device rd;
+    std::mt19937 mt_generator(rd());
+
+    std::uniform_int_distribution<int> distribution(0, 99);
+
+    auto accuracy = static_cast<KSteam::Accuracy>(state.range(0));
+    double pres = 1.0e+07;
+    double result {};
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        int i = distribution(mt_generator);
+        state.ResumeTiming();
+
+        result = KSteam::calcPropertyPT(pres, i * 5 + 273.16, KSteam::Property::ThermalConductivity, accuracy);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+}
+// Register the function as a benchmark, for the exact and fast accuracy policies
+BENCHMARK(BM_ConductivityPT)
+    ->Arg(static_cast<int>(KSteam::Accuracy::Exact))
+    ->Arg(static_cast<int>(KSteam::Accuracy::Fast))
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
\ No newline at end of file
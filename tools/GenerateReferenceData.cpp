@@ -0,0 +1,197 @@
+//
+// Generates the binary reference data in data/.
+//
+// IF97Verification.bin holds the computer-program verification values from the IAPWS-IF97 release (Tables 5, 15, 33
+// and 42 for the basic equations of regions 1, 2, 3 and 5, and Tables 35 and 36 for the saturation line). Values not
+// given in the release are stored as NaN.
+//
+// IF97Reference.bin holds a larger set of states: a grid in (P, T) covering regions 1, 2, 3 and 5, and saturated states
+// along the saturation line at several vapor qualities.
+//
+// - In regions 1, 2 and 5, the states are evaluated from the basic equations in (P, T), i.e. the same equations that
+//   KSteam uses. For these states, the set is a regression snapshot of the current output, not an independent check.
+// - The basic equation of region 3 is given in (T, rho). The density at the grid point is found from the backward
+//   equations (IAPWS SR5-05), and all properties, including the pressure, are then evaluated from the basic equation
+//   at that temperature and density. These states are therefore exact IF97 states, independent of the backward
+//   equations used by KSteam to evaluate region 3 from (P, T).
+// - The saturated states use the IF97 saturation equation and the saturated liquid and vapor densities of IF97.h,
+//   which above 623.15 K are found from the region 3 backward equations. They are also a regression snapshot.
+//
+// See data/ReferenceData.hpp for the file format.
+//
+// Usage: GenerateReferenceData [output directory]
+//
+
+#include <IF97/IF97.h>
+#include <ReferenceData.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+    // The IAPWS-IF97 verification values, converted to SI units.
+    std::vector<ReferenceData::State> verificationStates()
+    {
+        std::vector<ReferenceData::State> states {
+            // Table 5, region 1
+            { 3.0E6, 300.0, NaN, 0.100215168E-2, 0.115331273E6, 0.392294792E3, 0.112324818E6, 0.417301218E4, 0.150773921E4 },
+            { 80.0E6, 300.0, NaN, 0.971180894E-3, 0.184142828E6, 0.368563852E3, 0.106448356E6, 0.401008987E4, 0.163469054E4 },
+            { 3.0E6, 500.0, NaN, 0.120241800E-2, 0.975542239E6, 0.258041912E4, 0.971934985E6, 0.465580682E4, 0.124071337E4 },
+
+            // Table 15, region 2
+            { 0.0035E6, 300.0, NaN, 0.394913866E2, 0.254991145E7, 0.852238967E4, 0.241169160E7, 0.191300162E4, 0.427920172E3 },
+            { 0.0035E6, 700.0, NaN, 0.923015898E2, 0.333568375E7, 0.101749996E5, 0.301262819E7, 0.208141274E4, 0.644289068E3 },
+            { 30.0E6, 700.0, NaN, 0.542946619E-2, 0.263149474E7, 0.517540298E4, 0.246861076E7, 0.103505092E5, 0.480386523E3 },
+
+            // Table 33, region 3 (given as temperature and density)
+            { 0.255837018E8, 650.0, NaN, 1.0 / 500.0, 0.186343019E7, 0.405427273E4, 0.181226279E7, 0.138935717E5, 0.502005554E3 },
+            { 0.222930643E8, 650.0, NaN, 1.0 / 200.0, 0.237512401E7, 0.485438792E4, 0.226365868E7, 0.446579342E5, 0.383444594E3 },
+            { 0.783095639E8, 750.0, NaN, 1.0 / 500.0, 0.225868845E7, 0.446971906E4, 0.210206932E7, 0.634165359E4, 0.760696041E3 },
+
+            // Table 42, region 5
+            { 0.5E6, 1500.0, NaN, 0.138455090E1, 0.521976855E7, 0.965408875E4, 0.452749310E7, 0.261609445E4, 0.917068690E3 },
+            { 30.0E6, 1500.0, NaN, 0.230761299E-1, 0.516723514E7, 0.772970133E4, 0.447495124E7, 0.272724317E4, 0.928548002E3 },
+            { 30.0E6, 2000.0, NaN, 0.311385219E-1, 0.657122604E7, 0.853640523E4, 0.563707038E7, 0.288569882E4, 0.106736948E4 },
+
+            // Table 35, saturation pressure
+            { 0.353658941E4, 300.0, 0.0, NaN, NaN, NaN, NaN, NaN, NaN },
+            { 0.263889776E7, 500.0, 0.0, NaN, NaN, NaN, NaN, NaN, NaN },
+            { 0.123443146E8, 600.0, 0.0, NaN, NaN, NaN, NaN, NaN, NaN },
+
+            // Table 36, saturation temperature
+            { 0.1E6, 0.372755919E3, 0.0, NaN, NaN, NaN, NaN, NaN, NaN },
+            { 1.0E6, 0.453035632E3, 0.0, NaN, NaN, NaN, NaN, NaN, NaN },
+            { 10.0E6, 0.584149488E3, 0.0, NaN, NaN, NaN, NaN, NaN, NaN },
+        };
+
+        return states;
+    }
+
+    // A single phase state, evaluated from the basic equations. In region 3, the pressure is adjusted to the basic
+    // equation at the density given by the backward equations.
+    ReferenceData::State singlePhaseState(double pressure, double temperature)
+    {
+        if (IF97::RegionDetermination_TP(temperature, pressure) == IF97::REGION_3) {
+            static const IF97::Region3 region3;
+            const double               density = IF97::rhomass_Tp(temperature, pressure);
+            return { region3.p(temperature, density),
+                     temperature,
+                     NaN,
+                     1.0 / density,
+                     region3.hmass(temperature, density),
+                     region3.smass(temperature, density),
+                     region3.umass(temperature, density),
+                     region3.cpmass(temperature, density),
+                     region3.speed_sound(temperature, density) };
+        }
+
+        return { pressure,
+                 temperature,
+                 NaN,
+                 1.0 / IF97::rhomass_Tp(temperature, pressure),
+                 IF97::hmass_Tp(temperature, pressure),
+                 IF97::smass_Tp(temperature, pressure),
+                 IF97::umass_Tp(temperature, pressure),
+                 IF97::cpmass_Tp(temperature, pressure),
+                 IF97::speed_sound_Tp(temperature, pressure) };
+    }
+
+    // A saturated state, evaluated from the saturation equation and the saturated phase properties of IF97.h. The heat
+    // capacity and speed of sound are only given for the saturated liquid and vapor.
+    ReferenceData::State saturatedState(double pressure, double quality)
+    {
+        const auto mix = [&](double liquid, double vapor) { return (1.0 - quality) * liquid + quality * vapor; };
+
+        ReferenceData::State state { pressure,
+                                     IF97::Tsat97(pressure),
+                                     quality,
+                                     mix(1.0 / IF97::rholiq_p(pressure), 1.0 / IF97::rhovap_p(pressure)),
+                                     mix(IF97::hliq_p(pressure), IF97::hvap_p(pressure)),
+                                     mix(IF97::sliq_p(pressure), IF97::svap_p(pressure)),
+                                     mix(IF97::uliq_p(pressure), IF97::uvap_p(pressure)),
+                                     NaN,
+                                     NaN };
+
+        if (quality == 0.0) {
+            state.Cp = IF97::cpliq_p(pressure);
+            state.W  = IF97::speed_soundliq_p(pressure);
+        }
+        if (quality == 1.0) {
+            state.Cp = IF97::cpvap_p(pressure);
+            state.W  = IF97::speed_soundvap_p(pressure);
+        }
+
+        return state;
+    }
+
+    std::vector<ReferenceData::State> referenceStates()
+    {
+        std::vector<ReferenceData::State> states;
+
+        // Regions 1, 2 and 3. States close to the saturation line are left out, as the phase is ambiguous there.
+        for (int i = 0; i < 26; ++i) {
+            const double pressure = 1.0E3 * std::pow(0.9 * IF97::Pmax / 1.0E3, i / 25.0);
+            for (int j = 0; j < 41; ++j) {
+                const double temperature = 273.16 + j * (IF97::Tmax - 273.16) / 40;
+                if (pressure < IF97::Pcrit && std::abs(temperature - IF97::Tsat97(pressure)) < 0.5) continue;
+                states.push_back(singlePhaseState(pressure, temperature));
+            }
+        }
+
+        // Region 5
+        for (int i = 0; i < 11; ++i) {
+            const double pressure = 1.0E3 * std::pow(IF97::Pext / 1.0E3, i / 10.0);
+            for (int j = 0; j < 8; ++j) states.push_back(singlePhaseState(pressure, IF97::Tmax + (j + 0.5) * (IF97::Text - IF97::Tmax) / 8));
+        }
+
+        // Saturated states
+        for (int i = 0; i < 20; ++i) {
+            const double pressure = 1.0E3 * std::pow(IF97::Pcrit * 0.999 / 1.0E3, i / 19.0);
+            for (double quality : { 0.0, 0.25, 0.5, 0.75, 1.0 }) states.push_back(saturatedState(pressure, quality));
+        }
+
+        return states;
+    }
+
+    // Writes the states in the little endian binary format described in data/ReferenceData.hpp.
+    void writeStates(const std::filesystem::path& path, const std::vector<ReferenceData::State>& states)
+    {
+        static_assert(std::endian::native == std::endian::little, "The reference data is stored in little endian format.");
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file) throw std::runtime_error("Unable to open " + path.string());
+
+        const std::uint32_t fields = ReferenceData::FieldCount;
+        const std::uint32_t count  = static_cast<std::uint32_t>(states.size());
+        file.write(ReferenceData::Magic, sizeof(ReferenceData::Magic));
+        file.write(reinterpret_cast<const char*>(&fields), sizeof(fields));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (const auto& state : states) file.write(reinterpret_cast<const char*>(&state), sizeof(state));
+
+        if (!file) throw std::runtime_error("Unable to write " + path.string());
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    try {
+        const std::filesystem::path directory = argc > 1 ? argv[1] : ".";
+        writeStates(directory / "IF97Verification.bin", verificationStates());
+        writeStates(directory / "IF97Reference.bin", referenceStates());
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
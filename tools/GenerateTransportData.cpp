@@ -0,0 +1,574 @@
+//
+// Generates the coefficient tables in KSteam/impl/TransportData.hpp.
+//
+// The viscosity and the background part of the thermal conductivity are analytic functions of (T, rho) everywhere, so
+// they are interpolated at Chebyshev nodes on a uniform grid of patches in (Tc/T, rho). The critical enhancement of the
+// thermal conductivity depends on the IF97 region equations, and is only defined for valid single phase states. It is
+// therefore fitted separately, by least squares on valid states only, on an adaptive quadtree in (T, rho) that is
+// refined towards the critical point. A fit is only accepted if it meets the tolerance on a dense grid of states
+// between the fitting nodes, including the saturation boundary. Cells that cannot be fitted to the tolerance, and a
+// small box around the critical point, are marked for exact evaluation. Finally, the fit is checked on a dense grid in
+// (P, T) around the critical point, along the saturation line and in region 5 (above the fitted range, where the
+// enhancement is dropped), and no data is written if it fails the check.
+//
+// Usage: GenerateTransportData [output file]
+//
+
+#include <IF97/IF97.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <numbers>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Exposes the background terms of the transport property correlations.
+    struct ExactTransport : IF97::Region1
+    {
+        using Region1::lambda0;
+        using Region1::lambda1;
+    };
+
+    const ExactTransport Exact {};
+
+    // Background grid: patches in tau = Tc/T, a single patch in rho.
+    constexpr double BackgroundTMin      = 273.15;
+    constexpr double BackgroundTMax      = 2273.15;
+    constexpr double BackgroundRhoMax    = 1100.0;
+    constexpr int    BackgroundPatches   = 8;
+    constexpr int    BackgroundTauDegree = 10;
+    constexpr int    BackgroundRhoDegree = 7;
+
+    // Enhancement tree: the fitted quantity is g = ln(1 + r / EnhancementScale), with r = lambda2 / lambda_background.
+    constexpr double EnhancementTMin     = 273.16;
+    constexpr double EnhancementTMax     = 1073.15;
+    constexpr double EnhancementRhoMax   = 1100.0;
+    constexpr double EnhancementScale    = 1.0;
+    constexpr int    EnhancementDegree   = 5;
+    constexpr int    EnhancementMaxDepth = 12;
+    constexpr double EnhancementFitTol   = 5.0E-4;    // Relative to the total thermal conductivity.
+
+    // States in this box are always evaluated exactly.
+    constexpr double CriticalTMin   = 645.096;
+    constexpr double CriticalTMax   = 650.096;
+    constexpr double CriticalRhoMin = 272.0;
+    constexpr double CriticalRhoMax = 362.0;
+
+    constexpr int LeafZero  = -1;
+    constexpr int LeafExact = -2;
+
+    double chebyshev(int order, double x) { return std::cos(order * std::acos(std::clamp(x, -1.0, 1.0))); }
+
+    double mapToUnit(double x, double lower, double upper) { return (2.0 * x - lower - upper) / (upper - lower); }
+
+    // =================================================================================================================
+    // Background terms
+    // =================================================================================================================
+
+    double logViscosity(double tau, double rho) { return std::log(Exact.visc(IF97::Tcrit / tau, rho)); }
+
+    double logConductivity(double tau, double rho)
+    {
+        const double T = IF97::Tcrit / tau;
+        return std::log(Exact.lambda0(T) * Exact.lambda1(T, rho));
+    }
+
+    // Interpolates func at the Chebyshev nodes of the patch, and returns the coefficients in row major order.
+    template<typename FN>
+    std::vector<double> interpolate(FN func, double x0, double x1, double y0, double y1, int nx, int ny)
+    {
+        std::vector<double> values((nx + 1) * (ny + 1));
+        for (int a = 0; a <= nx; ++a)
+            for (int b = 0; b <= ny; ++b) {
+                const double u = std::cos(std::numbers::pi * (a + 0.5) / (nx + 1));
+                const double v = std::cos(std::numbers::pi * (b + 0.5) / (ny + 1));
+                values[a * (ny + 1) + b] = func(x0 + (u + 1.0) / 2.0 * (x1 - x0), y0 + (v + 1.0) / 2.0 * (y1 - y0));
+            }
+
+        std::vector<double> coeffs((nx + 1) * (ny + 1));
+        for (int i = 0; i <= nx; ++i)
+            for (int j = 0; j <= ny; ++j) {
+                double sum = 0.0;
+                for (int a = 0; a <= nx; ++a)
+                    for (int b = 0; b <= ny; ++b)
+                        sum += values[a * (ny + 1) + b] * std::cos(std::numbers::pi * i * (a + 0.5) / (nx + 1)) *
+                               std::cos(std::numbers::pi * j * (b + 0.5) / (ny + 1));
+                coeffs[i * (ny + 1) + j] = sum * (i == 0 ? 1.0 : 2.0) / (nx + 1) * (j == 0 ? 1.0 : 2.0) / (ny + 1);
+            }
+
+        return coeffs;
+    }
+
+    double evaluate(const std::vector<double>& coeffs, int offset, int nx, int ny, double u, double v)
+    {
+        double sum = 0.0;
+        for (int i = 0; i <= nx; ++i)
+            for (int j = 0; j <= ny; ++j) sum += coeffs[offset + i * (ny + 1) + j] * chebyshev(i, u) * chebyshev(j, v);
+        return sum;
+    }
+
+    template<typename FN>
+    std::vector<double> fitBackground(FN func)
+    {
+        const double tauMin = IF97::Tcrit / BackgroundTMax;
+        const double tauMax = IF97::Tcrit / BackgroundTMin;
+
+        std::vector<double> coeffs;
+        for (int k = 0; k < BackgroundPatches; ++k) {
+            const double tau0  = tauMin + (tauMax - tauMin) * k / BackgroundPatches;
+            const double tau1  = tauMin + (tauMax - tauMin) * (k + 1) / BackgroundPatches;
+            const auto   patch = interpolate(func, tau0, tau1, 0.0, BackgroundRhoMax, BackgroundTauDegree, BackgroundRhoDegree);
+            coeffs.insert(coeffs.end(), patch.begin(), patch.end());
+        }
+
+        // Report the interpolation error on a dense grid.
+        double maxError = 0.0;
+        for (int a = 0; a <= 2000; ++a)
+            for (int b = 0; b <= 200; ++b) {
+                const double tau   = tauMin + (tauMax - tauMin) * a / 2000;
+                const double rho   = BackgroundRhoMax * b / 200;
+                const int    k     = std::min(BackgroundPatches - 1, static_cast<int>((tau - tauMin) / (tauMax - tauMin) * BackgroundPatches));
+                const double tau0  = tauMin + (tauMax - tauMin) * k / BackgroundPatches;
+                const double tau1  = tauMin + (tauMax - tauMin) * (k + 1) / BackgroundPatches;
+                const double value = evaluate(coeffs,
+                                              k * (BackgroundTauDegree + 1) * (BackgroundRhoDegree + 1),
+                                              BackgroundTauDegree,
+                                              BackgroundRhoDegree,
+                                              mapToUnit(tau, tau0, tau1),
+                                              mapToUnit(rho, 0.0, BackgroundRhoMax));
+                maxError           = std::max(maxError, std::abs(std::expm1(value - func(tau, rho))));
+            }
+        std::cerr << "  max relative error: " << maxError << std::endl;
+
+        return coeffs;
+    }
+
+    // =================================================================================================================
+    // Critical enhancement
+    // =================================================================================================================
+
+    struct Sample
+    {
+        double T, rho;
+        double total;         // Total thermal conductivity, dimensionless
+        double background;    // lambda0 * lambda1
+        double target;        // g = ln(1 + r / EnhancementScale)
+        double weight;        // d(lambda)/dg relative to lambda, used to weight the least squares fit
+    };
+
+    Sample makeSample(double T, double rho, double conductivity)
+    {
+        const double total      = conductivity / 1.0E-3;
+        const double background = Exact.lambda0(T) * Exact.lambda1(T, rho);
+        const double ratio      = std::max((total - background) / background, 0.0);
+
+        return { T, rho, total, background, std::log1p(ratio / EnhancementScale), (EnhancementScale + ratio) * background / total };
+    }
+
+    bool inCriticalBox(double T, double rho) { return T >= CriticalTMin && T <= CriticalTMax && rho >= CriticalRhoMin && rho <= CriticalRhoMax; }
+
+    // Finds the valid single phase (or saturated) state with the given temperature and density, if it exists.
+    std::optional<Sample> sampleState(double T, double rho)
+    {
+        if (T < EnhancementTMin || T > EnhancementTMax || rho <= 0.0 || inCriticalBox(T, rho)) return std::nullopt;
+
+        try {
+            double pLower = 1.0E-6;
+            double pUpper = IF97::Pmax;
+
+            if (T < IF97::Tcrit) {
+                const double psat   = IF97::psat97(T);
+                const double rhoVap = IF97::rhovap_p(psat);
+                const double rhoLiq = IF97::rholiq_p(psat);
+                if (rho == rhoVap) return makeSample(T, rho, IF97::tcondvap_p(psat));
+                if (rho == rhoLiq) return makeSample(T, rho, IF97::tcondliq_p(psat));
+                if (rho > rhoVap && rho < rhoLiq) return std::nullopt;
+                if (rho < rhoVap)
+                    pUpper = psat * (1.0 - 1.0E-12);
+                else
+                    pLower = psat * (1.0 + 1.0E-12);
+            }
+
+            if (IF97::rhomass_Tp(T, pUpper) < rho) return std::nullopt;
+
+            // The density is monotonic in pressure along an isotherm within a phase.
+            double lower = std::log(pLower);
+            double upper = std::log(pUpper);
+            while (upper - lower > 1.0E-14) {
+                const double mid = 0.5 * (lower + upper);
+                if (IF97::rhomass_Tp(T, std::exp(mid)) < rho)
+                    lower = mid;
+                else
+                    upper = mid;
+            }
+
+            const double p = std::exp(0.5 * (lower + upper));
+            return makeSample(T, IF97::rhomass_Tp(T, p), IF97::tcond_Tp(T, p));
+        }
+        catch (...) {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<Sample> collectSamples(double T0, double T1, double rho0, double rho1, int count, bool interior)
+    {
+        std::vector<Sample> samples;
+        for (int a = 0; a < count; ++a) {
+            const double u = interior ? std::cos(std::numbers::pi * (a + 0.5) / count) : std::cos(std::numbers::pi * a / (count - 1));
+            const double T = T0 + (u + 1.0) / 2.0 * (T1 - T0);
+
+            for (int b = 0; b < count; ++b) {
+                const double v = interior ? std::cos(std::numbers::pi * (b + 0.5) / count) : std::cos(std::numbers::pi * b / (count - 1));
+                if (auto sample = sampleState(T, rho0 + (v + 1.0) / 2.0 * (rho1 - rho0))) samples.push_back(*sample);
+            }
+
+            // Include the saturation boundary, as saturated states are evaluated as well.
+            if (T < IF97::Tcrit) {
+                const double psat = IF97::psat97(T);
+                for (double rho : { IF97::rhovap_p(psat), IF97::rholiq_p(psat) })
+                    if (rho >= rho0 && rho <= rho1)
+                        if (auto sample = sampleState(T, rho)) samples.push_back(*sample);
+            }
+        }
+
+        return samples;
+    }
+
+    // Samples the cell densely between the fitting and validation nodes, on a uniform grid in (T, rho) and along the
+    // saturation boundary. The fit is only accepted if it meets the tolerance on these states as well.
+    std::vector<Sample> denseSamples(double T0, double T1, double rho0, double rho1, int count)
+    {
+        std::vector<Sample> samples;
+        for (int a = 0; a < count; ++a) {
+            const double T = T0 + (a + 0.5) / count * (T1 - T0);
+            for (int b = 0; b < count; ++b)
+                if (auto sample = sampleState(T, rho0 + (b + 0.5) / count * (rho1 - rho0))) samples.push_back(*sample);
+        }
+
+        // The saturated densities change rapidly close to the critical point, so the boundary is sampled more densely.
+        for (int a = 0; a <= 4 * count; ++a) {
+            const double T = T0 + static_cast<double>(a) / (4 * count) * (T1 - T0);
+            if (T >= IF97::Tcrit) break;
+            const double psat = IF97::psat97(T);
+            for (double rho : { IF97::rhovap_p(psat), IF97::rholiq_p(psat) })
+                if (rho >= rho0 && rho <= rho1)
+                    if (auto sample = sampleState(T, rho)) samples.push_back(*sample);
+        }
+
+        return samples;
+    }
+
+    // Solves the weighted least squares problem for the Chebyshev coefficients, using Householder QR.
+    std::vector<double> leastSquares(const std::vector<Sample>& samples, double T0, double T1, double rho0, double rho1)
+    {
+        const int cols = (EnhancementDegree + 1) * (EnhancementDegree + 1);
+        const int rows = static_cast<int>(samples.size());
+
+        std::vector<double> A(rows * cols);
+        std::vector<double> y(rows);
+        for (int k = 0; k < rows; ++k) {
+            const double u = mapToUnit(samples[k].T, T0, T1);
+            const double v = mapToUnit(samples[k].rho, rho0, rho1);
+            for (int i = 0; i <= EnhancementDegree; ++i)
+                for (int j = 0; j <= EnhancementDegree; ++j)
+                    A[k * cols + i * (EnhancementDegree + 1) + j] = samples[k].weight * chebyshev(i, u) * chebyshev(j, v);
+            y[k] = samples[k].weight * samples[k].target;
+        }
+
+        std::vector<double> diagonal(cols);
+        for (int j = 0; j < cols; ++j) {
+            double norm = 0.0;
+            for (int k = j; k < rows; ++k) norm += A[k * cols + j] * A[k * cols + j];
+            norm = std::sqrt(norm);
+            if (norm == 0.0) continue;
+
+            const double alpha = A[j * cols + j] > 0.0 ? -norm : norm;
+            A[j * cols + j] -= alpha;
+            double vnorm = 0.0;
+            for (int k = j; k < rows; ++k) vnorm += A[k * cols + j] * A[k * cols + j];
+
+            for (int c = j + 1; c < cols; ++c) {
+                double dot = 0.0;
+                for (int k = j; k < rows; ++k) dot += A[k * cols + j] * A[k * cols + c];
+                for (int k = j; k < rows; ++k) A[k * cols + c] -= 2.0 * dot / vnorm * A[k * cols + j];
+            }
+            double dot = 0.0;
+            for (int k = j; k < rows; ++k) dot += A[k * cols + j] * y[k];
+            for (int k = j; k < rows; ++k) y[k] -= 2.0 * dot / vnorm * A[k * cols + j];
+
+            diagonal[j] = alpha;
+        }
+
+        // Back substitution, dropping directions that are not resolved by the samples.
+        const double scale = std::abs(*std::max_element(diagonal.begin(), diagonal.end(), [](double a, double b) { return std::abs(a) < std::abs(b); }));
+        std::vector<double> coeffs(cols);
+        for (int j = cols - 1; j >= 0; --j) {
+            double sum = y[j];
+            for (int c = j + 1; c < cols; ++c) sum -= A[j * cols + c] * coeffs[c];
+            coeffs[j] = std::abs(diagonal[j]) > 1.0E-10 * scale ? sum / diagonal[j] : 0.0;
+        }
+
+        return coeffs;
+    }
+
+    struct Node
+    {
+        double splitT   = 0.0;
+        double splitRho = 0.0;
+        int    child    = -1;
+        int    patch    = LeafZero;
+    };
+
+    struct EnhancementTree
+    {
+        std::vector<Node>   nodes;
+        std::vector<double> coeffs;
+        double              maxError = 0.0;
+        int                 exact    = 0;
+    };
+
+    void buildNode(EnhancementTree& tree, int index, double T0, double T1, double rho0, double rho1, int depth, std::optional<std::pair<double, double>> split = {})
+    {
+        const int  count    = 2 * (EnhancementDegree + 1);
+        const auto samples  = collectSamples(T0, T1, rho0, rho1, count, false);
+        const auto validate = collectSamples(T0, T1, rho0, rho1, count + 1, true);
+        const auto dense    = denseSamples(T0, T1, rho0, rho1, 4 * count);
+
+        const auto error = [&](const std::vector<double>& coeffs, const Sample& s) {
+            const double g = evaluate(coeffs, 0, EnhancementDegree, EnhancementDegree, mapToUnit(s.T, T0, T1), mapToUnit(s.rho, rho0, rho1));
+            return std::abs(s.background * (1.0 + EnhancementScale * std::expm1(g)) - s.total) / s.total;
+        };
+
+        if (!split) {
+            // Cells without states, or with a negligible enhancement, need no coefficients.
+            const auto negligible = [](const Sample& s) { return s.total - s.background <= EnhancementFitTol * s.total; };
+            if (std::all_of(samples.begin(), samples.end(), negligible) && std::all_of(validate.begin(), validate.end(), negligible) &&
+                std::all_of(dense.begin(), dense.end(), negligible)) {
+                tree.nodes[index].patch = LeafZero;
+                return;
+            }
+
+            if (static_cast<int>(samples.size()) >= (EnhancementDegree + 1) * (EnhancementDegree + 1)) {
+                const auto coeffs   = leastSquares(samples, T0, T1, rho0, rho1);
+                double     maxError = 0.0;
+                for (const auto* set : { &samples, &validate, &dense })
+                    for (const auto& s : *set) maxError = std::max(maxError, error(coeffs, s));
+
+                if (maxError <= EnhancementFitTol) {
+                    tree.nodes[index].patch = static_cast<int>(tree.coeffs.size() / coeffs.size());
+                    tree.coeffs.insert(tree.coeffs.end(), coeffs.begin(), coeffs.end());
+                    tree.maxError = std::max(tree.maxError, maxError);
+                    return;
+                }
+            }
+
+            if (depth == EnhancementMaxDepth) {
+                tree.nodes[index].patch = LeafExact;
+                ++tree.exact;
+                return;
+            }
+        }
+
+        const double splitT   = split ? split->first : 0.5 * (T0 + T1);
+        const double splitRho = split ? split->second : 0.5 * (rho0 + rho1);
+        const int    child    = static_cast<int>(tree.nodes.size());
+        tree.nodes[index]     = { splitT, splitRho, child, LeafZero };
+        tree.nodes.resize(tree.nodes.size() + 4);
+
+        buildNode(tree, child + 0, T0, splitT, rho0, splitRho, depth + 1);
+        buildNode(tree, child + 1, splitT, T1, rho0, splitRho, depth + 1);
+        buildNode(tree, child + 2, T0, splitT, splitRho, rho1, depth + 1);
+        buildNode(tree, child + 3, splitT, T1, splitRho, rho1, depth + 1);
+    }
+
+    EnhancementTree fitEnhancement()
+    {
+        // The root is split at the critical point, so no cell straddles the critical isotherm or isochore.
+        EnhancementTree tree;
+        tree.nodes.resize(1);
+        buildNode(tree, 0, EnhancementTMin, EnhancementTMax, 0.0, EnhancementRhoMax, 0, std::pair { IF97::Tcrit, IF97::Rhocrit });
+
+        std::cerr << "  nodes: " << tree.nodes.size() << ", patches: " << tree.coeffs.size() / ((EnhancementDegree + 1) * (EnhancementDegree + 1))
+                  << ", exact cells: " << tree.exact << ", max relative error: " << tree.maxError << std::endl;
+        return tree;
+    }
+
+    // Evaluates the fitted thermal conductivity at the state, or returns std::nullopt if the state is evaluated exactly.
+    std::optional<double> evaluateEnhancement(const EnhancementTree& tree, double T, double rho)
+    {
+        // Above the fitted range (region 5), the enhancement is dropped, as in enhancementSurrogate.
+        if (T > EnhancementTMax) return 1.0E-3 * Exact.lambda0(T) * Exact.lambda1(T, rho);
+        if (T < EnhancementTMin || inCriticalBox(T, rho)) return std::nullopt;
+
+        double T0 = EnhancementTMin, T1 = EnhancementTMax, rho0 = 0.0, rho1 = EnhancementRhoMax;
+        int    index = 0;
+        while (tree.nodes[index].child >= 0) {
+            const auto& node     = tree.nodes[index];
+            const bool  upperT   = T >= node.splitT;
+            const bool  upperRho = rho >= node.splitRho;
+            (upperT ? T0 : T1)       = node.splitT;
+            (upperRho ? rho0 : rho1) = node.splitRho;
+            index                    = node.child + static_cast<int>(upperT) + 2 * static_cast<int>(upperRho);
+        }
+
+        const double background = 1.0E-3 * Exact.lambda0(T) * Exact.lambda1(T, rho);
+        const int    patch      = tree.nodes[index].patch;
+        if (patch == LeafZero) return background;
+        if (patch == LeafExact) return std::nullopt;
+
+        const int    size = (EnhancementDegree + 1) * (EnhancementDegree + 1);
+        const double g    = evaluate(tree.coeffs, patch * size, EnhancementDegree, EnhancementDegree, mapToUnit(T, T0, T1), mapToUnit(rho, rho0, rho1));
+        return background * (1.0 + EnhancementScale * std::max(std::expm1(g), 0.0));
+    }
+
+    // Checks the fitted thermal conductivity against the exact values, independently of the cells of the tree: on a
+    // dense grid in (P, T) around the critical point, along the saturation line, and in region 5, where the enhancement
+    // is dropped. Returns the maximum relative error.
+    double checkEnhancement(const EnhancementTree& tree)
+    {
+        double     maxError = 0.0;
+        const auto check    = [&](double T, double rho, double exact) {
+            if (const auto value = evaluateEnhancement(tree, T, rho)) maxError = std::max(maxError, std::abs(*value - exact) / exact);
+        };
+
+        for (int a = 0; a <= 1000; ++a) {
+            const double T = 600.0 + 0.1 * a + 0.0123;
+            for (int b = 0; b <= 500; ++b) {
+                const double p = 15.0E6 + 0.05E6 * b + 1234.5;
+                if (T < IF97::Tcrit && std::abs(p - IF97::psat97(T)) < 1.0) continue;
+                check(T, IF97::rhomass_Tp(T, p), IF97::tcond_Tp(T, p));
+            }
+        }
+
+        for (double p = 1.0E3; p < IF97::Pcrit; p *= 1.0005) {
+            const double T = IF97::Tsat97(p);
+            check(T, IF97::rholiq_p(p), IF97::tcondliq_p(p));
+            check(T, IF97::rhovap_p(p), IF97::tcondvap_p(p));
+        }
+
+        // Region 5, where the enhancement is dropped, up to its maximum pressure
+        for (double T = EnhancementTMax; T <= IF97::Text; T += 5.0) {
+            for (double p = 1.0E3; p <= IF97::Pext; p *= 1.05) check(T, IF97::rhomass_Tp(T, p), IF97::tcond_Tp(T, p));
+        }
+
+        return maxError;
+    }
+
+    // =================================================================================================================
+    // Output
+    // =================================================================================================================
+
+    std::string format(double value)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+        return buffer;
+    }
+
+    void writeArray(std::ostream& out, const char* name, const std::vector<double>& values)
+    {
+        out << "    constexpr std::array<FLOAT, " << values.size() << "> " << name << " {\n";
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i % 4 == 0) out << "        ";
+            out << format(values[i]) << (i + 1 < values.size() ? "," : "") << ((i % 4 == 3 || i + 1 == values.size()) ? "\n" : " ");
+        }
+        out << "    };\n\n";
+    }
+
+    std::string generate()
+    {
+        std::cerr << "Fitting viscosity..." << std::endl;
+        const auto viscosity = fitBackground(logViscosity);
+        std::cerr << "Fitting background thermal conductivity..." << std::endl;
+        const auto conductivity = fitBackground(logConductivity);
+        std::cerr << "Fitting critical enhancement..." << std::endl;
+        const auto enhancement = fitEnhancement();
+        const auto checkError  = checkEnhancement(enhancement);
+        std::cerr << "  max relative error on the check grid: " << checkError << std::endl;
+        if (checkError > 2.0 * EnhancementFitTol) throw std::runtime_error("The critical enhancement does not meet the tolerance.");
+
+        std::ostringstream out;
+        out << "//\n"
+               "// Generated by tools/GenerateTransportData.cpp. Do not edit.\n"
+               "//\n\n"
+               "#ifndef KSTEAM_TRANSPORTDATA_HPP\n"
+               "#define KSTEAM_TRANSPORTDATA_HPP\n\n"
+               "#include \"Config.hpp\"\n\n"
+               "#include <array>\n\n"
+               "namespace KSteam::impl::TransportData\n"
+               "{\n";
+
+        out << "    constexpr FLOAT BackgroundTMin      = " << BackgroundTMin << ";\n"
+            << "    constexpr FLOAT BackgroundTMax      = " << BackgroundTMax << ";\n"
+            << "    constexpr FLOAT BackgroundRhoMax    = " << BackgroundRhoMax << ";\n"
+            << "    constexpr FLOAT BackgroundTauMin    = " << format(IF97::Tcrit / BackgroundTMax) << ";\n"
+            << "    constexpr FLOAT BackgroundTauMax    = " << format(IF97::Tcrit / BackgroundTMin) << ";\n"
+            << "    constexpr int   BackgroundPatches   = " << BackgroundPatches << ";\n"
+            << "    constexpr int   BackgroundTauDegree = " << BackgroundTauDegree << ";\n"
+            << "    constexpr int   BackgroundRhoDegree = " << BackgroundRhoDegree << ";\n\n";
+        writeArray(out, "Viscosity", viscosity);
+        writeArray(out, "Conductivity", conductivity);
+
+        out << "    constexpr FLOAT EnhancementTMin   = " << EnhancementTMin << ";\n"
+            << "    constexpr FLOAT EnhancementTMax   = " << EnhancementTMax << ";\n"
+            << "    constexpr FLOAT EnhancementRhoMax = " << EnhancementRhoMax << ";\n"
+            << "    constexpr FLOAT EnhancementScale  = " << EnhancementScale << ";\n"
+            << "    constexpr int   EnhancementDegree = " << EnhancementDegree << ";\n\n"
+            << "    constexpr FLOAT CriticalTMin   = " << CriticalTMin << ";\n"
+            << "    constexpr FLOAT CriticalTMax   = " << CriticalTMax << ";\n"
+            << "    constexpr FLOAT CriticalRhoMin = " << CriticalRhoMin << ";\n"
+            << "    constexpr FLOAT CriticalRhoMax = " << CriticalRhoMax << ";\n\n"
+            << "    constexpr int LeafZero  = " << LeafZero << ";\n"
+            << "    constexpr int LeafExact = " << LeafExact << ";\n\n"
+            << "    struct Node\n"
+            << "    {\n"
+            << "        FLOAT splitT;\n"
+            << "        FLOAT splitRho;\n"
+            << "        int   child;\n"
+            << "        int   patch;\n"
+            << "    };\n\n";
+
+        out << "    constexpr std::array<Node, " << enhancement.nodes.size() << "> EnhancementTree { {\n";
+        char buffer[128];
+        for (const auto& node : enhancement.nodes) {
+            std::snprintf(buffer, sizeof(buffer), "        { %.17g, %.17g, %d, %d },\n", node.splitT, node.splitRho, node.child, node.patch);
+            out << buffer;
+        }
+        out << "    } };\n\n";
+        writeArray(out, "Enhancement", enhancement.coeffs);
+
+        out << "}    // namespace KSteam::impl::TransportData\n\n"
+               "#endif    // KSTEAM_TRANSPORTDATA_HPP\n";
+
+        return out.str();
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string data;
+    try {
+        data = generate();
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    if (argc > 1) {
+        std::ofstream file(argv[1]);
+        file << data;
+    }
+    else
+        std::cout << data;
+
+    return 0;
+}
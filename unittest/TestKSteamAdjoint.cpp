@@ -0,0 +1,135 @@
+//
+// Tests for the reverse mode (adjoint) sensitivities of batches of flash calculations.
+//
+
+#include "TestXLSteamCommon.hpp"
+
+#include <vector>
+
+TEST_CASE("KSteam Adjoint Sensitivities")
+{
+    using KSteam::Property;
+
+    std::vector<double> pressure { 1.0E5, 1.0E6, 5.0E6, 3.0E7 };
+    std::vector<double> temperature { 300.0, 500.0, 800.0, 700.0 };
+    std::vector<double> weights { 1.0, -2.0, 0.5 };
+
+    SECTION("Adjoints match repeated flash calculations")
+    {
+        // The single phase states, and a two-phase state
+        std::vector<double> specPressure = pressure;
+        std::vector<double> enthalpy;
+        for (size_t i = 0; i < pressure.size(); ++i) enthalpy.push_back(KSteam::calcPropertyPT(pressure[i], temperature[i], "H"));
+        specPressure.push_back(1.0E6);
+        enthalpy.push_back(KSteam::calcPropertyPX(1.0E6, 0.5, "H"));
+
+        std::vector<Property> props { Property::Temperature, Property::Entropy, Property::Density };
+        std::vector<double>   results(specPressure.size() * props.size());
+
+        KSteam::FlashTape tape;
+        auto              batch = tape.record(Property::Pressure, Property::Enthalpy, specPressure, enthalpy, props, results);
+
+        // Objective: sum of the weighted properties over all points
+        auto seed = tape.outputAdjoints(batch);
+        for (size_t i = 0; i < seed.size(); ++i) seed[i] = weights[i % props.size()];
+        tape.backward();
+
+        auto objective = [&](double p, double h) {
+            auto   state = KSteam::impl::flash(Property::Pressure, p, Property::Enthalpy, h);
+            double value = 0.0;
+            for (size_t k = 0; k < props.size(); ++k) value += weights[k] * state.property(props[k]);
+            return value;
+        };
+
+        auto adjoints = tape.inputAdjoints(batch);
+        for (size_t i = 0; i < specPressure.size(); ++i) {
+            INFO("P = " << specPressure[i] << ", H = " << enthalpy[i]);
+            CHECK_THAT(results[i * 3], Catch::Matchers::WithinRel(KSteam::calcPropertyPH(specPressure[i], enthalpy[i], "T"), 1.0E-12));
+
+            auto hp = 1.0E-4 * specPressure[i];
+            auto hh = 1.0E-4 * enthalpy[i];
+            auto dp = (objective(specPressure[i] + hp, enthalpy[i]) - objective(specPressure[i] - hp, enthalpy[i])) / (2.0 * hp);
+            auto dh = (objective(specPressure[i], enthalpy[i] + hh) - objective(specPressure[i], enthalpy[i] - hh)) / (2.0 * hh);
+            CHECK_THAT(adjoints[i * 2], Catch::Matchers::WithinRel(dp, 0.01) || Catch::Matchers::WithinAbs(dp, 1.0E-9));
+            CHECK_THAT(adjoints[i * 2 + 1], Catch::Matchers::WithinRel(dh, 0.01) || Catch::Matchers::WithinAbs(dh, 1.0E-9));
+        }
+    }
+
+    SECTION("Adjoints propagate through connected batches")
+    {
+        // Batch 1 computes the enthalpy from pressure and temperature; batch 2 flashes at a lower pressure and the
+        // same enthalpy (a throttle), and the objective is the weighted sum of the resulting entropy and temperature.
+        std::vector<double> outletPressure;
+        for (auto p : pressure) outletPressure.push_back(0.5 * p);
+
+        std::vector<Property> props1 { Property::Enthalpy };
+        std::vector<Property> props2 { Property::Entropy, Property::Temperature };
+        std::vector<double>   enthalpy(pressure.size());
+        std::vector<double>   results(pressure.size() * props2.size());
+
+        KSteam::FlashTape tape;
+        auto              inlet  = tape.record(Property::Pressure, Property::Temperature, pressure, temperature, props1, enthalpy);
+        auto              outlet = tape.record(Property::Pressure, Property::Enthalpy, outletPressure, enthalpy, props2, results);
+        tape.connect(inlet, 0, outlet, 1);
+        REQUIRE(tape.size() == 2);
+
+        auto seed = tape.outputAdjoints(outlet);
+        for (size_t i = 0; i < pressure.size(); ++i) {
+            seed[i * 2]     = weights[0];
+            seed[i * 2 + 1] = weights[1];
+        }
+        tape.backward();
+
+        auto objective = [&](double t, double p) {
+            auto h     = KSteam::calcPropertyPT(p, t, "H");
+            auto state = KSteam::impl::flash(Property::Pressure, 0.5 * p, Property::Enthalpy, h);
+            return weights[0] * state.property(Property::Entropy) + weights[1] * state.property(Property::Temperature);
+        };
+
+        auto inletAdjoints  = tape.inputAdjoints(inlet);
+        auto outletAdjoints = tape.inputAdjoints(outlet);
+        for (size_t i = 0; i < pressure.size(); ++i) {
+            INFO("P = " << pressure[i] << ", T = " << temperature[i]);
+
+            auto ht = 1.0E-4 * temperature[i];
+            auto hp = 1.0E-4 * pressure[i];
+            auto dt = (objective(temperature[i] + ht, pressure[i]) - objective(temperature[i] - ht, pressure[i])) / (2.0 * ht);
+            auto dp = (objective(temperature[i], pressure[i] + hp) - objective(temperature[i], pressure[i] - hp)) / (2.0 * hp);
+
+            // The pressure enters both batches directly; its total adjoint is the sum of the contributions
+            CHECK_THAT(inletAdjoints[i * 2 + 1], Catch::Matchers::WithinRel(dt, 0.01));
+            CHECK_THAT(inletAdjoints[i * 2] + 0.5 * outletAdjoints[i * 2], Catch::Matchers::WithinRel(dp, 0.01) || Catch::Matchers::WithinAbs(dp, 1.0E-9));
+        }
+
+        // A second sweep with the same seed gives the same result
+        std::vector<double> first(inletAdjoints.begin(), inletAdjoints.end());
+        tape.zeroAdjoints();
+        CHECK(tape.outputAdjoints(inlet)[0] == 0.0);
+
+        seed = tape.outputAdjoints(outlet);
+        for (size_t i = 0; i < pressure.size(); ++i) {
+            seed[i * 2]     = weights[0];
+            seed[i * 2 + 1] = weights[1];
+        }
+        tape.backward();
+        for (size_t i = 0; i < first.size(); ++i) CHECK(tape.inputAdjoints(inlet)[i] == first[i]);
+    }
+
+    SECTION("Invalid input is rejected")
+    {
+        std::vector<Property> props { Property::Enthalpy };
+        std::vector<double>   results(pressure.size());
+        std::vector<double>   tooSmall(1);
+
+        KSteam::FlashTape tape;
+        CHECK_THROWS(tape.record(Property::Pressure, Property::Temperature, pressure, tooSmall, props, results));
+        CHECK_THROWS(tape.record(Property::Pressure, Property::Temperature, pressure, temperature, props, tooSmall));
+
+        auto batch = tape.record(Property::Pressure, Property::Temperature, pressure, temperature, props, results);
+        CHECK_THROWS(tape.connect(batch, 0, batch, 1));
+        CHECK_THROWS(tape.outputAdjoints(batch + 1));
+
+        tape.clear();
+        CHECK(tape.size() == 0);
+    }
+}
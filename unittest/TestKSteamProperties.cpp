@@ -0,0 +1,110 @@
+//
+// Tests for the multi-output calcProperties* functions, against the single property calcProperty* functions.
+//
+
+#include "TestXLSteamCommon.hpp"
+
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace
+{
+    using PropertyFn   = std::function<double(const Properties&, KSteam::Property)>;
+    using PropertiesFn = std::function<void(const Properties&, std::span<const KSteam::Property>, std::span<double>)>;
+
+    // A flash specification, with the single and multi-output functions evaluated at the specification values of a state.
+    struct SpecPair
+    {
+        const char*  name;
+        bool         singlePhase; /*< Whether the specification is valid for single phase states. */
+        bool         saturated;   /*< Whether the specification is valid for saturated states. */
+        PropertyFn   single;
+        PropertiesFn multiple;
+    };
+
+    // clang-format off
+    const std::vector<SpecPair> Specs {
+        { "PT", true, false,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPT(std::get<P>(s), std::get<T>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPT(std::get<P>(s), std::get<T>(s), props, results); } },
+        { "PX", false, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPX(std::get<P>(s), std::get<X>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPX(std::get<P>(s), std::get<X>(s), props, results); } },
+        { "PH", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPH(std::get<P>(s), std::get<H>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPH(std::get<P>(s), std::get<H>(s), props, results); } },
+        { "PS", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPS(std::get<P>(s), std::get<S>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPS(std::get<P>(s), std::get<S>(s), props, results); } },
+        { "PU", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPU(std::get<P>(s), std::get<U>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPU(std::get<P>(s), std::get<U>(s), props, results); } },
+        { "PRHO", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPRHO(std::get<P>(s), std::get<RHO>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPRHO(std::get<P>(s), std::get<RHO>(s), props, results); } },
+        { "PV", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyPV(std::get<P>(s), std::get<V>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesPV(std::get<P>(s), std::get<V>(s), props, results); } },
+        { "TX", false, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyTX(std::get<T>(s), std::get<X>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesTX(std::get<T>(s), std::get<X>(s), props, results); } },
+        { "TRHO", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyTRHO(std::get<T>(s), std::get<RHO>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesTRHO(std::get<T>(s), std::get<RHO>(s), props, results); } },
+        { "TV", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyTV(std::get<T>(s), std::get<V>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesTV(std::get<T>(s), std::get<V>(s), props, results); } },
+        { "TH", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyTH(std::get<T>(s), std::get<H>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesTH(std::get<T>(s), std::get<H>(s), props, results); } },
+        { "TS", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyTS(std::get<T>(s), std::get<S>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesTS(std::get<T>(s), std::get<S>(s), props, results); } },
+        { "TU", true, true,
+          [](const Properties& s, KSteam::Property p) { return KSteam::calcPropertyTU(std::get<T>(s), std::get<U>(s), p); },
+          [](const Properties& s, auto props, auto results) { KSteam::calcPropertiesTU(std::get<T>(s), std::get<U>(s), props, results); } },
+    };
+    // clang-format on
+}    // namespace
+
+TEST_CASE("KSteam calcProperties Functions")
+{
+    // Liquid, vapor and supercritical states, and two-phase states
+    std::vector<std::pair<Properties, bool>> states { { computePropsPT(1.0E5, 300.0), false }, { computePropsPT(1.0E6, 500.0), false },
+                                                      { computePropsPT(1.0E4, 800.0), false }, { computePropsPT(3.0E7, 700.0), false },
+                                                      { computePropsPX(1.0E6, 0.5), true },    { computePropsPX(1.0E5, 0.2), true },
+                                                      { computePropsPX(1.0E7, 0.9), true } };
+
+    std::vector<KSteam::Property> props(PropertyList.begin(), PropertyList.end());
+
+    SECTION("All properties match the single property functions")
+    {
+        for (const auto& spec : Specs) {
+            for (const auto& [state, saturated] : states) {
+                if (saturated ? !spec.saturated : !spec.singlePhase) continue;
+                INFO(spec.name << ": P = " << std::get<P>(state) << ", T = " << std::get<T>(state) << ", X = " << std::get<X>(state));
+
+                std::vector<double> results(props.size());
+                spec.multiple(state, props, results);
+                for (size_t i = 0; i < props.size(); ++i) {
+                    INFO("Property: " << props[i].asString());
+                    CHECK_THAT(results[i], Catch::Matchers::WithinRel(spec.single(state, props[i]), 1.0E-12));
+                }
+            }
+        }
+    }
+
+    SECTION("Mismatched output sizes are rejected")
+    {
+        for (const auto& spec : Specs) {
+            INFO(spec.name);
+            const auto& state = spec.singlePhase ? states[1].first : states[4].first;
+
+            std::vector<double> tooSmall(props.size() - 1);
+            std::vector<double> tooLarge(props.size() + 1);
+            CHECK_THROWS_AS(spec.multiple(state, props, tooSmall), KSteam::KSteamError);
+            CHECK_THROWS_AS(spec.multiple(state, props, tooLarge), KSteam::KSteamError);
+        }
+    }
+}
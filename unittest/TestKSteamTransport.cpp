@@ -0,0 +1,174 @@
+//
+// Tests for the surrogate models of the transport properties.
+//
+
+#include "TestXLSteamCommon.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST_CASE("KSteam Transport Surrogates")
+{
+    using KSteam::Accuracy;
+    using KSteam::Property;
+
+    SECTION("Viscosity surrogate matches the IF97 correlation")
+    {
+        for (double temperature = 273.15; temperature <= 2273.15; temperature += 25.0) {
+            for (double density = 0.01; density <= 1100.0; density += 25.0) {
+                INFO("T = " << temperature << ", RHO = " << density);
+                auto viscosity = KSteam::impl::viscositySurrogate(temperature, density);
+                REQUIRE(viscosity.has_value());
+                CHECK_THAT(*viscosity, Catch::Matchers::WithinRel(IF97::visc_TRho(temperature, density), 1.0E-8));
+            }
+        }
+    }
+
+    SECTION("Fast transport properties match the exact values for single phase states")
+    {
+        std::mt19937                     gen(42);
+        std::uniform_real_distribution<> distP(std::log(1.0E3), std::log(1.0E8));
+        std::uniform_real_distribution<> distT(273.16, 1073.15);
+
+        for (int i = 0; i < 20000; ++i) {
+            double pressure    = std::exp(distP(gen));
+            double temperature = distT(gen);
+            INFO("P = " << pressure << ", T = " << temperature);
+
+            double exact = 0.0;
+            try {
+                exact = KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity);
+            }
+            catch (...) {
+                continue;
+            }
+
+            CHECK_THAT(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity, Accuracy::Fast),
+                       Catch::Matchers::WithinRel(exact, 1.0E-3));
+            CHECK_THAT(KSteam::calcPropertyPT(pressure, temperature, Property::DynamicViscosity, Accuracy::Fast),
+                       Catch::Matchers::WithinRel(KSteam::calcPropertyPT(pressure, temperature, Property::DynamicViscosity), 1.0E-8));
+        }
+    }
+
+    SECTION("Fast transport properties match the exact values for saturated states")
+    {
+        for (double pressure = 1.0E3; pressure < 2.2E7; pressure *= 1.1) {
+            for (double quality : { 0.0, 1.0 }) {
+                INFO("P = " << pressure << ", x = " << quality);
+                CHECK_THAT(KSteam::calcPropertyPX(pressure, quality, Property::ThermalConductivity, Accuracy::Fast),
+                           Catch::Matchers::WithinRel(KSteam::calcPropertyPX(pressure, quality, Property::ThermalConductivity), 1.0E-3));
+                CHECK_THAT(KSteam::calcPropertyPX(pressure, quality, Property::DynamicViscosity, Accuracy::Fast),
+                           Catch::Matchers::WithinRel(KSteam::calcPropertyPX(pressure, quality, Property::DynamicViscosity), 1.0E-8));
+            }
+        }
+    }
+
+    SECTION("Fast transport properties match the exact values close to the critical point")
+    {
+        // Saturated states on a fine grid up to the critical pressure, where the enhancement changes rapidly.
+        for (double pressure = 1.9E7; pressure < IF97::get_pcrit(); pressure += 1.0E4) {
+            for (double quality : { 0.0, 1.0 }) {
+                INFO("P = " << pressure << ", x = " << quality);
+                CHECK_THAT(KSteam::calcPropertyPX(pressure, quality, Property::ThermalConductivity, Accuracy::Fast),
+                           Catch::Matchers::WithinRel(KSteam::calcPropertyPX(pressure, quality, Property::ThermalConductivity), 1.0E-3));
+            }
+        }
+
+        // Single phase states around the box in (T, rho) that is always evaluated exactly (645.096-650.096 K,
+        // 272-362 kg/m³), including the states just outside it.
+        for (double temperature = 640.0; temperature <= 660.0; temperature += 0.1) {
+            for (double pressure = 2.0E7; pressure <= 2.5E7; pressure += 2.5E4) {
+                INFO("P = " << pressure << ", T = " << temperature);
+                if (temperature < IF97::get_Tcrit() && std::abs(pressure - IF97::psat97(temperature)) < 1.0) continue;
+                CHECK_THAT(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity, Accuracy::Fast),
+                           Catch::Matchers::WithinRel(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity), 1.0E-3));
+            }
+        }
+
+        using KSteam::impl::TransportData::CriticalRhoMax;
+        using KSteam::impl::TransportData::CriticalRhoMin;
+        using KSteam::impl::TransportData::CriticalTMax;
+        using KSteam::impl::TransportData::CriticalTMin;
+
+        std::vector<std::pair<double, double>> edges;
+        for (double density = CriticalRhoMin - 20.0; density <= CriticalRhoMax + 20.0; density += 5.0) {
+            edges.emplace_back(CriticalTMin - 0.01, density);
+            edges.emplace_back(CriticalTMax + 0.01, density);
+        }
+        for (double temperature = CriticalTMin; temperature <= CriticalTMax; temperature += 0.25) {
+            edges.emplace_back(temperature, CriticalRhoMin - 0.1);
+            edges.emplace_back(temperature, CriticalRhoMax + 0.1);
+        }
+
+        // The states are all in region 3, where the pressure is given explicitly by the basic equation in (T, rho).
+        const IF97::Region3 region3;
+        for (auto [temperature, density] : edges) {
+            if (temperature < IF97::get_Tcrit()) {
+                const auto psat = IF97::psat97(temperature);
+                if (density >= IF97::rhovap_p(psat) && density <= IF97::rholiq_p(psat)) continue;
+            }
+
+            auto pressure = region3.p(temperature, density);
+            INFO("T = " << temperature << ", RHO = " << density << ", P = " << pressure);
+            CHECK_THAT(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity, Accuracy::Fast),
+                       Catch::Matchers::WithinRel(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity), 1.0E-3));
+        }
+    }
+
+    SECTION("High temperature states have no critical enhancement")
+    {
+        for (double temperature : { 1100.0, 1500.0, 2000.0 }) {
+            CHECK_THAT(KSteam::calcPropertyPT(1.0E6, temperature, Property::ThermalConductivity, Accuracy::Fast),
+                       Catch::Matchers::WithinRel(KSteam::calcPropertyPT(1.0E6, temperature, Property::ThermalConductivity), 1.0E-6));
+        }
+
+        // Above 1073.15 K (region 5), the enhancement is dropped. It stays within the tolerance up to the maximum pressure.
+        for (double temperature = 1073.15; temperature <= 2273.15; temperature += 50.0) {
+            for (double pressure = 1.0E3; pressure <= 5.0E7; pressure *= 1.5) {
+                INFO("P = " << pressure << ", T = " << temperature);
+                CHECK_THAT(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity, Accuracy::Fast),
+                           Catch::Matchers::WithinRel(KSteam::calcPropertyPT(pressure, temperature, Property::ThermalConductivity), 1.0E-3));
+            }
+            CHECK_THAT(KSteam::calcPropertyPT(5.0E7, temperature, Property::ThermalConductivity, Accuracy::Fast),
+                       Catch::Matchers::WithinRel(KSteam::calcPropertyPT(5.0E7, temperature, Property::ThermalConductivity), 1.0E-3));
+        }
+    }
+
+    SECTION("The accuracy policy is passed through the flash calculations")
+    {
+        std::vector<Property> props { Property::Temperature, Property::ThermalConductivity, Property::PrandtlNumber };
+        std::vector<double>   exact(props.size());
+        std::vector<double>   fast(props.size());
+
+        auto enthalpy = KSteam::calcPropertyPT(1.0E6, 500.0, "H");
+        KSteam::calcPropertiesPH(1.0E6, enthalpy, props, exact);
+        KSteam::calcPropertiesPH(1.0E6, enthalpy, props, fast, Accuracy::Fast);
+
+        for (size_t i = 0; i < props.size(); ++i) CHECK_THAT(fast[i], Catch::Matchers::WithinRel(exact[i], 1.0E-3));
+        CHECK(KSteam::calcPropertyPH(1.0E6, enthalpy, Property::ThermalConductivity, Accuracy::Exact) == exact[1]);
+
+        // Two-phase states are not covered by the surrogates, and take the exact path, which rejects transport properties.
+        for (auto property : { Property::ThermalConductivity, Property::DynamicViscosity }) {
+            CHECK_THROWS_AS(KSteam::calcPropertyTX(400.0, 0.5, property), KSteam::KSteamError);
+            CHECK_THROWS_AS(KSteam::calcPropertyTX(400.0, 0.5, property, Accuracy::Fast), KSteam::KSteamError);
+        }
+
+        // Saturated liquid and vapor are evaluated from the surrogates.
+        const auto pressure = IF97::psat97(400.0);
+        for (double quality : { 0.0, 1.0 }) {
+            INFO("x = " << quality);
+            const auto temperature  = IF97::Tsat97(pressure);
+            const auto density      = quality == 0.0 ? IF97::rholiq_p(pressure) : IF97::rhovap_p(pressure);
+            const auto conductivity = KSteam::impl::thermalConductivitySurrogate(temperature, density);
+            const auto viscosity    = KSteam::impl::viscositySurrogate(temperature, density);
+            REQUIRE(conductivity.has_value());
+            REQUIRE(viscosity.has_value());
+
+            CHECK(KSteam::calcPropertyPX(pressure, quality, Property::ThermalConductivity, Accuracy::Fast) == *conductivity);
+            CHECK(KSteam::calcPropertyPX(pressure, quality, Property::DynamicViscosity, Accuracy::Fast) == *viscosity);
+            CHECK(KSteam::calcPropertyTX(400.0, quality, Property::ThermalConductivity, Accuracy::Fast) == *conductivity);
+            CHECK_THAT(*conductivity, Catch::Matchers::WithinRel(KSteam::calcPropertyPX(pressure, quality, Property::ThermalConductivity), 1.0E-3));
+        }
+    }
+}
@@ -0,0 +1,175 @@
+//
+// Tests for the derivative based uncertainty propagation.
+//
+
+#include "TestXLSteamCommon.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Reference gradients found by repeating the flash calculation at perturbed specifications.
+inline auto bruteForceGradient(KSteam::Property spec1, double value1, KSteam::Property spec2, double value2, KSteam::Property prop)
+{
+    auto h1 = 1.0E-4 * std::abs(value1);
+    auto h2 = 1.0E-4 * std::abs(value2);
+
+    auto eval = [&](double v1, double v2) { return KSteam::impl::flash(spec1, v1, spec2, v2).property(prop); };
+
+    return std::make_pair((eval(value1 + h1, value2) - eval(value1 - h1, value2)) / (2.0 * h1),
+                          (eval(value1, value2 + h2) - eval(value1, value2 - h2)) / (2.0 * h2));
+}
+
+inline void checkGradients(KSteam::Property spec1, double value1, KSteam::Property spec2, double value2)
+{
+    INFO(spec1.asString() << " = " << value1 << ", " << spec2.asString() << " = " << value2);
+
+    std::vector<KSteam::Property> props { KSteam::Property::Temperature, KSteam::Property::Density, KSteam::Property::Entropy };
+
+    auto state     = KSteam::impl::flash(spec1, value1, spec2, value2);
+    auto gradients = KSteam::impl::specificationGradients(state, spec1, spec2, props);
+
+    for (size_t i = 0; i < props.size(); ++i) {
+        // The reference is limited by the solver tolerance, so tiny gradients are compared in absolute terms
+        auto ref   = bruteForceGradient(spec1, value1, spec2, value2, props[i]);
+        auto value = std::abs(state.property(props[i]));
+        CHECK_THAT(gradients[i * 2],
+                   Catch::Matchers::WithinRel(ref.first, 0.01) || Catch::Matchers::WithinAbs(ref.first, 1.0E-6 * value / std::abs(value1)));
+        CHECK_THAT(gradients[i * 2 + 1],
+                   Catch::Matchers::WithinRel(ref.second, 0.01) || Catch::Matchers::WithinAbs(ref.second, 1.0E-6 * value / std::abs(value2)));
+    }
+}
+
+TEST_CASE("KSteam Uncertainty Propagation")
+{
+    using KSteam::Property;
+
+    SECTION("Gradients match repeated flash calculations")
+    {
+        for (auto [pressure, temperature] : std::vector<std::pair<double, double>> { { 1.0E5, 300.0 }, { 1.0E6, 500.0 }, { 3.0E7, 700.0 } }) {
+            auto enthalpy = KSteam::calcPropertyPT(pressure, temperature, "H");
+            auto entropy  = KSteam::calcPropertyPT(pressure, temperature, "S");
+
+            checkGradients(Property::Pressure, pressure, Property::Enthalpy, enthalpy);
+            checkGradients(Property::Pressure, pressure, Property::Entropy, entropy);
+            checkGradients(Property::Enthalpy, enthalpy, Property::Pressure, pressure);
+        }
+
+        // For liquid, the volume is too insensitive to pressure for the repeated flash to be a useful reference
+        checkGradients(Property::Temperature, 500.0, Property::Volume, KSteam::calcPropertyPT(1.0E6, 500.0, "V"));
+        checkGradients(Property::Temperature, 700.0, Property::Volume, KSteam::calcPropertyPT(3.0E7, 700.0, "V"));
+
+        auto enthalpy = KSteam::calcPropertyPX(1.0E6, 0.5, "H");
+        checkGradients(Property::Pressure, 1.0E6, Property::Enthalpy, enthalpy);
+    }
+
+    SECTION("Gradients of the basic properties are analytic")
+    {
+        // In regions 1, 2 and 5, dH/dT at constant pressure is the isobaric heat capacity, and dS/dT is Cp / T.
+        std::vector<Property> props { Property::Enthalpy, Property::Entropy };
+        for (auto [pressure, temperature] : std::vector<std::pair<double, double>> { { 1.0E5, 300.0 }, { 1.0E6, 500.0 }, { 5.0E5, 1500.0 } }) {
+            INFO("P = " << pressure << ", T = " << temperature);
+            auto state     = KSteam::impl::FlashState::fromPT(pressure, temperature);
+            auto gradients = KSteam::impl::specificationGradients(state, Property::Pressure, Property::Temperature, props);
+            auto cp        = KSteam::calcPropertyPT(pressure, temperature, "Cp");
+            CHECK_THAT(gradients[1], Catch::Matchers::WithinRel(cp, 1.0E-12));
+            CHECK_THAT(gradients[3], Catch::Matchers::WithinRel(cp / temperature, 1.0E-12));
+        }
+
+        // For saturated states, dH/dx is the enthalpy of vaporization, and dT/dP is the slope of the saturation curve.
+        auto state     = KSteam::impl::FlashState::fromPX(1.0E6, 0.5);
+        auto gradients = KSteam::impl::specificationGradients(
+            state, Property::Pressure, Property::VaporQuality, std::vector<Property> { Property::Enthalpy, Property::Temperature });
+        CHECK_THAT(gradients[1],
+                   Catch::Matchers::WithinRel(KSteam::calcPropertyPX(1.0E6, 1.0, "H") - KSteam::calcPropertyPX(1.0E6, 0.0, "H"), 1.0E-12));
+        CHECK_THAT(gradients[2], Catch::Matchers::WithinRel((IF97::Tsat97(1.0E6 + 1.0) - IF97::Tsat97(1.0E6 - 1.0)) / 2.0, 1.0E-6));
+    }
+
+    SECTION("Specified properties keep their input uncertainty")
+    {
+        std::vector<double>   pressure { 1.0E5, 1.0E6 };
+        std::vector<double>   enthalpy { KSteam::calcPropertyPT(1.0E5, 300.0, "H"), KSteam::calcPropertyPX(1.0E6, 0.5, "H") };
+        std::vector<double>   sdPressure { 1.0E3, 1.0E4 };
+        std::vector<double>   sdEnthalpy { 1.0E3, 2.0E3 };
+        std::vector<Property> props { Property::Pressure, Property::Enthalpy, Property::Temperature };
+
+        std::vector<double> means(pressure.size() * props.size());
+        std::vector<double> stdDevs(means.size());
+
+        KSteam::propagateUncertainty(Property::Pressure, Property::Enthalpy, pressure, enthalpy, sdPressure, sdEnthalpy, props, means, stdDevs);
+
+        for (size_t i = 0; i < pressure.size(); ++i) {
+            CHECK_THAT(means[i * 3], Catch::Matchers::WithinRel(pressure[i], 1.0E-9));
+            CHECK_THAT(means[i * 3 + 1], Catch::Matchers::WithinRel(enthalpy[i], 1.0E-9));
+            CHECK_THAT(stdDevs[i * 3], Catch::Matchers::WithinRel(sdPressure[i], 1.0E-4));
+            CHECK_THAT(stdDevs[i * 3 + 1], Catch::Matchers::WithinRel(sdEnthalpy[i], 1.0E-4));
+        }
+    }
+
+    SECTION("Second order correction matches Monte Carlo sampling")
+    {
+        // Low pressure steam is close to an ideal gas, V = RT/P, so the volume is convex in the pressure. With a 10%
+        // uncertainty in the pressure, the mean volume is about (sdP/P)^2 = 1% above the volume at the mean pressure.
+        // The entropy, S = S0 - R ln(P), falls with the pressure as the volume does, so the two are strongly correlated.
+        std::vector<double>   pressure { 1.0E4 };
+        std::vector<double>   temperature { 500.0 };
+        std::vector<double>   sdPressure { 1.0E3 };
+        std::vector<double>   sdTemperature { 1.0 };
+        std::vector<Property> props { Property::Volume, Property::Entropy };
+
+        std::vector<double> first(2), second(2), sdFirst(2), sdSecond(2), covFirst(4), covSecond(4);
+
+        KSteam::propagateUncertainty(
+            Property::Pressure, Property::Temperature, pressure, temperature, sdPressure, sdTemperature, props, first, sdFirst, covFirst);
+        KSteam::propagateUncertainty(Property::Pressure,
+                                     Property::Temperature,
+                                     pressure,
+                                     temperature,
+                                     sdPressure,
+                                     sdTemperature,
+                                     props,
+                                     second,
+                                     sdSecond,
+                                     covSecond,
+                                     KSteam::PropagationOrder::Second);
+
+        // With 100000 samples, the standard error of the sampled mean is about 0.1 / sqrt(100000) = 3E-4 relative.
+        std::mt19937                     gen(42);
+        std::normal_distribution<double> distP(pressure[0], sdPressure[0]);
+        std::normal_distribution<double> distT(temperature[0], sdTemperature[0]);
+
+        const int samples    = 100000;
+        double    sum        = 0.0;
+        double    sumSq      = 0.0;
+        double    sumEntropy = 0.0;
+        double    sumCross   = 0.0;
+        for (int i = 0; i < samples; ++i) {
+            auto sampleP = distP(gen);
+            auto sampleT = distT(gen);
+            auto volume  = KSteam::calcPropertyPT(sampleP, sampleT, "V");
+            auto entropy = KSteam::calcPropertyPT(sampleP, sampleT, "S");
+            sum += volume;
+            sumSq += volume * volume;
+            sumEntropy += entropy;
+            sumCross += volume * entropy;
+        }
+        auto mean       = sum / samples;
+        auto stdDev     = std::sqrt(sumSq / samples - mean * mean);
+        auto covariance = sumCross / samples - mean * sumEntropy / samples;
+
+        // The second order mean is within 2E-3 (about six standard errors) of the sampled mean, while the first
+        // order mean is off by about 1E-2.
+        CHECK_THAT(second[0], Catch::Matchers::WithinRel(mean, 2.0E-3));
+        CHECK_THAT(first[0], !Catch::Matchers::WithinRel(mean, 5.0E-3));
+        CHECK(second[0] > first[0]);
+
+        // The neglected higher order terms contribute about 3% of the standard deviation for a 10% uncertainty.
+        CHECK_THAT(sdSecond[0], Catch::Matchers::WithinRel(stdDev, 0.05));
+        CHECK(std::abs(sdSecond[0] - stdDev) < std::abs(sdFirst[0] - stdDev));
+
+        // The same holds for the covariance of the volume and the entropy (about 3%, with a sampling error of about
+        // 0.5% at a correlation close to one), where the second order terms of both properties contribute.
+        CHECK_THAT(covSecond[1], Catch::Matchers::WithinRel(covariance, 0.05));
+        CHECK(std::abs(covSecond[1] - covariance) < std::abs(covFirst[1] - covariance));
+    }
+}
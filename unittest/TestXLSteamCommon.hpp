@@ -11,6 +11,8 @@
 #include <catch2/generators/catch_generators_all.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <array>
+#include <optional>
 #include <random>
 #include <tuple>
 
@@ -20,6 +22,20 @@ enum Property { P, T, V, RHO, H, S, U, X };
 
 using Properties = std::tuple<double, double, double, double, double, double, double, double>;
 
+// The properties to compute in a single flash, in the same order as the Properties tuple.
+inline const std::array<KSteam::Property, 8> PropertyList { KSteam::Property("P"), KSteam::Property("T"),   KSteam::Property("V"),
+                                                            KSteam::Property("RHO"), KSteam::Property("H"), KSteam::Property("S"),
+                                                            KSteam::Property("U"), KSteam::Property("X") };
+
+// Computes all the properties in PropertyList from a single flash calculation.
+inline auto computePropsFlash(auto calcProperties)
+{
+    std::array<double, 8> results {};
+    calcProperties(PropertyList, results);
+
+    return std::apply([](auto... values) { return Properties { values... }; }, results);
+}
+
 inline void checkProps(const auto& props, const auto& refProps)
 {
     CHECK_THAT(std::get<P>(props),
@@ -83,82 +99,27 @@ inline auto computePropsPX(double pressure, double quality)
 
 inline auto computePropsPH(double pressure, double enthalpy)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "P");
-    std::get<T>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "T");
-    std::get<V>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "V");
-    std::get<RHO>(props) = KSteam::calcPropertyPH(pressure, enthalpy, "RHO");
-    std::get<H>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "H");
-    std::get<S>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "S");
-    std::get<U>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "U");
-    std::get<X>(props)   = KSteam::calcPropertyPH(pressure, enthalpy, "X");
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesPH(pressure, enthalpy, properties, results); });
 }
 
 inline auto computePropsPS(double pressure, double entropy)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyPS(pressure, entropy, "P");
-    std::get<T>(props)   = KSteam::calcPropertyPS(pressure, entropy, "T");
-    std::get<V>(props)   = KSteam::calcPropertyPS(pressure, entropy, "V");
-    std::get<RHO>(props) = KSteam::calcPropertyPS(pressure, entropy, "RHO");
-    std::get<H>(props)   = KSteam::calcPropertyPS(pressure, entropy, "H");
-    std::get<S>(props)   = KSteam::calcPropertyPS(pressure, entropy, "S");
-    std::get<U>(props)   = KSteam::calcPropertyPS(pressure, entropy, "U");
-    std::get<X>(props)   = KSteam::calcPropertyPS(pressure, entropy, "X");
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesPS(pressure, entropy, properties, results); });
 }
 
-inline auto computePropsPV(double pressure, double volume, double TGuess)
+inline auto computePropsPV(double pressure, double volume, std::optional<double> TGuess = std::nullopt)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyPV(pressure, volume, "P", TGuess);
-    std::get<T>(props)   = KSteam::calcPropertyPV(pressure, volume, "T", TGuess);
-    std::get<V>(props)   = KSteam::calcPropertyPV(pressure, volume, "V", TGuess);
-    std::get<RHO>(props) = KSteam::calcPropertyPV(pressure, volume, "RHO", TGuess);
-    std::get<H>(props)   = KSteam::calcPropertyPV(pressure, volume, "H", TGuess);
-    std::get<S>(props)   = KSteam::calcPropertyPV(pressure, volume, "S", TGuess);
-    std::get<U>(props)   = KSteam::calcPropertyPV(pressure, volume, "U", TGuess);
-    std::get<X>(props)   = KSteam::calcPropertyPV(pressure, volume, "X", TGuess);
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesPV(pressure, volume, properties, results, TGuess); });
 }
 
-inline auto computePropsPRHO(double pressure, double density, double TGuess)
+inline auto computePropsPRHO(double pressure, double density, std::optional<double> TGuess = std::nullopt)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyPRHO(pressure, density, "P", TGuess);
-    std::get<T>(props)   = KSteam::calcPropertyPRHO(pressure, density, "T", TGuess);
-    std::get<V>(props)   = KSteam::calcPropertyPRHO(pressure, density, "V", TGuess);
-    std::get<RHO>(props) = KSteam::calcPropertyPRHO(pressure, density, "RHO", TGuess);
-    std::get<H>(props)   = KSteam::calcPropertyPRHO(pressure, density, "H", TGuess);
-    std::get<S>(props)   = KSteam::calcPropertyPRHO(pressure, density, "S", TGuess);
-    std::get<U>(props)   = KSteam::calcPropertyPRHO(pressure, density, "U", TGuess);
-    std::get<X>(props)   = KSteam::calcPropertyPRHO(pressure, density, "X", TGuess);
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesPRHO(pressure, density, properties, results, TGuess); });
 }
 
 inline auto computePropsPU(double pressure, double internalEnergy)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "P");
-    std::get<T>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "T");
-    std::get<V>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "V");
-    std::get<RHO>(props) = KSteam::calcPropertyPU(pressure, internalEnergy, "RHO");
-    std::get<H>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "H");
-    std::get<S>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "S");
-    std::get<U>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "U");
-    std::get<X>(props)   = KSteam::calcPropertyPU(pressure, internalEnergy, "X");
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesPU(pressure, internalEnergy, properties, results); });
 }
 
 // Functions for computing properties using the temperature as one of the inputs
@@ -180,82 +141,27 @@ inline auto computePropsTX(double temperature, double quality)
 
 inline auto computePropsTV(double temperature, double volume)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyTV(temperature, volume, "P");
-    std::get<T>(props)   = KSteam::calcPropertyTV(temperature, volume, "T");
-    std::get<V>(props)   = KSteam::calcPropertyTV(temperature, volume, "V");
-    std::get<RHO>(props) = KSteam::calcPropertyTV(temperature, volume, "RHO");
-    std::get<H>(props)   = KSteam::calcPropertyTV(temperature, volume, "H");
-    std::get<S>(props)   = KSteam::calcPropertyTV(temperature, volume, "S");
-    std::get<U>(props)   = KSteam::calcPropertyTV(temperature, volume, "U");
-    std::get<X>(props)   = KSteam::calcPropertyTV(temperature, volume, "X");
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesTV(temperature, volume, properties, results); });
 }
 
 inline auto computePropsTRHO(double temperature, double density)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyTRHO(temperature, density, "P");
-    std::get<T>(props)   = KSteam::calcPropertyTRHO(temperature, density, "T");
-    std::get<V>(props)   = KSteam::calcPropertyTRHO(temperature, density, "V");
-    std::get<RHO>(props) = KSteam::calcPropertyTRHO(temperature, density, "RHO");
-    std::get<H>(props)   = KSteam::calcPropertyTRHO(temperature, density, "H");
-    std::get<S>(props)   = KSteam::calcPropertyTRHO(temperature, density, "S");
-    std::get<U>(props)   = KSteam::calcPropertyTRHO(temperature, density, "U");
-    std::get<X>(props)   = KSteam::calcPropertyTRHO(temperature, density, "X");
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesTRHO(temperature, density, properties, results); });
 }
 
-inline auto computePropsTH(double temperature, double enthalpy, double PGuess)
+inline auto computePropsTH(double temperature, double enthalpy, std::optional<double> PGuess = std::nullopt)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "P", PGuess);
-    std::get<T>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "T", PGuess);
-    std::get<V>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "V", PGuess);
-    std::get<RHO>(props) = KSteam::calcPropertyTH(temperature, enthalpy, "RHO", PGuess);
-    std::get<H>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "H", PGuess);
-    std::get<S>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "S", PGuess);
-    std::get<U>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "U", PGuess);
-    std::get<X>(props)   = KSteam::calcPropertyTH(temperature, enthalpy, "X", PGuess);
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesTH(temperature, enthalpy, properties, results, PGuess); });
 }
 
-inline auto computePropsTS(double temperature, double entropy, double PGuess)
+inline auto computePropsTS(double temperature, double entropy, std::optional<double> PGuess = std::nullopt)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyTS(temperature, entropy, "P", PGuess);
-    std::get<T>(props)   = KSteam::calcPropertyTS(temperature, entropy, "T", PGuess);
-    std::get<V>(props)   = KSteam::calcPropertyTS(temperature, entropy, "V", PGuess);
-    std::get<RHO>(props) = KSteam::calcPropertyTS(temperature, entropy, "RHO", PGuess);
-    std::get<H>(props)   = KSteam::calcPropertyTS(temperature, entropy, "H", PGuess);
-    std::get<S>(props)   = KSteam::calcPropertyTS(temperature, entropy, "S", PGuess);
-    std::get<U>(props)   = KSteam::calcPropertyTS(temperature, entropy, "U", PGuess);
-    std::get<X>(props)   = KSteam::calcPropertyTS(temperature, entropy, "X", PGuess);
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesTS(temperature, entropy, properties, results, PGuess); });
 }
 
-inline auto computePropsTU(double temperature, double intEnergy, double PGuess)
+inline auto computePropsTU(double temperature, double intEnergy, std::optional<double> PGuess = std::nullopt)
 {
-    Properties props {};
-
-    std::get<P>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "P", PGuess);
-    std::get<T>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "T", PGuess);
-    std::get<V>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "V", PGuess);
-    std::get<RHO>(props) = KSteam::calcPropertyTU(temperature, intEnergy, "RHO", PGuess);
-    std::get<H>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "H", PGuess);
-    std::get<S>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "S", PGuess);
-    std::get<U>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "U", PGuess);
-    std::get<X>(props)   = KSteam::calcPropertyTU(temperature, intEnergy, "X", PGuess);
-
-    return props;
+    return computePropsFlash([&](const auto& properties, auto& results) { KSteam::calcPropertiesTU(temperature, intEnergy, properties, results, PGuess); });
 }
 
 // Check calculations using pressure in the saturation region
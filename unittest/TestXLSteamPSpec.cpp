@@ -4,6 +4,24 @@
 
 #include "TestXLSteamCommon.hpp"
 
+TEST_CASE("P Specifications on the Saturation Line")
+{
+    // At low pressure, the vapor volume is up to 1E5 times the liquid volume, so the quality of a two-phase state must be
+    // found to well below the solver tolerance for the specific volume of a nearly saturated liquid to be accurate.
+    for (double pressure : { 1.0E3, 1.0E4, 1.0E5, 1.0E6, 1.0E7 }) {
+        for (double quality : { 0.0, 1.0E-6, 0.5, 1.0 }) {
+            INFO("P = " << pressure << ", x = " << quality);
+            auto volume = KSteam::calcPropertyPX(pressure, quality, "V");
+
+            CHECK_THAT(KSteam::calcPropertyPH(pressure, KSteam::calcPropertyPX(pressure, quality, "H"), "V"), Catch::Matchers::WithinRel(volume, 1.0E-9));
+            CHECK_THAT(KSteam::calcPropertyPS(pressure, KSteam::calcPropertyPX(pressure, quality, "S"), "V"), Catch::Matchers::WithinRel(volume, 1.0E-9));
+            CHECK_THAT(KSteam::calcPropertyPU(pressure, KSteam::calcPropertyPX(pressure, quality, "U"), "V"), Catch::Matchers::WithinRel(volume, 1.0E-9));
+            CHECK_THAT(KSteam::calcPropertyPV(pressure, volume, "X"), Catch::Matchers::WithinAbs(quality, 1.0E-12));
+            CHECK_THAT(KSteam::calcPropertyPRHO(pressure, 1.0 / volume, "X"), Catch::Matchers::WithinAbs(quality, 1.0E-12));
+        }
+    }
+}
+
 //TEST_CASE("Rigorous Test")
 //{
 //    double pressureFirst = 1000.0;
@@ -83,6 +83,38 @@
 //    }
 //}
 
+TEST_CASE("T Specifications on Liquid Isotherms")
+{
+    // The liquid part of the isotherm spans the values between the saturated liquid and the maximum pressure. Values in
+    // this range must be solved as compressed liquid, not as two-phase states at the saturation pressure.
+    SECTION("Compressed liquid")
+    {
+        for (double temperature : { 300.0, 373.15, 433.15 }) {
+            for (double pressure : { 1.0E6, 1.0E7, 3.0E7, 8.0E7 }) {
+                INFO("P = " << pressure << ", T = " << temperature);
+                CHECK_THAT(KSteam::calcPropertyTH(temperature, KSteam::calcPropertyPT(pressure, temperature, "H"), "P"),
+                           Catch::Matchers::WithinRel(pressure, 1.0E-6));
+                CHECK_THAT(KSteam::calcPropertyTS(temperature, KSteam::calcPropertyPT(pressure, temperature, "S"), "P"),
+                           Catch::Matchers::WithinRel(pressure, 1.0E-6));
+                CHECK_THAT(KSteam::calcPropertyTU(temperature, KSteam::calcPropertyPT(pressure, temperature, "U"), "P"),
+                           Catch::Matchers::WithinRel(pressure, 1.0E-6));
+            }
+        }
+    }
+
+    SECTION("Saturated liquid and vapor")
+    {
+        for (double temperature : { 300.0, 500.0, 600.0 }) {
+            for (double quality : { 0.0, 1.0 }) {
+                INFO("T = " << temperature << ", x = " << quality);
+                CHECK(KSteam::calcPropertyTH(temperature, KSteam::calcPropertyTX(temperature, quality, "H"), "X") == quality);
+                CHECK(KSteam::calcPropertyTU(temperature, KSteam::calcPropertyTX(temperature, quality, "U"), "X") == quality);
+                CHECK(KSteam::calcPropertyTV(temperature, KSteam::calcPropertyTX(temperature, quality, "V"), "X") == quality);
+            }
+        }
+    }
+}
+
 TEST_CASE("Fuzz Test T")
 {
     std::random_device rd;